@@ -1,12 +1,17 @@
 #include "Components/SaveableActorComponent.h"
+#include "Save/SaveableActorRegistry.h"
+#include "Save/SaveableActorSpatialIndex.h"
+#include "Inventory/StorageComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "Engine/World.h"
+#include "Engine/Level.h"
 #include "GameFramework/Actor.h"
-#include "EngineUtils.h"
 
 USaveableActorComponent::USaveableActorComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	PrimaryComponentTick.bCanEverTick = false;
+	bWantsInitializeComponent = true;
 	bSaveTransform = true;
 	bSavePhysicsState = true;
 }
@@ -15,8 +20,13 @@ void USaveableActorComponent::PostInitProperties()
 {
 	Super::PostInitProperties();
 
-	// Generate GUID if not set (for both editor-placed and runtime-spawned actors)
-	// This ensures each instance gets a unique ID, even if added to a blueprint
+	// Templates never get an ID; instances created from them would all inherit it
+	if (HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	// Generate GUID if not set (runtime-spawned actors keep it; level-placed ones are re-keyed in InitializeComponent)
 	// Note: If loading from save, the GUID will already be set via serialization
 	if (!PersistentId.IsValid())
 	{
@@ -33,6 +43,40 @@ void USaveableActorComponent::PostInitProperties()
 	}
 }
 
+void USaveableActorComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	// Actors loaded with their level (net startup actors) get the ID of where they were placed, so a restore finds
+	// them by ID whatever was serialized into the map. Dimension actors are keyed by TagActorsInDimension instead.
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->IsNetStartupActor() && !DimensionInstanceId.IsValid())
+	{
+		SetPersistentId(MakeLevelActorId(Owner));
+	}
+}
+
+void USaveableActorComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	// Register with the world (not on BeginPlay) so restore code that runs before BeginPlay can find us by GUID
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(GetWorld()))
+	{
+		Registry->Register(this);
+	}
+}
+
+void USaveableActorComponent::OnUnregister()
+{
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(GetWorld()))
+	{
+		Registry->Unregister(this);
+	}
+
+	Super::OnUnregister();
+}
+
 void USaveableActorComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -41,7 +85,7 @@ void USaveableActorComponent::BeginPlay()
 	// Note: If loading from save, the GUID should already be set via SetPersistentId() before BeginPlay
 	if (!PersistentId.IsValid())
 	{
-		PersistentId = FGuid::NewGuid();
+		SetPersistentId(FGuid::NewGuid());
 		UE_LOG(LogTemp, Verbose, TEXT("[SaveableActorComponent] Generated new GUID in BeginPlay for %s: %s"), 
 			*GetOwner()->GetName(), *PersistentId.ToString(EGuidFormats::DigitsWithHyphensInBraces));
 	}
@@ -68,35 +112,133 @@ void USaveableActorComponent::BeginPlay()
 		UE_LOG(LogTemp, Verbose, TEXT("[SaveableActorComponent] OriginalTransform already set for %s: %s"), 
 			GetOwner() ? *GetOwner()->GetName() : TEXT("Unknown"), *OriginalTransform.GetLocation().ToString());
 	}
+
+	// Dirty triggers that the transform threshold can't see
+	if (AActor* Owner = GetOwner())
+	{
+		if (UPrimitiveComponent* PrimitiveComp = Owner->FindComponentByClass<UPrimitiveComponent>())
+		{
+			PrimitiveComp->OnComponentWake.AddDynamic(this, &USaveableActorComponent::HandleComponentWake);
+		}
+		if (UStorageComponent* StorageComp = Owner->FindComponentByClass<UStorageComponent>())
+		{
+			StorageComp->OnItemAdded.AddDynamic(this, &USaveableActorComponent::HandleStorageItemAdded);
+			StorageComp->OnItemRemoved.AddDynamic(this, &USaveableActorComponent::HandleStorageItemRemoved);
+			StorageComp->OnItemChanged.AddDynamic(this, &USaveableActorComponent::HandleStorageItemChanged);
+		}
+	}
 }
 
-AActor* USaveableActorComponent::FindActorByGuid(UWorld* World, const FGuid& ActorId)
+bool USaveableActorComponent::IsSaveStateDirty() const
 {
-	if (!World || !ActorId.IsValid())
+	const AActor* Owner = GetOwner();
+	if (bSaveStateDirty || !Owner)
 	{
-		return nullptr;
+		return true;
 	}
 
-	// Iterate through all actors in the world
-	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	const FTransform CurrentTransform = Owner->GetActorTransform();
+	if (FVector::DistSquared(CurrentTransform.GetLocation(), LastCapturedTransform.GetLocation()) > FMath::Square(DirtyLocationThreshold))
+	{
+		return true;
+	}
+	if (FMath::RadiansToDegrees(CurrentTransform.GetRotation().AngularDistance(LastCapturedTransform.GetRotation())) > DirtyRotationThreshold)
+	{
+		return true;
+	}
+	if (!CurrentTransform.GetScale3D().Equals(LastCapturedTransform.GetScale3D()))
 	{
-		AActor* Actor = *ActorIterator;
-		if (!Actor)
+		return true;
+	}
+
+	const UPrimitiveComponent* PrimitiveComp = Owner->FindComponentByClass<UPrimitiveComponent>();
+	return PrimitiveComp && PrimitiveComp->IsSimulatingPhysics() && PrimitiveComp->RigidBodyIsAwake();
+}
+
+void USaveableActorComponent::MarkSaveStateCaptured()
+{
+	bSaveStateDirty = false;
+	if (AActor* Owner = GetOwner())
+	{
+		LastCapturedTransform = Owner->GetActorTransform();
+	}
+}
+
+void USaveableActorComponent::HandleComponentWake(UPrimitiveComponent* WakingComponent, FName BoneName)
+{
+	MarkSaveStateDirty();
+}
+
+void USaveableActorComponent::HandleStorageItemAdded(const FItemEntry& Item)
+{
+	MarkSaveStateDirty();
+}
+
+void USaveableActorComponent::HandleStorageItemRemoved(const FGuid& ItemId)
+{
+	MarkSaveStateDirty();
+}
+
+void USaveableActorComponent::HandleStorageItemChanged(const FItemEntry& Item)
+{
+	MarkSaveStateDirty();
+}
+
+void USaveableActorComponent::SetPersistentId(const FGuid& NewId)
+{
+	const FGuid OldId = PersistentId;
+	PersistentId = NewId;
+	MarkSaveStateDirty();
+
+	// Unregistered components are picked up with their current IDs in OnRegister
+	if (OldId != NewId && IsRegistered())
+	{
+		if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(GetWorld()))
 		{
-			continue;
+			Registry->UpdatePersistentId(this, OldId);
 		}
+	}
+}
+
+void USaveableActorComponent::SetDimensionInstanceId(const FGuid& InstanceId)
+{
+	const FGuid OldInstanceId = DimensionInstanceId;
+	DimensionInstanceId = InstanceId;
+	MarkSaveStateDirty();
 
-		// Check if this actor has a SaveableActorComponent with matching GUID
-		if (USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>())
+	if (OldInstanceId != InstanceId && IsRegistered())
+	{
+		if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(GetWorld()))
 		{
-			if (SaveableComp->PersistentId == ActorId)
-			{
-				return Actor;
-			}
+			Registry->UpdateDimensionInstanceId(this, OldInstanceId);
 		}
 	}
+}
+
+FGuid USaveableActorComponent::MakeLevelActorId(const AActor* Actor, const FGuid& DimensionInstanceId)
+{
+	const ULevel* Level = Actor ? Actor->GetLevel() : nullptr;
+	if (!Level)
+	{
+		return FGuid();
+	}
 
-	return nullptr;
+	// Every dimension instance streams the same source level under its own package name, so the instance is the scope
+	const FString Scope = DimensionInstanceId.IsValid()
+		? DimensionInstanceId.ToString(EGuidFormats::Digits)
+		: UWorld::RemovePIEPrefix(Level->GetOutermost()->GetName());
+	return FGuid::NewDeterministicGuid(Scope + TEXT(":") + Actor->GetPathName(Level));
+}
+
+AActor* USaveableActorComponent::FindActorByGuid(UWorld* World, const FGuid& ActorId)
+{
+	if (!World || !ActorId.IsValid())
+	{
+		return nullptr;
+	}
+
+	USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World);
+	return Registry ? Registry->FindActor(ActorId) : nullptr;
 }
 
 AActor* USaveableActorComponent::FindActorByGuidOrMetadata(
@@ -104,7 +246,9 @@ AActor* USaveableActorComponent::FindActorByGuidOrMetadata(
 	const FGuid& ActorId,
 	const FString& ActorClassPath,
 	const FTransform& OriginalTransform,
-	float TransformTolerance)
+	float TransformTolerance,
+	const FSaveableActorSpatialIndex* SpatialIndex,
+	const TSet<AActor*>* MatchedActors)
 {
 	if (!World || !ActorId.IsValid() || ActorClassPath.IsEmpty())
 	{
@@ -120,21 +264,17 @@ AActor* USaveableActorComponent::FindActorByGuidOrMetadata(
 
 	// Fallback: Match by class path and original transform
 	// This handles cases where GUIDs were regenerated on level load
-	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	FSaveableActorSpatialIndex LocalIndex;
+	if (!SpatialIndex)
 	{
-		AActor* Actor = *ActorIterator;
-		if (!Actor)
-		{
-			continue;
-		}
-
-		// Check if class path matches
-		FString ActorClassPathCurrent = Actor->GetClass()->GetPathName();
-		if (ActorClassPathCurrent != ActorClassPath)
-		{
-			continue;
-		}
+		LocalIndex.AddWorldActors(World);
+		SpatialIndex = &LocalIndex;
+	}
 
+	TArray<AActor*> Candidates;
+	SpatialIndex->Query(FSaveableActorSpatialIndex::InternClassPath(ActorClassPath), OriginalTransform.GetLocation(), TransformTolerance, Candidates);
+	for (AActor* Actor : Candidates)
+	{
 		// Check if this actor has a SaveableActorComponent
 		USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
 		if (!SaveableComp)
@@ -142,8 +282,9 @@ AActor* USaveableActorComponent::FindActorByGuidOrMetadata(
 			continue;
 		}
 
-		// Skip if this actor already has a valid GUID (was already matched to a different saved state)
-		if (SaveableComp->GetPersistentId().IsValid() && SaveableComp->GetPersistentId() != ActorId)
+		// Skip if this actor was already matched to a different saved state
+		if (MatchedActors ? MatchedActors->Contains(Actor)
+			: SaveableComp->GetPersistentId().IsValid() && SaveableComp->GetPersistentId() != ActorId)
 		{
 			continue;
 		}
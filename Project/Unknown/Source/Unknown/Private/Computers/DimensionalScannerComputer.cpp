@@ -311,53 +311,14 @@ void ADimensionalScannerComputer::PerformScan()
 
 	if (NearbySignals.Num() > 0)
 	{
-		// Get dimension from scanning subsystem
+		// Get dimension from scanning subsystem; the cartridge is written once its definition has loaded
 		if (UWorld* World = GetWorld())
 		{
 			if (UGameInstance* GameInstance = World->GetGameInstance())
 			{
 				if (UDimensionScanningSubsystem* ScanningSubsystem = GameInstance->GetSubsystem<UDimensionScanningSubsystem>())
 				{
-					UDimensionDefinition* DimensionDef = ScanningSubsystem->ScanForDimension();
-					if (DimensionDef)
-					{
-						// Get socketed item
-						AItemPickup* Cartridge = CartridgeSocket->GetSocketedItem();
-						if (Cartridge)
-						{
-							// Get item entry
-							FItemEntry ItemEntry = Cartridge->GetItemEntry();
-
-							// Create new cartridge data with dimension
-							FVector SpawnPos = Cartridge->GetActorLocation();
-							UDimensionCartridgeData* NewCartridgeData = UDimensionCartridgeHelpers::CreateCartridgeFromDimension(DimensionDef, SpawnPos);
-
-							if (NewCartridgeData)
-							{
-								// Update item entry
-								UDimensionCartridgeHelpers::SetCartridgeDataInItemEntry(ItemEntry, NewCartridgeData);
-
-								// Update the socketed item
-								Cartridge->SetItemEntry(ItemEntry);
-
-								// Set material parameter to indicate cartridge is no longer empty
-								if (UStaticMeshComponent* CartridgeMesh = Cartridge->Mesh)
-								{
-									const int32 MaterialElementIndex = 2;
-									if (UMaterialInterface* BaseMaterial = CartridgeMesh->GetMaterial(MaterialElementIndex))
-									{
-										// Get or create dynamic material instance
-										UMaterialInstanceDynamic* DynamicMaterial = CartridgeMesh->CreateDynamicMaterialInstance(MaterialElementIndex, BaseMaterial);
-										if (DynamicMaterial)
-										{
-											// Set IsEmpty parameter to 0 (not empty)
-											DynamicMaterial->SetScalarParameterValue(FName("IsEmpty"), 0.0f);
-										}
-									}
-								}
-							}
-						}
-					}
+					ScanningSubsystem->ScanForDimension(FOnDimensionScanned::CreateUObject(this, &ADimensionalScannerComputer::OnDimensionScanned));
 				}
 			}
 		}
@@ -396,6 +357,54 @@ void ADimensionalScannerComputer::PerformScan()
 	}
 }
 
+void ADimensionalScannerComputer::OnDimensionScanned(UDimensionDefinition* DimensionDef)
+{
+	// The cartridge can be pulled or filled while the definition loads
+	if (!DimensionDef || !CheckCartridgeInserted() || !IsCartridgeEmpty())
+	{
+		return;
+	}
+
+	// Get socketed item
+	AItemPickup* Cartridge = CartridgeSocket->GetSocketedItem();
+	if (!Cartridge)
+	{
+		return;
+	}
+
+	// Get item entry
+	FItemEntry ItemEntry = Cartridge->GetItemEntry();
+
+	// Create new cartridge data with dimension
+	FVector SpawnPos = Cartridge->GetActorLocation();
+	UDimensionCartridgeData* NewCartridgeData = UDimensionCartridgeHelpers::CreateCartridgeFromDimension(DimensionDef, SpawnPos);
+
+	if (NewCartridgeData)
+	{
+		// Update item entry
+		UDimensionCartridgeHelpers::SetCartridgeDataInItemEntry(ItemEntry, NewCartridgeData);
+
+		// Update the socketed item
+		Cartridge->SetItemEntry(ItemEntry);
+
+		// Set material parameter to indicate cartridge is no longer empty
+		if (UStaticMeshComponent* CartridgeMesh = Cartridge->Mesh)
+		{
+			const int32 MaterialElementIndex = 2;
+			if (UMaterialInterface* BaseMaterial = CartridgeMesh->GetMaterial(MaterialElementIndex))
+			{
+				// Get or create dynamic material instance
+				UMaterialInstanceDynamic* DynamicMaterial = CartridgeMesh->CreateDynamicMaterialInstance(MaterialElementIndex, BaseMaterial);
+				if (DynamicMaterial)
+				{
+					// Set IsEmpty parameter to 0 (not empty)
+					DynamicMaterial->SetScalarParameterValue(FName("IsEmpty"), 0.0f);
+				}
+			}
+		}
+	}
+}
+
 bool ADimensionalScannerComputer::CheckCartridgeInserted() const
 {
 	if (!CartridgeSocket)
@@ -0,0 +1,92 @@
+#include "Dimensions/DimensionHibernation.h"
+#include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+
+namespace DimensionHibernation
+{
+	void Hibernate(ULevel* Level, TArray<FHibernatedActorState>& OutStates)
+	{
+		OutStates.Reset();
+		if (!Level)
+		{
+			return;
+		}
+
+		for (AActor* Actor : Level->Actors)
+		{
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			FHibernatedActorState& State = OutStates.AddDefaulted_GetRef();
+			State.Actor = Actor;
+			State.bWasHidden = Actor->IsHidden();
+			State.bHadCollision = Actor->GetActorEnableCollision();
+			State.bWasTicking = Actor->IsActorTickEnabled();
+
+			TInlineComponentArray<UActorComponent*> Components;
+			Actor->GetComponents(Components);
+			for (UActorComponent* Component : Components)
+			{
+				if (Component->IsComponentTickEnabled())
+				{
+					State.TickingComponents.Add(Component);
+					Component->SetComponentTickEnabled(false);
+				}
+
+				// Velocities are kept so a thrown object carries on where it left off
+				UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component);
+				if (Primitive && Primitive->IsSimulatingPhysics())
+				{
+					FHibernatedActorState::FSimulatedBody& Body = State.SimulatedBodies.AddDefaulted_GetRef();
+					Body.Component = Primitive;
+					Body.LinearVelocity = Primitive->GetPhysicsLinearVelocity();
+					Body.AngularVelocityDegrees = Primitive->GetPhysicsAngularVelocityInDegrees();
+					Primitive->SetSimulatePhysics(false);
+				}
+			}
+
+			Actor->SetActorTickEnabled(false);
+			Actor->SetActorEnableCollision(false);
+			Actor->SetActorHiddenInGame(true);
+		}
+	}
+
+	void Resume(TArray<FHibernatedActorState>& States)
+	{
+		for (FHibernatedActorState& State : States)
+		{
+			AActor* Actor = State.Actor.Get();
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			Actor->SetActorHiddenInGame(State.bWasHidden);
+			Actor->SetActorEnableCollision(State.bHadCollision);
+			Actor->SetActorTickEnabled(State.bWasTicking);
+
+			for (const TWeakObjectPtr<UActorComponent>& Component : State.TickingComponents)
+			{
+				if (Component.IsValid())
+				{
+					Component->SetComponentTickEnabled(true);
+				}
+			}
+
+			for (const FHibernatedActorState::FSimulatedBody& Body : State.SimulatedBodies)
+			{
+				if (UPrimitiveComponent* Primitive = Body.Component.Get())
+				{
+					Primitive->SetSimulatePhysics(true);
+					Primitive->SetPhysicsLinearVelocity(Body.LinearVelocity);
+					Primitive->SetPhysicsAngularVelocityInDegrees(Body.AngularVelocityDegrees);
+				}
+			}
+		}
+		States.Reset();
+	}
+}
@@ -5,14 +5,66 @@
 #include "Engine/World.h"
 #include "Engine/LevelStreamingDynamic.h"
 #include "Engine/Level.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelScriptActor.h"
+#include "GameFramework/WorldSettings.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "EngineUtils.h"
+#include "HAL/PlatformMemory.h"
+#include "TimerManager.h"
 
 void UDimensionManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
-	CurrentInstance.Reset();
+	Instances.Reset();
+	RecentInstances.Reset();
+	ActiveInstanceId = FGuid();
 	PlayerDimensionInstanceId = FGuid();
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UDimensionManagerSubsystem::OnWorldCleanup);
+}
+
+void UDimensionManagerSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	Instances.Reset();
+	RecentInstances.Reset();
+	ActiveInstanceId = FGuid();
+	Teardowns.Reset();
+	PrefetchHandle.Reset();
+	PrefetchedLevelPath.Reset();
+	Super::Deinitialize();
+}
+
+void UDimensionManagerSubsystem::PrefetchDimension(UDimensionDefinition* DimensionDef, FGuid InstanceId)
+{
+	if (!DimensionDef)
+	{
+		return;
+	}
+
+	// The saved states only exist for an instance that has been visited before
+	if (InstanceId.IsValid())
+	{
+		if (USaveSystemSubsystem* SaveSystem = GetSaveSystemSubsystem())
+		{
+			SaveSystem->PrefetchDimensionState(InstanceId);
+		}
+	}
+
+	const FSoftObjectPath LevelPath = DimensionDef->DimensionLevel.ToSoftObjectPath();
+	if (LevelPath.IsNull() || (LevelPath == PrefetchedLevelPath && PrefetchHandle.IsValid()))
+	{
+		return;
+	}
+
+	// Replacing the handle releases the previous prefetch; its package can be collected once nothing uses it
+	PrefetchedLevelPath = LevelPath;
+	PrefetchHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		LevelPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+
+	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Prefetching dimension level %s"), *LevelPath.ToString());
 }
 
 bool UDimensionManagerSubsystem::LoadDimensionInstance(FGuid CartridgeId, UDimensionDefinition* DimensionDef, const FVector& SpawnPosition, FGuid InstanceId)
@@ -30,12 +82,56 @@ bool UDimensionManagerSubsystem::LoadDimensionInstance(FGuid CartridgeId, UDimen
 		return false;
 	}
 
-	// Unload previous dimension if one is loaded
-	if (CurrentInstance.IsSet() && CurrentInstance->bIsLoaded)
+	if (InstanceId.IsValid() && InstanceId == ActiveInstanceId)
 	{
-		UnloadDimensionInstance();
+		return true;
 	}
 
+	// Hide the active dimension; it stays loaded for a quick return
+	if (ActiveInstanceId.IsValid())
+	{
+		DeactivateActiveInstance(false);
+	}
+
+	// Still loaded from an earlier visit: just show it again (OnLevelShown broadcasts OnDimensionLoaded)
+	if (FDimensionInstanceInfo* Cached = InstanceId.IsValid() ? Instances.Find(InstanceId) : nullptr)
+	{
+		if (ULevelStreaming* CachedLevel = Cached->StreamingLevel.Get())
+		{
+			Cached->CartridgeId = CartridgeId;
+			ActiveInstanceId = InstanceId;
+			TouchInstance(InstanceId);
+
+			if (Cached->bHibernated)
+			{
+				// Never left the world: resume its actors and announce it next tick, once the caller has
+				// recorded the instance as its own (as it would for a level that streams in)
+				DimensionHibernation::Resume(Cached->HibernatedActors);
+				Cached->bHibernated = false;
+				Cached->bIsVisible = true;
+				TWeakObjectPtr<UDimensionManagerSubsystem> WeakThis(this);
+				World->GetTimerManager().SetTimerForNextTick([WeakThis, InstanceId]()
+				{
+					UDimensionManagerSubsystem* DimensionManager = WeakThis.Get();
+					if (DimensionManager && DimensionManager->ActiveInstanceId == InstanceId)
+					{
+						DimensionManager->OnDimensionLoaded.Broadcast(InstanceId);
+					}
+				});
+				UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Woke hibernated dimension instance %s"), *InstanceId.ToString());
+				return true;
+			}
+
+			CachedLevel->SetShouldBeVisible(true);
+			UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Showing resident dimension instance %s"), *InstanceId.ToString());
+			return true;
+		}
+		ReleaseInstance(InstanceId);
+	}
+
+	// A released copy still being torn down has actors registered under the persistent IDs the new copy will take
+	FlushTeardown(InstanceId);
+
 	// Get the level path
 	FString LevelPath = DimensionDef->DimensionLevel.ToSoftObjectPath().ToString();
 	if (LevelPath.IsEmpty())
@@ -58,7 +154,7 @@ bool UDimensionManagerSubsystem::LoadDimensionInstance(FGuid CartridgeId, UDimen
 		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Creating new dimension instance %s"), *InstanceInfo.InstanceId.ToString());
 	}
 	InstanceInfo.CartridgeId = CartridgeId;
-	InstanceInfo.WorldPosition = SpawnPosition;
+	InstanceInfo.WorldPosition = AllocateWorldPosition(InstanceInfo.InstanceId, SpawnPosition);
 	InstanceInfo.DimensionLevel = DimensionDef->DimensionLevel;
 	InstanceInfo.bIsLoaded = false;
 
@@ -66,15 +162,15 @@ bool UDimensionManagerSubsystem::LoadDimensionInstance(FGuid CartridgeId, UDimen
 	FSoftObjectPath SoftPath = DimensionDef->DimensionLevel.ToSoftObjectPath();
 	FString LevelPackageName = SoftPath.GetLongPackageName();
 	
-	// Create a unique level name for this instance
-	FString UniqueLevelName = FString::Printf(TEXT("Dimension_%s"), *InstanceInfo.InstanceId.ToString(EGuidFormats::Short));
+	// Create a unique level name for this load of the instance
+	FString UniqueLevelName = FString::Printf(TEXT("Dimension_%s_%d"), *InstanceInfo.InstanceId.ToString(EGuidFormats::Short), ++LevelInstanceSerial);
 
-	// Load the level at the specified position using ULevelStreamingDynamic
+	// Load the level at the allocated position using ULevelStreamingDynamic
 	bool bLoadSuccess = false;
 	ULevelStreamingDynamic* StreamingLevel = ULevelStreamingDynamic::LoadLevelInstance(
 		World,
 		LevelPackageName,
-		SpawnPosition,
+		InstanceInfo.WorldPosition,
 		FRotator::ZeroRotator,
 		bLoadSuccess,
 		UniqueLevelName
@@ -87,224 +183,476 @@ bool UDimensionManagerSubsystem::LoadDimensionInstance(FGuid CartridgeId, UDimen
 	}
 
 	InstanceInfo.StreamingLevel = StreamingLevel;
-	CurrentInstance = InstanceInfo;
+	ActiveInstanceId = InstanceInfo.InstanceId;
+	Instances.Add(InstanceInfo.InstanceId, InstanceInfo);
+	TouchInstance(InstanceInfo.InstanceId);
 
-	// Set up callback for when level finishes loading
-	StreamingLevel->OnLevelLoaded.AddDynamic(this, &UDimensionManagerSubsystem::OnLevelLoaded);
+	// Restore once the level is visible; actors are not placed at the instance transform before that
+	StreamingLevel->OnLevelShown.AddDynamic(this, &UDimensionManagerSubsystem::OnLevelShown);
 
 	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Loading dimension instance %s at position %s"), 
-		*InstanceInfo.InstanceId.ToString(), *SpawnPosition.ToString());
+		*InstanceInfo.InstanceId.ToString(), *InstanceInfo.WorldPosition.ToString());
 
 	return true;
 }
 
-void UDimensionManagerSubsystem::OnLevelLoaded()
+void UDimensionManagerSubsystem::OnLevelShown()
 {
-	if (!CurrentInstance.IsSet())
-	{
-		return;
-	}
-
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return;
-	}
-
-	ULevelStreaming* StreamingLevel = CurrentInstance->StreamingLevel.Get();
-	if (!StreamingLevel || !StreamingLevel->GetLoadedLevel())
+	// The event carries no level, so pick up every instance that has just become visible
+	TArray<FGuid> ShownInstanceIds;
+	for (TPair<FGuid, FDimensionInstanceInfo>& Pair : Instances)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Level loaded but streaming level or loaded level is null"));
-		return;
+		FDimensionInstanceInfo& Info = Pair.Value;
+		ULevelStreaming* StreamingLevel = Info.StreamingLevel.Get();
+		if (!Info.bIsVisible && !Info.bHibernated && StreamingLevel && StreamingLevel->ShouldBeVisible()
+			&& StreamingLevel->IsLevelVisible() && StreamingLevel->GetLoadedLevel())
+		{
+			Info.bIsVisible = true;
+			ShownInstanceIds.Add(Pair.Key);
+		}
 	}
 
-	ULevel* LoadedLevel = StreamingLevel->GetLoadedLevel();
-	CurrentInstance->bIsLoaded = true;
-
-	// Wait for actors to be fully positioned before restoring state
-	// Streaming levels may position actors after OnLevelLoaded is called
-	FTimerHandle WaitForActorsTimer;
-	World->GetTimerManager().SetTimer(WaitForActorsTimer, [this, World, LoadedLevel]()
+	for (const FGuid& InstanceId : ShownInstanceIds)
 	{
-		if (!CurrentInstance.IsSet())
+		FDimensionInstanceInfo* Info = Instances.Find(InstanceId);
+		if (!Info)
 		{
-			return;
+			continue;
 		}
 
-		// Check if actors are positioned (not all at 0,0,0)
-		bool bActorsPositioned = false;
-		int32 ActorsWithSaveableComponent = 0;
-		int32 ActorsAtOrigin = 0;
-		
-		for (AActor* Actor : LoadedLevel->Actors)
+		// Hibernated before it was streamed out of view; its actors are still suspended
+		if (Info->HibernatedActors.Num() > 0)
 		{
-			if (!Actor)
-			{
-				continue;
-			}
-
-			USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
-			if (SaveableComp)
-			{
-				ActorsWithSaveableComponent++;
-				FVector ActorLocation = Actor->GetActorLocation();
-				if (ActorLocation.IsNearlyZero())
-				{
-					ActorsAtOrigin++;
-				}
-				else
-				{
-					bActorsPositioned = true;
-					UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Actor %s is positioned at %s"), 
-						*Actor->GetName(), *ActorLocation.ToString());
-				}
-			}
+			DimensionHibernation::Resume(Info->HibernatedActors);
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Checking actor positions: %d actors with SaveableComponent, %d at origin, bActorsPositioned=%d"), 
-			ActorsWithSaveableComponent, ActorsAtOrigin, bActorsPositioned ? 1 : 0);
-
-		// If all actors are still at origin, wait another frame
-		if (!bActorsPositioned && ActorsWithSaveableComponent > 0)
+		// Shown means the level has been added to the world with the instance transform applied, so every actor
+		// is already at its final position and restore can start this frame
+		if (!Info->bIsLoaded)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Actors not positioned yet, waiting another frame..."));
-			FTimerHandle RetryTimer;
-			World->GetTimerManager().SetTimer(RetryTimer, [this, World, LoadedLevel]()
-			{
-				OnLevelLoadedDelayed(World, LoadedLevel);
-			}, 0.1f, false);
-			return;
+			Info->bIsLoaded = true;
+			OnDimensionLevelReady(InstanceId, Info->StreamingLevel->GetLoadedLevel());
 		}
 
-		// Actors are positioned, proceed with tagging and loading
-		OnLevelLoadedDelayed(World, LoadedLevel);
-	}, 0.1f, false); // Wait 0.1 seconds for actors to be positioned
-}
+		if (InstanceId == ActiveInstanceId)
+		{
+			OnDimensionLoaded.Broadcast(InstanceId);
+		}
+	}
 
-void UDimensionManagerSubsystem::OnLevelLoadedDelayed(UWorld* World, ULevel* LoadedLevel)
-{
-	if (!CurrentInstance.IsSet())
+	if (ShownInstanceIds.Num() > 0)
 	{
-		return;
+		EnforceInactiveBudget();
 	}
+}
 
+void UDimensionManagerSubsystem::OnDimensionLevelReady(FGuid InstanceId, ULevel* LoadedLevel)
+{
 	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Proceeding with dimension setup for instance %s"), 
-		*CurrentInstance->InstanceId.ToString());
+		*InstanceId.ToString());
 
 	// Tag all actors in the dimension level with dimension ID
-	TagActorsInDimension(LoadedLevel, CurrentInstance->InstanceId);
+	TagActorsInDimension(LoadedLevel, InstanceId);
 
 	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Dimension instance %s loaded successfully"), 
-		*CurrentInstance->InstanceId.ToString());
+		*InstanceId.ToString());
 
 	// Load saved state if it exists (this will restore GUIDs and spawn missing actors)
 	USaveSystemSubsystem* SaveSystem = GetSaveSystemSubsystem();
 	if (SaveSystem)
 	{
-		SaveSystem->LoadDimensionInstance(CurrentInstance->InstanceId);
+		SaveSystem->LoadDimensionInstance(InstanceId);
 	}
+}
 
-	// Broadcast delegate
-	OnDimensionLoaded.Broadcast(CurrentInstance->InstanceId);
+void UDimensionManagerSubsystem::DeactivateDimensionInstance()
+{
+	DeactivateActiveInstance(false);
+	EnforceInactiveBudget();
 }
 
 void UDimensionManagerSubsystem::UnloadDimensionInstance()
 {
-	if (!CurrentInstance.IsSet() || !CurrentInstance->bIsLoaded)
-	{
-		return;
-	}
+	DeactivateActiveInstance(true);
+}
 
-	UWorld* World = GetWorld();
-	if (!World)
+void UDimensionManagerSubsystem::DeactivateActiveInstance(bool bRelease)
+{
+	FDimensionInstanceInfo* Info = Instances.Find(ActiveInstanceId);
+	if (!Info)
 	{
+		ActiveInstanceId = FGuid();
 		return;
 	}
 
+	const FGuid InstanceId = ActiveInstanceId;
+	const bool bWasLoaded = Info->bIsLoaded;
+
 	// Get level reference BEFORE we start unloading (otherwise GetDimensionLevel will return null)
-	ULevel* DimensionLevel = GetDimensionLevel(CurrentInstance->InstanceId);
+	ULevel* DimensionLevel = GetDimensionLevel(InstanceId);
 
-	// Save dimension state before unloading
+	// Capture dimension state before hiding it; nothing in a hidden level changes, so this is also the state it
+	// is evicted with. A level that was never restored has nothing worth saving.
 	USaveSystemSubsystem* SaveSystem = GetSaveSystemSubsystem();
-	if (SaveSystem && CurrentInstance->bIsLoaded && DimensionLevel)
+	if (SaveSystem && bWasLoaded && DimensionLevel)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Saving dimension instance %s before unloading"), 
-			*CurrentInstance->InstanceId.ToString());
-		bool bSaved = SaveSystem->SaveDimensionInstance(CurrentInstance->InstanceId);
+		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Saving dimension instance %s before hiding it"), 
+			*InstanceId.ToString());
+		bool bSaved = SaveSystem->SaveDimensionInstance(InstanceId);
 		if (!bSaved)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Failed to save dimension instance %s before unloading"), 
-				*CurrentInstance->InstanceId.ToString());
+			UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Failed to save dimension instance %s before hiding it"), 
+				*InstanceId.ToString());
 		}
 	}
 	else if (!SaveSystem)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Cannot save dimension: SaveSystem not found"));
 	}
-	else if (!DimensionLevel)
+	else if (bWasLoaded && !DimensionLevel)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] Cannot save dimension: Dimension level not found (may already be unloading)"));
 	}
 
-	// Unload the level
-	ULevelStreaming* StreamingLevel = CurrentInstance->StreamingLevel.Get();
-	if (StreamingLevel)
+	// Hide the level; it stays loaded until released. Only the most recently left instance is hibernated in
+	// place, the one hibernated before it is streamed out of view (its actors stay suspended until shown again).
+	const bool bHibernate = !bRelease && bHibernateLastInstance && bWasLoaded && Info->bIsVisible && DimensionLevel;
+	if (bHibernate)
+	{
+		for (TPair<FGuid, FDimensionInstanceInfo>& Pair : Instances)
+		{
+			if (Pair.Value.bHibernated)
+			{
+				Pair.Value.bHibernated = false;
+				if (ULevelStreaming* HibernatedLevel = Pair.Value.StreamingLevel.Get())
+				{
+					HibernatedLevel->SetShouldBeVisible(false);
+				}
+			}
+		}
+
+		DimensionHibernation::Hibernate(DimensionLevel, Info->HibernatedActors);
+		Info->bHibernated = true;
+	}
+	else if (ULevelStreaming* StreamingLevel = Info->StreamingLevel.Get())
 	{
-		StreamingLevel->SetShouldBeLoaded(false);
 		StreamingLevel->SetShouldBeVisible(false);
-		StreamingLevel->SetIsRequestingUnloadAndRemoval(true);
 	}
+	Info->bIsVisible = false;
+	ActiveInstanceId = FGuid();
 
-	FGuid InstanceId = CurrentInstance->InstanceId;
-	CurrentInstance.Reset();
-
-	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Unloaded dimension instance %s"), *InstanceId.ToString());
-
-	// Clear LoadedDimensionInstanceId in save data when dimension is unloaded
-	// This ensures normal cartridge insertion works correctly after unloading
-	// (SaveSystem was already retrieved above, reuse it)
+	// Clear LoadedDimensionInstanceId in save data when dimension is deactivated
+	// This ensures normal cartridge insertion works correctly afterwards
 	if (SaveSystem && SaveSystem->GetCurrentSaveData())
 	{
 		UGameSaveData* SaveData = SaveSystem->GetCurrentSaveData();
 		if (SaveData && SaveData->LoadedDimensionInstanceId == InstanceId)
 		{
 			SaveData->LoadedDimensionInstanceId = FGuid();
-			UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Cleared LoadedDimensionInstanceId in save data after unloading dimension %s"), *InstanceId.ToString());
+			UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Cleared LoadedDimensionInstanceId in save data after deactivating dimension %s"), *InstanceId.ToString());
 		}
 	}
 
-	// Broadcast delegate
+	// Broadcast delegate (listeners still see the instance through GetInstanceInfo/GetDimensionLevel here)
 	OnDimensionUnloaded.Broadcast(InstanceId);
+
+	if (bRelease)
+	{
+		ReleaseInstance(InstanceId);
+	}
+	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] %s dimension instance %s"),
+		bRelease ? TEXT("Unloaded") : (bHibernate ? TEXT("Hibernated") : TEXT("Hid")), *InstanceId.ToString());
+}
+
+void UDimensionManagerSubsystem::ReleaseInactiveInstances()
+{
+	TArray<FGuid> InactiveIds;
+	for (const FGuid& InstanceId : RecentInstances)
+	{
+		if (InstanceId != ActiveInstanceId)
+		{
+			InactiveIds.Add(InstanceId);
+		}
+	}
+
+	for (const FGuid& InstanceId : InactiveIds)
+	{
+		ReleaseInstance(InstanceId);
+	}
+}
+
+void UDimensionManagerSubsystem::ReleaseInstance(FGuid InstanceId)
+{
+	FDimensionInstanceInfo Info;
+	if (!Instances.RemoveAndCopyValue(InstanceId, Info))
+	{
+		return;
+	}
+	RecentInstances.Remove(InstanceId);
+	if (ActiveInstanceId == InstanceId)
+	{
+		ActiveInstanceId = FGuid();
+	}
+
+	ULevelStreaming* StreamingLevel = Info.StreamingLevel.Get();
+	if (!StreamingLevel)
+	{
+		OnDimensionReleased.Broadcast(InstanceId);
+		return;
+	}
+	StreamingLevel->OnLevelShown.RemoveAll(this);
+
+	// Its state was captured when it was hidden. Take it out of play in one step (no collision, physics or
+	// tick), then destroy its actors a batch per frame so a dense dimension never costs one long frame.
+	FDimensionTeardown& Teardown = Teardowns.AddDefaulted_GetRef();
+	Teardown.InstanceId = InstanceId;
+	Teardown.StreamingLevel = StreamingLevel;
+
+	if (ULevel* Level = StreamingLevel->GetLoadedLevel())
+	{
+		if (!Info.bHibernated && StreamingLevel->IsLevelVisible())
+		{
+			TArray<FHibernatedActorState> Discarded;
+			DimensionHibernation::Hibernate(Level, Discarded);
+		}
+
+		for (AActor* Actor : Level->Actors)
+		{
+			// The level's own infrastructure goes with the package
+			if (IsValid(Actor) && !Actor->IsA<AWorldSettings>() && !Actor->IsA<ALevelScriptActor>()
+				&& Actor != Level->GetDefaultBrush())
+			{
+				Teardown.Actors.Add(Actor);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Releasing dimension instance %s (%d actors to tear down)"),
+		*InstanceId.ToString(), Teardown.Actors.Num());
+
+	UWorld* World = GetWorld();
+	if (World && !TeardownTickHandle.IsValid())
+	{
+		TeardownTickHandle = World->GetTimerManager().SetTimerForNextTick(this, &UDimensionManagerSubsystem::TickTeardown);
+	}
+}
+
+void UDimensionManagerSubsystem::TickTeardown()
+{
+	TeardownTickHandle.Invalidate();
+
+	const double EndTime = FPlatformTime::Seconds() + TeardownFrameBudgetMs / 1000.0;
+	while (Teardowns.Num() > 0 && AdvanceTeardown(Teardowns[0], EndTime))
+	{
+		Teardowns.RemoveAt(0);
+	}
+
+	if (Teardowns.Num() == 0)
+	{
+		return;
+	}
+
+	// Keep a collection from landing on top of a teardown frame; the destroyed actors are purged afterwards
+	if (GEngine)
+	{
+		GEngine->DelayGarbageCollection();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		TeardownTickHandle = World->GetTimerManager().SetTimerForNextTick(this, &UDimensionManagerSubsystem::TickTeardown);
+	}
+}
+
+bool UDimensionManagerSubsystem::AdvanceTeardown(FDimensionTeardown& Teardown, double EndTime)
+{
+	while (Teardown.NextActor < Teardown.Actors.Num())
+	{
+		if (AActor* Actor = Teardown.Actors[Teardown.NextActor++].Get())
+		{
+			Actor->Destroy();
+		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			return false;
+		}
+	}
+
+	if (ULevelStreaming* StreamingLevel = Teardown.StreamingLevel.Get())
+	{
+		StreamingLevel->SetShouldBeLoaded(false);
+		StreamingLevel->SetShouldBeVisible(false);
+		StreamingLevel->SetIsRequestingUnloadAndRemoval(true);
+	}
+
+	// Ask for a regular (non-full) collection at the next opportunity; the purge of the level runs incrementally
+	if (GEngine)
+	{
+		GEngine->ForceGarbageCollection(false);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Released dimension instance %s"), *Teardown.InstanceId.ToString());
+	OnDimensionReleased.Broadcast(Teardown.InstanceId);
+	return true;
+}
+
+void UDimensionManagerSubsystem::FlushTeardown(FGuid InstanceId)
+{
+	const int32 Index = Teardowns.IndexOfByPredicate([InstanceId](const FDimensionTeardown& Teardown)
+	{
+		return Teardown.InstanceId == InstanceId;
+	});
+
+	if (InstanceId.IsValid() && Index != INDEX_NONE)
+	{
+		FDimensionTeardown Teardown = MoveTemp(Teardowns[Index]);
+		Teardowns.RemoveAt(Index);
+		AdvanceTeardown(Teardown, TNumericLimits<double>::Max());
+	}
+}
+
+void UDimensionManagerSubsystem::EnforceInactiveBudget()
+{
+	const uint64 UsedMB = InactiveMemoryBudgetMB > 0 ? FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024) : 0;
+	const bool bOverMemoryBudget = InactiveMemoryBudgetMB > 0 && UsedMB > static_cast<uint64>(InactiveMemoryBudgetMB);
+
+	for (const FGuid& Evicted : SelectEvictions(RecentInstances, ActiveInstanceId, MaxInactiveInstances, bOverMemoryBudget))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Evicting dimension instance %s (budget %d hidden instances, %llu MB used of %d MB)"),
+			*Evicted.ToString(), MaxInactiveInstances, UsedMB, InactiveMemoryBudgetMB);
+		ReleaseInstance(Evicted);
+	}
+}
+
+TArray<FGuid> UDimensionManagerSubsystem::SelectEvictions(const TArray<FGuid>& RecentInstances, const FGuid& ActiveInstanceId, int32 MaxInactive, bool bOverMemoryBudget)
+{
+	TArray<FGuid> Inactive;
+	for (const FGuid& InstanceId : RecentInstances)
+	{
+		if (InstanceId != ActiveInstanceId)
+		{
+			Inactive.Add(InstanceId);
+		}
+	}
+
+	int32 Count = FMath::Max(0, Inactive.Num() - FMath::Max(0, MaxInactive));
+
+	// Memory only drops once the released level has been collected, so release at most one more per check
+	if (bOverMemoryBudget && Count < Inactive.Num())
+	{
+		++Count;
+	}
+
+	Inactive.SetNum(Count);
+	return Inactive;
+}
+
+void UDimensionManagerSubsystem::TouchInstance(FGuid InstanceId)
+{
+	RecentInstances.Remove(InstanceId);
+	RecentInstances.Add(InstanceId);
+}
+
+FVector UDimensionManagerSubsystem::AllocateWorldPosition(FGuid InstanceId, const FVector& BasePosition) const
+{
+	TArray<FVector> TakenPositions;
+	for (const TPair<FGuid, FDimensionInstanceInfo>& Pair : Instances)
+	{
+		TakenPositions.Add(Pair.Value.WorldPosition);
+	}
+
+	// Reuse the position the instance was saved at, so saved world-space locations inside it (e.g. the player's)
+	// still line up
+	FVector SavedPosition = FVector::ZeroVector;
+	USaveSystemSubsystem* SaveSystem = GetSaveSystemSubsystem();
+	if (SaveSystem && SaveSystem->GetCurrentSaveData() && InstanceId.IsValid())
+	{
+		for (const FDimensionInstanceSaveData& DimData : SaveSystem->GetCurrentSaveData()->DimensionInstances)
+		{
+			if (DimData.InstanceId == InstanceId)
+			{
+				SavedPosition = DimData.WorldPosition;
+				break;
+			}
+		}
+	}
+
+	return FindFreeWorldPosition(TakenPositions, SavedPosition, BasePosition, InstanceSpacing);
+}
+
+FVector UDimensionManagerSubsystem::FindFreeWorldPosition(const TArray<FVector>& TakenPositions, const FVector& SavedPosition, const FVector& BasePosition, const FVector& Spacing)
+{
+	auto IsTaken = [&TakenPositions](const FVector& Position)
+	{
+		return TakenPositions.ContainsByPredicate([&Position](const FVector& Taken) { return Taken.Equals(Position, 1.0); });
+	};
+
+	if (!SavedPosition.IsNearlyZero() && !IsTaken(SavedPosition))
+	{
+		return SavedPosition;
+	}
+
+	for (int32 Slot = 0; ; ++Slot)
+	{
+		const FVector Position = BasePosition + Spacing * Slot;
+		if (!IsTaken(Position))
+		{
+			return Position;
+		}
+	}
+}
+
+void UDimensionManagerSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (Instances.Num() > 0 && World == GetWorld())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[DimensionManager] World cleanup - forgetting %d dimension instances"), Instances.Num());
+		Instances.Reset();
+		RecentInstances.Reset();
+		ActiveInstanceId = FGuid();
+	}
+
+	// The world's actors and levels go with it
+	if (Teardowns.Num() > 0 && World == GetWorld())
+	{
+		Teardowns.Reset();
+		World->GetTimerManager().ClearTimer(TeardownTickHandle);
+	}
 }
 
 ULevelStreaming* UDimensionManagerSubsystem::GetStreamingLevel() const
 {
-	if (CurrentInstance.IsSet() && CurrentInstance->bIsLoaded)
+	const FDimensionInstanceInfo* Info = Instances.Find(ActiveInstanceId);
+	if (Info && Info->bIsLoaded)
 	{
-		return CurrentInstance->StreamingLevel.Get();
+		return Info->StreamingLevel.Get();
 	}
 	return nullptr;
 }
 
 bool UDimensionManagerSubsystem::IsDimensionLoaded() const
 {
-	return CurrentInstance.IsSet() && CurrentInstance->bIsLoaded;
+	const FDimensionInstanceInfo* Info = Instances.Find(ActiveInstanceId);
+	return Info && Info->bIsLoaded && Info->bIsVisible;
+}
+
+bool UDimensionManagerSubsystem::IsDimensionInstanceResident(FGuid InstanceId) const
+{
+	const FDimensionInstanceInfo* Info = Instances.Find(InstanceId);
+	return Info && Info->bIsLoaded;
 }
 
 FGuid UDimensionManagerSubsystem::GetCurrentInstanceId() const
 {
-	if (CurrentInstance.IsSet())
-	{
-		return CurrentInstance->InstanceId;
-	}
-	return FGuid();
+	return ActiveInstanceId;
 }
 
 ULevel* UDimensionManagerSubsystem::GetDimensionLevel(FGuid InstanceId) const
 {
-	if (CurrentInstance.IsSet() && CurrentInstance->InstanceId == InstanceId)
+	if (const FDimensionInstanceInfo* Info = Instances.Find(InstanceId))
 	{
-		ULevelStreaming* StreamingLevel = CurrentInstance->StreamingLevel.Get();
+		ULevelStreaming* StreamingLevel = Info->StreamingLevel.Get();
 		if (StreamingLevel)
 		{
 			return StreamingLevel->GetLoadedLevel();
@@ -326,8 +674,7 @@ void UDimensionManagerSubsystem::TagActorsInDimension(ULevel* DimensionLevel, FG
 		return;
 	}
 
-	// Check if there's save data for this dimension instance
-	// If there is, we should NOT assign new GUIDs - let the save system restore them
+	// Check if there's save data for this dimension instance (only reported; IDs are the same either way)
 	bool bHasSaveData = false;
 	USaveSystemSubsystem* SaveSystem = GetSaveSystemSubsystem();
 	if (SaveSystem && SaveSystem->CurrentSaveData)
@@ -354,13 +701,12 @@ void UDimensionManagerSubsystem::TagActorsInDimension(ULevel* DimensionLevel, FG
 		USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
 		if (SaveableComp)
 		{
-			// Only assign a new GUID if:
-			// 1. The actor doesn't have one, AND
-			// 2. There's no save data for this dimension (first time loading)
-			// If there's save data, the save system will restore the GUIDs
-			if (!SaveableComp->GetPersistentId().IsValid() && !bHasSaveData)
+			// Derive the ID from the instance and the actor's path in the source level, so every load of this
+			// instance produces the IDs its saved records were written with
+			const FGuid LevelActorId = USaveableActorComponent::MakeLevelActorId(Actor, InstanceId);
+			if (SaveableComp->GetPersistentId() != LevelActorId)
 			{
-				SaveableComp->SetPersistentId(FGuid::NewGuid());
+				SaveableComp->SetPersistentId(LevelActorId);
 				GUIDAssignedCount++;
 			}
 			
@@ -377,9 +723,9 @@ void UDimensionManagerSubsystem::TagActorsInDimension(ULevel* DimensionLevel, FG
 				UE_LOG(LogTemp, Log, TEXT("[DimensionManager] TagActorsInDimension: Setting OriginalTransform for %s - world pos: %s"), 
 					*Actor->GetName(), *WorldLocation.ToString());
 				
-				if (CurrentInstance.IsSet())
+				if (const FDimensionInstanceInfo* InstanceInfo = Instances.Find(InstanceId))
 				{
-					FVector DimensionWorldPos = CurrentInstance->WorldPosition;
+					FVector DimensionWorldPos = InstanceInfo->WorldPosition;
 					FTransform LocalTransform = WorldTransform;
 					FVector LocalLocation = WorldLocation - DimensionWorldPos;
 					LocalTransform.SetLocation(LocalLocation);
@@ -391,7 +737,7 @@ void UDimensionManagerSubsystem::TagActorsInDimension(ULevel* DimensionLevel, FG
 				{
 					// Fallback to world transform if we don't have instance info yet
 					SaveableComp->OriginalTransform = WorldTransform;
-					UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] TagActorsInDimension: CurrentInstance not set, using world transform for %s"), 
+					UE_LOG(LogTemp, Warning, TEXT("[DimensionManager] TagActorsInDimension: Instance not loaded, using world transform for %s"), 
 						*Actor->GetName());
 				}
 			}
@@ -406,15 +752,20 @@ void UDimensionManagerSubsystem::TagActorsInDimension(ULevel* DimensionLevel, FG
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Tagged %d actors in dimension instance %s (%d new GUIDs assigned, hasSaveData=%d)"), 
+	UE_LOG(LogTemp, Log, TEXT("[DimensionManager] Tagged %d actors in dimension instance %s (%d IDs derived, hasSaveData=%d)"), 
 		TaggedCount, *InstanceId.ToString(), GUIDAssignedCount, bHasSaveData ? 1 : 0);
 }
 
 FDimensionInstanceInfo UDimensionManagerSubsystem::GetCurrentInstanceInfo() const
 {
-	if (CurrentInstance.IsSet())
+	return GetInstanceInfo(ActiveInstanceId);
+}
+
+FDimensionInstanceInfo UDimensionManagerSubsystem::GetInstanceInfo(FGuid InstanceId) const
+{
+	if (const FDimensionInstanceInfo* Info = Instances.Find(InstanceId))
 	{
-		return CurrentInstance.GetValue();
+		return *Info;
 	}
 	return FDimensionInstanceInfo();
 }
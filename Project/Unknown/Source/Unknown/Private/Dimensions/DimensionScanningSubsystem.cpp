@@ -10,19 +10,70 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Modules/ModuleManager.h"
+#include "Save/SaveSystemSubsystem.h"
+#include "Save/GameSaveData.h"
+
+namespace
+{
+	// Read the scan fields straight off a loaded definition (assets saved before they became registry tags)
+	FDimensionCatalogueEntry MakeEntryFromDefinition(UDimensionDefinition* DimensionDef)
+	{
+		FDimensionCatalogueEntry Entry;
+		Entry.Definition = DimensionDef;
+		Entry.Guid = DimensionDef->Guid;
+		Entry.Type = DimensionDef->Type;
+		Entry.RarityWeight = DimensionDef->RarityWeight;
+		Entry.RequiredTags = DimensionDef->RequiredTags;
+		Entry.DimensionTags = DimensionDef->DimensionTags;
+		return Entry;
+	}
+}
 
 void UDimensionScanningSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
-	AvailableDimensions.Empty();
+	Catalogue.Empty();
+	UnsavedStream.GenerateNewSeed();
 	
-	// Load dimension definitions on initialization
-	LoadDimensionDefinitions();
+	// Catalogue dimension definitions on initialization
+	BuildDimensionCatalogue();
+}
+
+bool UDimensionScanningSubsystem::MakeCatalogueEntry(const FAssetData& AssetData, FDimensionCatalogueEntry& OutEntry)
+{
+	FString GuidValue;
+	FString TypeValue;
+	FString WeightValue;
+	FString RequiredTagsValue;
+	FString DimensionTagsValue;
+	if (!AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UDimensionDefinition, Guid), GuidValue)
+		|| !AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UDimensionDefinition, Type), TypeValue)
+		|| !AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UDimensionDefinition, RarityWeight), WeightValue)
+		|| !AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UDimensionDefinition, RequiredTags), RequiredTagsValue)
+		|| !AssetData.GetTagValue(GET_MEMBER_NAME_CHECKED(UDimensionDefinition, DimensionTags), DimensionTagsValue))
+	{
+		return false;
+	}
+
+	FDimensionCatalogueEntry Entry;
+	Entry.Definition = TSoftObjectPtr<UDimensionDefinition>(AssetData.GetSoftObjectPath());
+
+	const int64 TypeIndex = StaticEnum<EDimensionType>()->GetValueByNameString(TypeValue);
+	if (!FGuid::Parse(GuidValue, Entry.Guid) || TypeIndex == INDEX_NONE)
+	{
+		return false;
+	}
+	Entry.Type = static_cast<EDimensionType>(TypeIndex);
+	LexFromString(Entry.RarityWeight, *WeightValue);
+	Entry.RequiredTags = FGameplayTagContainer::FromExportString(RequiredTagsValue);
+	Entry.DimensionTags = FGameplayTagContainer::FromExportString(DimensionTagsValue);
+
+	OutEntry = MoveTemp(Entry);
+	return true;
 }
 
-void UDimensionScanningSubsystem::LoadDimensionDefinitions()
+void UDimensionScanningSubsystem::BuildDimensionCatalogue()
 {
-	AvailableDimensions.Empty();
 
 	// Use asset registry to find all dimension definition assets
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -36,144 +87,240 @@ void UDimensionScanningSubsystem::LoadDimensionDefinitions()
 	
 	AssetRegistry.GetAssets(Filter, AssetDataList);
 
-	// Load all found dimension definitions
+	// Catalogue from registry tags; only definitions saved before the tags existed have to be loaded
+	TArray<FDimensionCatalogueEntry> Entries;
+	int32 LoadedCount = 0;
 	for (const FAssetData& AssetData : AssetDataList)
 	{
-		if (UDimensionDefinition* DimensionDef = Cast<UDimensionDefinition>(AssetData.GetAsset()))
+		FDimensionCatalogueEntry Entry;
+		if (MakeCatalogueEntry(AssetData, Entry))
 		{
-			AvailableDimensions.Add(DimensionDef);
+			Entries.Add(MoveTemp(Entry));
+		}
+		else if (UDimensionDefinition* DimensionDef = Cast<UDimensionDefinition>(AssetData.GetAsset()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[DimensionScanning] %s has no catalogue tags; resave it to avoid loading it at startup"),
+				*AssetData.GetObjectPathString());
+			Entries.Add(MakeEntryFromDefinition(DimensionDef));
+			++LoadedCount;
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[DimensionScanning] Loaded %d dimension definitions"), AvailableDimensions.Num());
+	SetCatalogue(MoveTemp(Entries));
+
+	UE_LOG(LogTemp, Log, TEXT("[DimensionScanning] Catalogued %d dimension definitions (%d loaded), %d required tags"),
+		Catalogue.Num(), LoadedCount, RequirementTags.Num());
 }
 
-TArray<UDimensionDefinition*> UDimensionScanningSubsystem::GetAvailableDimensions() const
+void UDimensionScanningSubsystem::SetCatalogue(TArray<FDimensionCatalogueEntry> Entries)
 {
-	TArray<UDimensionDefinition*> Result;
-	for (const TObjectPtr<UDimensionDefinition>& Def : AvailableDimensions)
-	{
-		if (Def)
-		{
-			Result.Add(Def);
-		}
-	}
-	return Result;
+	Catalogue = MoveTemp(Entries);
+	CompileRequirements();
+	bEligibleDirty = true;
 }
 
-TArray<UDimensionDefinition*> UDimensionScanningSubsystem::GetEligibleDimensions() const
+TArray<FDimensionCatalogueEntry> UDimensionScanningSubsystem::GetAvailableDimensions() const
 {
-	TArray<UDimensionDefinition*> Eligible;
-	
-	for (const TObjectPtr<UDimensionDefinition>& Def : AvailableDimensions)
-	{
-		if (!Def)
-		{
-			continue;
-		}
-
-		if (CheckPlayerRequirements(Def))
-		{
-			Eligible.Add(Def);
-		}
-	}
+	return Catalogue;
+}
 
-	return Eligible;
+TArray<FDimensionCatalogueEntry> UDimensionScanningSubsystem::GetEligibleDimensions()
+{
+	return GetEligibleDimensionsFor(GetLocalPlayerPawn());
 }
 
-bool UDimensionScanningSubsystem::CheckPlayerRequirements(UDimensionDefinition* DimensionDef) const
+TArray<FDimensionCatalogueEntry> UDimensionScanningSubsystem::GetEligibleDimensionsFor(APawn* PlayerPawn)
 {
-	if (!DimensionDef)
+	RefreshEligibleDimensions(PlayerPawn);
+
+	TArray<FDimensionCatalogueEntry> Eligible;
+	Eligible.Reserve(EligibleIndices.Num());
+	for (TConstSetBitIterator<> It(EligibleMask); It; ++It)
 	{
-		return false;
+		Eligible.Add(Catalogue[It.GetIndex()]);
 	}
+	return Eligible;
+}
 
+bool UDimensionScanningSubsystem::CheckPlayerRequirements(const FDimensionCatalogueEntry& Entry) const
+{
 	// If no requirements, dimension is always eligible
-	if (DimensionDef->RequiredTags.IsEmpty())
+	if (Entry.RequiredTags.IsEmpty())
 	{
 		return true;
 	}
 
 	// Get player character to check tags
 	UWorld* World = GetWorld();
-	if (!World)
+	const AFirstPersonCharacter* Player = World ? Cast<AFirstPersonCharacter>(UGameplayStatics::GetPlayerPawn(World, 0)) : nullptr;
+	return Player && Player->GetPlayerTags().HasAll(Entry.RequiredTags);
+}
+
+void UDimensionScanningSubsystem::CompileRequirements()
+{
+	RequirementTags.Reset();
+	TMap<FGameplayTag, int32> TagIndices;
+	for (const FDimensionCatalogueEntry& Entry : Catalogue)
 	{
-		return false;
+		for (const FGameplayTag& Tag : Entry.RequiredTags)
+		{
+			if (!TagIndices.Contains(Tag))
+			{
+				TagIndices.Add(Tag, RequirementTags.Add(Tag));
+			}
+		}
 	}
 
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
-	if (!PlayerPawn)
+	RequirementWords = FMath::DivideAndRoundUp(RequirementTags.Num(), 64);
+	RequirementMasks.Reset();
+	RequirementMasks.SetNumZeroed(Catalogue.Num() * RequirementWords);
+	for (int32 EntryIndex = 0; EntryIndex < Catalogue.Num(); ++EntryIndex)
 	{
-		return false;
+		uint64* Mask = RequirementMasks.GetData() + EntryIndex * RequirementWords;
+		for (const FGameplayTag& Tag : Catalogue[EntryIndex].RequiredTags)
+		{
+			const int32 Bit = TagIndices[Tag];
+			Mask[Bit / 64] |= uint64(1) << (Bit % 64);
+		}
 	}
-
-	// Check if player has the required tags
-	// This is a simplified check - you may need to extend this based on your tag system
-	// For now, we'll assume the player character or a component has a way to check tags
-	// You may need to add a component or interface to check player tags
-	
-	// TODO: Implement actual tag checking based on your player tag system
-	// For now, return true if no requirements (placeholder)
-	return true;
 }
 
-UDimensionDefinition* UDimensionScanningSubsystem::ScanForDimension()
+void UDimensionScanningSubsystem::HandlePlayerTagsChanged()
 {
-	// Get eligible dimensions
-	TArray<UDimensionDefinition*> EligibleDimensions = GetEligibleDimensions();
+	bEligibleDirty = true;
+}
 
-	if (EligibleDimensions.Num() == 0)
+void UDimensionScanningSubsystem::ScanForDimension(FOnDimensionScanned OnScanned)
+{
+	// Perform weighted random selection
+	const FDimensionCatalogueEntry* Selected = SelectDimensionByWeight();
+	if (!Selected)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DimensionScanning] No eligible dimensions found"));
-		return nullptr;
+		OnScanned.ExecuteIfBound(nullptr);
+		return;
 	}
 
-	// Perform weighted random selection
-	return SelectDimensionByWeight(EligibleDimensions);
+	const TSoftObjectPtr<UDimensionDefinition> Definition = Selected->Definition;
+	if (UDimensionDefinition* DimensionDef = Definition.Get())
+	{
+		OnScanned.ExecuteIfBound(DimensionDef);
+		return;
+	}
+
+	// Only the scanned definition is ever loaded
+	UAssetManager::GetStreamableManager().RequestAsyncLoad(Definition.ToSoftObjectPath(),
+		FStreamableDelegate::CreateLambda([Definition, OnScanned]()
+		{
+			UDimensionDefinition* DimensionDef = Definition.Get();
+			if (!DimensionDef)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[DimensionScanning] Failed to load dimension definition %s"), *Definition.ToString());
+			}
+			OnScanned.ExecuteIfBound(DimensionDef);
+		}));
 }
 
-UDimensionDefinition* UDimensionScanningSubsystem::SelectDimensionByWeight(const TArray<UDimensionDefinition*>& EligibleDimensions) const
+APawn* UDimensionScanningSubsystem::GetLocalPlayerPawn() const
 {
-	if (EligibleDimensions.Num() == 0)
+	UWorld* World = GetWorld();
+	return World ? UGameplayStatics::GetPlayerPawn(World, 0) : nullptr;
+}
+
+void UDimensionScanningSubsystem::RefreshEligibleDimensions(APawn* PlayerPawn)
+{
+	if (!bEligibleDirty && EligiblePawn.Get() == PlayerPawn)
 	{
-		return nullptr;
+		return;
 	}
 
-	// Calculate total weight
-	float TotalWeight = 0.0f;
-	for (UDimensionDefinition* Def : EligibleDimensions)
+	// Follow the player's tag changes instead of re-checking them every scan
+	AFirstPersonCharacter* Player = Cast<AFirstPersonCharacter>(PlayerPawn);
+	if (EligiblePawn.Get() != PlayerPawn)
 	{
-		if (Def)
+		if (AFirstPersonCharacter* PreviousPlayer = Cast<AFirstPersonCharacter>(EligiblePawn.Get()))
 		{
-			TotalWeight += FMath::Max(0.0f, Def->RarityWeight);
+			PreviousPlayer->OnPlayerTagsChanged.RemoveDynamic(this, &UDimensionScanningSubsystem::HandlePlayerTagsChanged);
+		}
+		if (Player)
+		{
+			Player->OnPlayerTagsChanged.AddUniqueDynamic(this, &UDimensionScanningSubsystem::HandlePlayerTagsChanged);
 		}
 	}
 
-	if (TotalWeight <= 0.0f)
+	// Player tags as bits over the same index; a child tag satisfies a required parent, as in HasAll
+	TArray<uint64, TInlineAllocator<4>> PlayerMask;
+	PlayerMask.SetNumZeroed(RequirementWords);
+	if (Player)
 	{
-		// If all weights are zero or negative, return first dimension
-		return EligibleDimensions[0];
+		for (int32 Bit = 0; Bit < RequirementTags.Num(); ++Bit)
+		{
+			if (Player->GetPlayerTags().HasTag(RequirementTags[Bit]))
+			{
+				PlayerMask[Bit / 64] |= uint64(1) << (Bit % 64);
+			}
+		}
 	}
 
-	// Generate random value
-	float RandomValue = FMath::RandRange(0.0f, TotalWeight);
-
-	// Select dimension based on weight
-	float CurrentWeight = 0.0f;
-	for (UDimensionDefinition* Def : EligibleDimensions)
+	EligibleMask.Init(false, Catalogue.Num());
+	EligibleIndices.Reset();
+	TArray<float> Weights;
+	for (int32 Index = 0; Index < Catalogue.Num(); ++Index)
 	{
-		if (!Def)
+		const uint64* Required = RequirementMasks.GetData() + Index * RequirementWords;
+		bool bEligible = true;
+		for (int32 Word = 0; Word < RequirementWords && bEligible; ++Word)
 		{
-			continue;
+			bEligible = (Required[Word] & ~PlayerMask[Word]) == 0;
 		}
 
-		CurrentWeight += FMath::Max(0.0f, Def->RarityWeight);
-		if (RandomValue <= CurrentWeight)
+		if (bEligible)
 		{
-			return Def;
+			EligibleMask[Index] = true;
+			EligibleIndices.Add(Index);
+			Weights.Add(Catalogue[Index].RarityWeight);
 		}
 	}
 
-	// Fallback to last dimension (shouldn't happen)
-	return EligibleDimensions.Last();
+	EligibleTable.Build(Weights);
+	EligiblePawn = PlayerPawn;
+	bEligibleDirty = false;
+}
+
+const FDimensionCatalogueEntry* UDimensionScanningSubsystem::SelectDimensionByWeight()
+{
+	RefreshEligibleDimensions(GetLocalPlayerPawn());
+
+	if (EligibleIndices.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	if (EligibleTable.IsEmpty())
+	{
+		// If all weights are zero or negative, return first dimension
+		return &Catalogue[EligibleIndices[0]];
+	}
+
+	// Draw from the running save's stream and store its new state back, so reloading a save replays its scans
+	int32 Picked = INDEX_NONE;
+	USaveSystemSubsystem* SaveSystem = GetGameInstance()->GetSubsystem<USaveSystemSubsystem>();
+	if (UGameSaveData* SaveData = SaveSystem ? SaveSystem->GetCurrentSaveData() : nullptr)
+	{
+		// Saves from before the seed was stored load with 0; give each its own stream once rather than all sharing one
+		if (SaveData->DimensionScanSeed == 0)
+		{
+			SaveData->DimensionScanSeed = FMath::RandRange(1, MAX_int32);
+		}
+
+		FRandomStream Stream(SaveData->DimensionScanSeed);
+		Picked = EligibleTable.Sample(Stream);
+		SaveData->DimensionScanSeed = Stream.GetCurrentSeed();
+	}
+	else
+	{
+		Picked = EligibleTable.Sample(UnsavedStream);
+	}
+
+	return &Catalogue[EligibleIndices[Picked]];
 }
@@ -7,6 +7,7 @@
 #include "Inventory/ItemTypes.h"
 #include "Components/SaveableActorComponent.h"
 #include "Player/FirstPersonCharacter.h"
+#include "Components/PhysicsInteractionComponent.h"
 #include "Save/SaveSystemSubsystem.h"
 #include "Save/GameSaveData.h"
 #include "GameFramework/PlayerController.h"
@@ -38,6 +39,16 @@ APortalDevice::APortalDevice(const FObjectInitializer& ObjectInitializer)
 	PortalTriggerBox->SetCollisionResponseToAllChannels(ECR_Ignore);
 	PortalTriggerBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 	PortalTriggerBox->SetGenerateOverlapEvents(true);
+
+	// Create prefetch sphere (radius is applied in BeginPlay from PrefetchRadius)
+	PrefetchSphere = CreateDefaultSubobject<USphereComponent>(TEXT("PrefetchSphere"));
+	PrefetchSphere->SetupAttachment(PortalTriggerBox);
+	PrefetchSphere->SetSphereRadius(PrefetchRadius);
+	PrefetchSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	PrefetchSphere->SetCollisionObjectType(ECC_WorldDynamic);
+	PrefetchSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+	PrefetchSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	PrefetchSphere->SetGenerateOverlapEvents(true);
 }
 
 void APortalDevice::BeginPlay()
@@ -57,6 +68,20 @@ void APortalDevice::BeginPlay()
 		PortalTriggerBox->OnComponentBeginOverlap.AddDynamic(this, &APortalDevice::OnPortalBeginOverlap);
 	}
 
+	// Bind to prefetch sphere
+	if (PrefetchSphere)
+	{
+		if (PrefetchRadius > 0.0f)
+		{
+			PrefetchSphere->SetSphereRadius(PrefetchRadius);
+			PrefetchSphere->OnComponentBeginOverlap.AddDynamic(this, &APortalDevice::OnPrefetchBeginOverlap);
+		}
+		else
+		{
+			PrefetchSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+	}
+
 	// Bind to dimension manager delegates
 	if (UDimensionManagerSubsystem* DimensionManager = GetDimensionManager())
 	{
@@ -72,8 +97,11 @@ void APortalDevice::OnCartridgeInserted(AItemPickup* Cartridge)
 		return;
 	}
 
+	// Get the level and saved state loading now, even if opening is deferred to save restoration below
+	PrefetchCartridge(Cartridge);
+
 	// Guard against auto-loading during save restoration
-	// Only defer if: 1) We're loading a save (temp save exists), 2) Dimension is NOT currently loaded, 3) Cartridge matches saved loaded dimension
+	// Only defer if: 1) We're loading a save (restore handoff pending), 2) Dimension is NOT currently loaded, 3) Cartridge matches saved loaded dimension
 	UWorld* World = GetWorld();
 	if (World)
 	{
@@ -86,9 +114,8 @@ void APortalDevice::OnCartridgeInserted(AItemPickup* Cartridge)
 			// Only defer if dimension is NOT currently loaded (if it's loaded, we're not in save restoration)
 			if (SaveSystem && SaveSystem->GetCurrentSaveData() && DimensionManager && !DimensionManager->IsDimensionLoaded())
 			{
-				// Check if we're loading from a temp save (indicates save restoration in progress)
-				FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-				if (UGameSaveData* TempSave = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(TempSlotName, 0)))
+				// A pending restore handoff indicates save restoration is in progress
+				if (SaveSystem->HasPendingRestore())
 				{
 					// We're in the middle of save restoration - check if this cartridge matches saved loaded dimension
 					UGameSaveData* SaveData = SaveSystem->GetCurrentSaveData();
@@ -168,10 +195,10 @@ void APortalDevice::OpenPortal(FGuid CartridgeId)
 		return;
 	}
 
-	// If a dimension is already loaded, unload it first (this will save it)
+	// If a dimension is already loaded, hide it first (this will save it; it stays resident for a quick return)
 	if (DimensionManager->IsDimensionLoaded())
 	{
-		DimensionManager->UnloadDimensionInstance();
+		DimensionManager->DeactivateDimensionInstance();
 		CurrentInstanceId = FGuid();
 	}
 
@@ -225,7 +252,7 @@ void APortalDevice::OpenPortal(FGuid CartridgeId)
 		{
 			CartridgeData->InstanceData->InstanceId = CurrentInstanceId;
 			CartridgeData->InstanceData->CartridgeId = CartridgeId;
-			CartridgeData->InstanceData->WorldPosition = SpawnPosition;
+			CartridgeData->InstanceData->WorldPosition = DimensionManager->GetCurrentInstanceInfo().WorldPosition;
 			
 			// Save updated cartridge data back to item
 			FItemEntry ItemEntry = SocketedItem->GetItemEntry();
@@ -250,11 +277,9 @@ void APortalDevice::ClosePortal()
 		return;
 	}
 
-	// Unload dimension (this will save it automatically)
-	if (DimensionManager->IsDimensionLoaded())
-	{
-		DimensionManager->UnloadDimensionInstance();
-	}
+	// Hide dimension (this will save it automatically); it stays resident until evicted.
+	// Also covers a dimension that is still streaming in.
+	DimensionManager->DeactivateDimensionInstance();
 
 	CurrentInstanceId = FGuid();
 	CurrentCartridgeId = FGuid();
@@ -381,6 +406,55 @@ void APortalDevice::OnPortalBeginOverlap(UPrimitiveComponent* OverlappedComponen
 	UE_LOG(LogTemp, Log, TEXT("[PortalDevice] Teleported player to dimension at location %s"), *TeleportLocation.ToString());
 }
 
+void APortalDevice::OnPrefetchBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// Nothing to prefetch once the portal is open
+	if (IsPortalOpen())
+	{
+		return;
+	}
+
+	APawn* Pawn = Cast<APawn>(OtherActor);
+	if (!Pawn || !Cast<APlayerController>(Pawn->GetController()))
+	{
+		return;
+	}
+
+	// The socketed cartridge is the one the portal will open; otherwise guess the one the player is bringing
+	AItemPickup* Cartridge = CartridgeSocket ? CartridgeSocket->GetSocketedItem() : nullptr;
+	if (!Cartridge)
+	{
+		if (AFirstPersonCharacter* PlayerCharacter = Cast<AFirstPersonCharacter>(Pawn))
+		{
+			Cartridge = PlayerCharacter->GetHeldItemActor();
+		}
+	}
+	if (!Cartridge)
+	{
+		if (UPhysicsInteractionComponent* PhysicsInteraction = Pawn->FindComponentByClass<UPhysicsInteractionComponent>())
+		{
+			UPrimitiveComponent* HeldComponent = PhysicsInteraction->GetHeldComponent();
+			Cartridge = HeldComponent ? Cast<AItemPickup>(HeldComponent->GetOwner()) : nullptr;
+		}
+	}
+
+	PrefetchCartridge(Cartridge);
+}
+
+void APortalDevice::PrefetchCartridge(AItemPickup* Cartridge)
+{
+	UDimensionCartridgeData* CartridgeData = UDimensionCartridgeHelpers::GetCartridgeDataFromItem(Cartridge);
+	if (!CartridgeData || !CartridgeData->IsValid())
+	{
+		return;
+	}
+
+	if (UDimensionManagerSubsystem* DimensionManager = GetDimensionManager())
+	{
+		DimensionManager->PrefetchDimension(CartridgeData->GetDimensionDefinition(), CartridgeData->InstanceData->InstanceId);
+	}
+}
+
 void APortalDevice::OnDimensionLoaded(FGuid InstanceId)
 {
 	// Only spawn return portal if this is our dimension
@@ -591,7 +665,7 @@ void APortalDevice::UpdateCartridgeWithInstanceData(FGuid InstanceId)
 	UDimensionManagerSubsystem* DimensionManager = GetDimensionManager();
 	if (DimensionManager)
 	{
-		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 		if (InstanceInfo.InstanceId == InstanceId)
 		{
 			CartridgeData->InstanceData->WorldPosition = InstanceInfo.WorldPosition;
@@ -0,0 +1,72 @@
+#include "Dimensions/WeightedAliasTable.h"
+#include "Math/RandomStream.h"
+
+void FWeightedAliasTable::Build(TConstArrayView<float> Weights)
+{
+	Reset();
+
+	double TotalWeight = 0.0;
+	for (const float Weight : Weights)
+	{
+		TotalWeight += FMath::Max(0.0f, Weight);
+	}
+
+	const int32 Count = Weights.Num();
+	if (Count == 0 || TotalWeight <= 0.0)
+	{
+		return;
+	}
+
+	// Scale so the average slot holds exactly 1, then pair each under-full slot with an over-full one
+	TArray<double> Scaled;
+	Scaled.SetNumUninitialized(Count);
+	TArray<int32> Small;
+	TArray<int32> Large;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Scaled[Index] = FMath::Max(0.0f, Weights[Index]) * Count / TotalWeight;
+		(Scaled[Index] < 1.0 ? Small : Large).Add(Index);
+	}
+
+	Probability.SetNumUninitialized(Count);
+	Alias.SetNumUninitialized(Count);
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 Under = Small.Pop(EAllowShrinking::No);
+		const int32 Over = Large.Pop(EAllowShrinking::No);
+		Probability[Under] = static_cast<float>(Scaled[Under]);
+		Alias[Under] = Over;
+
+		Scaled[Over] += Scaled[Under] - 1.0;
+		(Scaled[Over] < 1.0 ? Small : Large).Add(Over);
+	}
+
+	// Whatever is left is full up to rounding error
+	for (const int32 Index : Large)
+	{
+		Probability[Index] = 1.0f;
+		Alias[Index] = Index;
+	}
+	for (const int32 Index : Small)
+	{
+		Probability[Index] = 1.0f;
+		Alias[Index] = Index;
+	}
+}
+
+void FWeightedAliasTable::Reset()
+{
+	Probability.Reset();
+	Alias.Reset();
+}
+
+int32 FWeightedAliasTable::Sample(FRandomStream& Stream) const
+{
+	if (IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Slot = Stream.RandHelper(Probability.Num());
+	return Stream.FRand() < Probability[Slot] ? Slot : Alias[Slot];
+}
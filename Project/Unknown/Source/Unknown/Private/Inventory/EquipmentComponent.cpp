@@ -248,3 +248,77 @@ void UEquipmentComponent::DropToWorld(const FItemEntry& Entry) const
         }
     }
 }
+
+void UEquipmentComponent::WriteToSave(TArray<uint8>& OutData) const
+{
+    ComponentSaveState::WriteComponent(this, OutData);
+}
+
+void UEquipmentComponent::ReadFromSave(const TArray<uint8>& InData)
+{
+    if (!ComponentSaveState::ReadComponent(this, InData))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("[EquipmentComponent] Could not read saved equipment"));
+    }
+}
+
+void UEquipmentComponent::PreRestoreSaveState()
+{
+    // Saved items replace the current ones outright; nothing goes back to the inventory
+    for (const TPair<EEquipmentSlot, FItemEntry>& Pair : Equipped)
+    {
+        if (Pair.Value.Def)
+        {
+            RemoveEffects(Pair.Value.Def);
+        }
+        OnItemUnequipped.Broadcast(Pair.Key, Pair.Value);
+    }
+    Equipped.Reset();
+}
+
+void UEquipmentComponent::SerializeSaveState(FArchive& Ar, int32 Version)
+{
+    int32 Count = Equipped.Num();
+    Ar << Count;
+    if (Ar.IsLoading())
+    {
+        const UEnum* SlotEnum = StaticEnum<EEquipmentSlot>();
+        if (Count < 0 || Count > SlotEnum->NumEnums())
+        {
+            Ar.SetError();
+            return;
+        }
+        Equipped.Reset();
+        for (int32 i = 0; i < Count && !Ar.IsError(); ++i)
+        {
+            uint8 Slot = 0;
+            FItemEntry Entry;
+            Ar << Slot;
+            FItemEntry::StaticStruct()->SerializeItem(Ar, &Entry, nullptr);
+            if (!SlotEnum->IsValidEnumValue(Slot))
+            {
+                Ar.SetError();
+                return;
+            }
+            Equipped.Add(static_cast<EEquipmentSlot>(Slot), Entry);
+        }
+    }
+    else
+    {
+        for (TPair<EEquipmentSlot, FItemEntry>& Pair : Equipped)
+        {
+            uint8 Slot = static_cast<uint8>(Pair.Key);
+            Ar << Slot;
+            FItemEntry::StaticStruct()->SerializeItem(Ar, &Pair.Value, nullptr);
+        }
+    }
+}
+
+void UEquipmentComponent::PostRestoreSaveState(int32 SavedVersion)
+{
+    for (const TPair<EEquipmentSlot, FItemEntry>& Pair : Equipped)
+    {
+        OnItemEquipped.Broadcast(Pair.Key, Pair.Value);
+        ApplyEffects(Pair.Value.Def);
+    }
+}
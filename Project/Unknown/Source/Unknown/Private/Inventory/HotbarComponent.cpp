@@ -1,6 +1,7 @@
 ﻿#include "Inventory/HotbarComponent.h"
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/ItemDefinition.h"
+#include "GameFramework/Actor.h"
 
 UHotbarComponent::UHotbarComponent()
 {
@@ -170,3 +171,29 @@ void UHotbarComponent::RefreshHeldFromInventory(UInventoryComponent* Inventory)
 		OnActiveChanged.Broadcast(ActiveIndex, ActiveItemId);
 	}
 }
+
+void UHotbarComponent::PreRestoreSaveState()
+{
+	for (int32 i = 0; i < Slots.Num(); ++i)
+	{
+		ClearSlot(i);
+	}
+}
+
+void UHotbarComponent::PostRestoreSaveState(int32 SavedVersion)
+{
+	for (int32 i = 0; i < Slots.Num(); ++i)
+	{
+		if (Slots[i].AssignedType)
+		{
+			OnSlotAssigned.Broadcast(i, Slots[i].AssignedType);
+		}
+	}
+
+	// Re-select against the restored inventory so the held item matches what is actually there
+	if (Slots.IsValidIndex(ActiveIndex))
+	{
+		const AActor* Owner = GetOwner();
+		SelectSlot(ActiveIndex, Owner ? Owner->FindComponentByClass<UInventoryComponent>() : nullptr);
+	}
+}
@@ -90,3 +90,25 @@ int32 UInventoryComponent::CountByDef(const UItemDefinition* Def) const
 	}
 	return Count;
 }
+
+void UInventoryComponent::PreRestoreSaveState()
+{
+	// Remove through RemoveById so UI and dependents see every current entry go away
+	TArray<FGuid> ItemIdsToRemove;
+	for (const FItemEntry& E : Entries)
+	{
+		ItemIdsToRemove.Add(E.ItemId);
+	}
+	for (const FGuid& ItemId : ItemIdsToRemove)
+	{
+		RemoveById(ItemId);
+	}
+}
+
+void UInventoryComponent::PostRestoreSaveState(int32 SavedVersion)
+{
+	for (const FItemEntry& E : Entries)
+	{
+		OnItemAdded.Broadcast(E);
+	}
+}
@@ -113,6 +113,11 @@ void AItemPickup::SetItemDef(UItemDefinition* InDef)
 {
     ItemDef = InDef;
     ApplyVisualsFromDef();
+
+    if (SaveableComponent)
+    {
+        SaveableComponent->MarkSaveStateDirty();
+    }
 }
 
 void AItemPickup::SetItemEntry(const FItemEntry& Entry)
@@ -121,6 +126,12 @@ void AItemPickup::SetItemEntry(const FItemEntry& Entry)
     ItemId = Entry.ItemId;
     CustomData = Entry.CustomData;
     ApplyVisualsFromDef();
+
+    // The serialized entry is part of this pickup's save record
+    if (SaveableComponent)
+    {
+        SaveableComponent->MarkSaveStateDirty();
+    }
 }
 
 FItemEntry AItemPickup::GetItemEntry() const
@@ -58,6 +58,18 @@ bool UStorageComponent::RemoveById(const FGuid& ItemId)
 	return false;
 }
 
+bool UStorageComponent::UpdateItem(const FItemEntry& Entry)
+{
+	FItemEntry* Existing = Entries.FindByPredicate([&](const FItemEntry& E){ return E.ItemId == Entry.ItemId; });
+	if (!Existing || !Entry.ItemId.IsValid())
+	{
+		return false;
+	}
+	*Existing = Entry;
+	OnItemChanged.Broadcast(*Existing);
+	return true;
+}
+
 int32 UStorageComponent::CountByDef(const UItemDefinition* Def) const
 {
 	if (!Def)
@@ -74,3 +86,25 @@ int32 UStorageComponent::CountByDef(const UItemDefinition* Def) const
 	}
 	return Count;
 }
+
+void UStorageComponent::PreRestoreSaveState()
+{
+	// Remove through RemoveById so UI and dependents see every current entry go away
+	TArray<FGuid> ItemIdsToRemove;
+	for (const FItemEntry& E : Entries)
+	{
+		ItemIdsToRemove.Add(E.ItemId);
+	}
+	for (const FGuid& ItemId : ItemIdsToRemove)
+	{
+		RemoveById(ItemId);
+	}
+}
+
+void UStorageComponent::PostRestoreSaveState(int32 SavedVersion)
+{
+	for (const FItemEntry& E : Entries)
+	{
+		OnItemAdded.Broadcast(E);
+	}
+}
@@ -1,6 +1,7 @@
 #include "Inventory/StorageSerialization.h"
 #include "Inventory/StorageComponent.h"
 #include "Inventory/ItemDefinition.h"
+#include "Save/ItemEntryArchive.h"
 #include "Engine/AssetManager.h"
 #include "UObject/UObjectGlobals.h"
 
@@ -8,41 +9,8 @@ namespace StorageSerialization
 {
 	FString SerializeStorageEntries(const TArray<FItemEntry>& Entries)
 	{
-		FString Result;
-		Result += FString::FromInt(Entries.Num());
-		
-		for (const FItemEntry& Entry : Entries)
-		{
-			if (!Entry.Def)
-			{
-				continue;
-			}
-			
-			// Store the asset path of the ItemDefinition
-			FString DefPath = Entry.Def->GetPathName();
-			FString ItemIdStr = Entry.ItemId.ToString(EGuidFormats::DigitsWithHyphensInBraces);
-			
-			Result += TEXT("|");
-			Result += DefPath;
-			Result += TEXT("|");
-			Result += ItemIdStr;
-			
-			// Store CustomData count and entries
-			int32 CustomDataCount = Entry.CustomData.Num();
-			Result += TEXT("|");
-			Result += FString::FromInt(CustomDataCount);
-			
-			// Store each CustomData key-value pair
-			for (const auto& CustomDataPair : Entry.CustomData)
-			{
-				Result += TEXT("|");
-				Result += CustomDataPair.Key.ToString();
-				Result += TEXT("=");
-				Result += CustomDataPair.Value;
-			}
-		}
-		
-		return Result;
+		// Always written in the binary archive format; legacy strings are only ever read
+		return ItemEntryArchive::EncodeEntries(Entries);
 	}
 	
 	TArray<FItemEntry> DeserializeStorageEntries(const FString& SerializedData)
@@ -54,6 +22,14 @@ namespace StorageSerialization
 			return Result;
 		}
 		
+		if (ItemEntryArchive::IsArchiveString(SerializedData))
+		{
+			ItemEntryArchive::DecodeEntries(SerializedData, Result);
+			return Result;
+		}
+		
+		// Legacy pipe-delimited format (pre-archive saves). Read-only: the data is rewritten
+		// in the archive format the next time the owning container is saved.
 		TArray<FString> Parts;
 		SerializedData.ParseIntoArray(Parts, TEXT("|"), true);
 		
@@ -223,6 +199,10 @@ namespace StorageSerialization
 		// Deserialize and restore entries
 		TArray<FItemEntry> RestoredEntries = DeserializeStorageEntries(*SerializedData);
 		Storage->Entries = RestoredEntries;
+		for (const FItemEntry& Entry : Storage->Entries)
+		{
+			Storage->OnItemChanged.Broadcast(Entry);
+		}
 		
 		UE_LOG(LogTemp, Display, TEXT("[StorageSerialization] Restored %d entries to storage component"), RestoredEntries.Num());
 	}
@@ -199,6 +199,65 @@ void AFirstPersonCharacter::BeginPlay()
     {
         Equipment->Inventory = Inventory;
     }
+	if (Equipment)
+	{
+		Equipment->OnItemEquipped.AddDynamic(this, &AFirstPersonCharacter::OnEquipmentChanged);
+		Equipment->OnItemUnequipped.AddDynamic(this, &AFirstPersonCharacter::OnEquipmentChanged);
+	}
+	RefreshPlayerTags();
+}
+
+void AFirstPersonCharacter::OnEquipmentChanged(EEquipmentSlot Slot, const FItemEntry& Item)
+{
+	SchedulePlayerTagsRefresh();
+}
+
+void AFirstPersonCharacter::SchedulePlayerTagsRefresh()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		RefreshPlayerTags();
+		return;
+	}
+
+	if (!PlayerTagsRefreshHandle.IsValid())
+	{
+		PlayerTagsRefreshHandle = World->GetTimerManager().SetTimerForNextTick(this, &AFirstPersonCharacter::RefreshPlayerTags);
+	}
+}
+
+void AFirstPersonCharacter::RefreshPlayerTags()
+{
+	PlayerTagsRefreshHandle.Invalidate();
+
+	FGameplayTagContainer NewTags = BaseTags;
+	if (Inventory)
+	{
+		for (const FItemEntry& Entry : Inventory->GetEntries())
+		{
+			if (Entry.Def)
+			{
+				NewTags.AppendTags(Entry.Def->Tags);
+			}
+		}
+	}
+	if (Equipment)
+	{
+		for (const TPair<EEquipmentSlot, FItemEntry>& Pair : Equipment->GetAllEquippedItems())
+		{
+			if (Pair.Value.Def)
+			{
+				NewTags.AppendTags(Pair.Value.Def->Tags);
+			}
+		}
+	}
+
+	if (NewTags != PlayerTags)
+	{
+		PlayerTags = MoveTemp(NewTags);
+		OnPlayerTagsChanged.Broadcast();
+	}
 }
 
 void AFirstPersonCharacter::StartSprint()
@@ -822,6 +881,7 @@ void AFirstPersonCharacter::UpdateHeldItemEntry(const FItemEntry& UpdatedEntry)
 
 void AFirstPersonCharacter::OnInventoryItemRemoved(const FGuid& RemovedItemId)
 {
+	SchedulePlayerTagsRefresh();
 	if (!RemovedItemId.IsValid())
 	{
 		return;
@@ -841,6 +901,7 @@ void AFirstPersonCharacter::OnInventoryItemRemoved(const FGuid& RemovedItemId)
 
 void AFirstPersonCharacter::OnInventoryItemAdded(const FItemEntry& AddedItem)
 {
+    SchedulePlayerTagsRefresh();
     // Keep this handler light and test-friendly; avoid doing heavy work here.
     UE_LOG(LogTemp, Verbose, TEXT("[FirstPersonCharacter] OnInventoryItemAdded: %s"), AddedItem.Def ? *AddedItem.Def->GetName() : TEXT("<null>"));
 
@@ -19,6 +19,9 @@
 #include "UI/LoadingFadeWidget.h"
 #include "Save/SaveSystemSubsystem.h"
 #include "Save/GameSaveData.h"
+#include "Save/SaveableActorSpatialIndex.h"
+#include "Save/SaveRestoreScheduler.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Dimensions/DimensionManagerSubsystem.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
@@ -107,8 +110,8 @@ void AFirstPersonPlayerController::BeginPlay()
 	
 	// Ensure fade widget is black if we're doing a level transition restore
 	// This prevents flash of level before fade-in
-	FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-	if (UGameplayStatics::DoesSaveGameExist(TempSlotName, 0))
+	USaveSystemSubsystem* PendingSaveSystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+	if (PendingSaveSystem && PendingSaveSystem->HasPendingRestore())
 	{
 		if (LoadingFadeWidget)
 		{
@@ -130,28 +133,36 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 		return;
 	}
 
-	// Check if there's a temp save with position data
-	FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-	if (UGameSaveData* TempSave = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(TempSlotName, 0)))
+	// Check if the previous level handed over save data to restore
+	USaveSystemSubsystem* PendingSaveSystem = World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<USaveSystemSubsystem>() : nullptr;
+	if (UGameSaveData* PendingSave = PendingSaveSystem ? PendingSaveSystem->GetPendingRestore() : nullptr)
 	{
 		// CRITICAL: Set CurrentSaveData immediately so dimension loading can find save data
 		// This must be done BEFORE waiting for the timer, otherwise cartridges in sockets
-		// will trigger dimension loading before save data is available
-		if (UGameInstance* GameInstance = World->GetGameInstance())
+		// will trigger dimension loading before save data is available.
+		// It gets its own copy because dimension loading mutates it while the restore below reads the handoff.
+		PendingSaveSystem->CurrentSaveData = PendingSave->CreateSnapshot(PendingSaveSystem);
+		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Set CurrentSaveData from pending restore for dimension restoration"));
+
+		TFunction<void()> RestoreSaveState = [this, World, PendingSaveSystem]()
 		{
-			if (USaveSystemSubsystem* SaveSystem = GameInstance->GetSubsystem<USaveSystemSubsystem>())
+			// Restore all game state from the handed-over save (kept alive by the strong ref until restoration finishes)
+			TStrongObjectPtr<UGameSaveData> TempSaveRef(PendingSaveSystem->GetPendingRestore());
+			
+			// Without a character to restore onto the handoff can never be applied, so drop it
+			// rather than leave it for a later level transition to pick up
+			if (TempSaveRef.IsValid() && !Cast<AFirstPersonCharacter>(UGameplayStatics::GetPlayerPawn(World, 0)))
 			{
-				SaveSystem->CurrentSaveData = TempSave;
-				UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Set CurrentSaveData from temp save for dimension restoration"));
+				UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] No player character to restore the level transition save onto, discarding it"));
+				PendingSaveSystem->ClearPendingRestore();
+				if (LoadingFadeWidget)
+				{
+					LoadingFadeWidget->FadeIn(1.5f);
+				}
+				return;
 			}
-		}
-
-		// Wait a bit for the player to fully spawn and level to be ready
-		FTimerHandle RestoreTimer;
-		World->GetTimerManager().SetTimer(RestoreTimer, [this, World, TempSlotName]()
-		{
-			// Load the temporary save to restore all game state
-			if (UGameSaveData* TempSave = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(TempSlotName, 0)))
+			
+			if (UGameSaveData* TempSave = TempSaveRef.Get())
 			{
 				if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0))
 				{
@@ -164,6 +175,16 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 							BaselineActorIds.Add(BaselineId);
 						}
 						
+						// Saves with deterministic IDs match level actors exactly by ID; older saves fall back to metadata
+						const bool bMatchByMetadata = !TempSave->bDeterministicActorIds;
+						
+						// Spatial hash of saveable actors for metadata fallback matching, built once for the whole restore
+						TSharedRef<FSaveableActorSpatialIndex> SpatialIndex = MakeShared<FSaveableActorSpatialIndex>();
+						if (bMatchByMetadata)
+						{
+							SpatialIndex->AddWorldActors(World);
+						}
+						
 						// === STEP 1: Early GUID Restoration (Before BeginPlay) ===
 						// Restore GUIDs to actors using metadata matching before they generate new GUIDs
 						// This must happen as early as possible to prevent GUID regeneration
@@ -189,6 +210,12 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 							// Try to find actor by GUID first
 							AActor* Actor = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 							
+							// A deterministic ID either matches exactly or the actor is no longer in the level
+							if (!Actor && !bMatchByMetadata)
+							{
+								continue;
+							}
+							
 							// If not found, try metadata fallback matching
 							if (!Actor)
 							{
@@ -197,17 +224,12 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 								int32 CandidatesWithComponent = 0;
 								int32 CandidatesWithValidGUID = 0;
 								
-								for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+								TArray<AActor*> Candidates;
+								SpatialIndex->Query(FSaveableActorSpatialIndex::InternClassPath(ActorState.ActorClassPath),
+									ActorState.OriginalSpawnTransform.GetLocation(), 10.0f, Candidates);
+								for (AActor* Candidate : Candidates)
 								{
-									AActor* Candidate = *ActorIterator;
-									if (!Candidate || MatchedActors.Contains(Candidate))
-									{
-										continue;
-									}
-									
-									// Check if class path matches
-									FString CandidateClassPath = Candidate->GetClass()->GetPathName();
-									if (CandidateClassPath != ActorState.ActorClassPath)
+									if (MatchedActors.Contains(Candidate))
 									{
 										continue;
 									}
@@ -292,8 +314,8 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 						int32 RemovedActorGUIDRestoredCount = 0;
 						for (const FActorStateSaveData& ActorState : TempSave->ActorStates)
 						{
-							// Only handle removed actors
-							if (ActorState.bExists || ActorState.ActorClassPath.IsEmpty() || ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
+							// Only handle removed actors (exact IDs need no restoring)
+							if (!bMatchByMetadata || ActorState.bExists || ActorState.ActorClassPath.IsEmpty() || ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
 							{
 								continue;
 							}
@@ -305,17 +327,12 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 							}
 							
 							// Find actor by metadata to restore its GUID
-							for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+							TArray<AActor*> Candidates;
+							SpatialIndex->Query(FSaveableActorSpatialIndex::InternClassPath(ActorState.ActorClassPath),
+								ActorState.OriginalSpawnTransform.GetLocation(), 10.0f, Candidates);
+							for (AActor* Candidate : Candidates)
 							{
-								AActor* Candidate = *ActorIterator;
-								if (!Candidate || MatchedActors.Contains(Candidate))
-								{
-									continue;
-								}
-								
-								// Check if class path matches
-								FString CandidateClassPath = Candidate->GetClass()->GetPathName();
-								if (CandidateClassPath != ActorState.ActorClassPath)
+								if (MatchedActors.Contains(Candidate))
 								{
 									continue;
 								}
@@ -366,14 +383,15 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 								AActor* ActorToRemove = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 								
 								// If not found by GUID, try metadata fallback
-								if (!ActorToRemove && !ActorState.ActorClassPath.IsEmpty() && !ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
+								if (!ActorToRemove && bMatchByMetadata && !ActorState.ActorClassPath.IsEmpty() && !ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
 								{
 									ActorToRemove = USaveableActorComponent::FindActorByGuidOrMetadata(
 										World,
 										ActorState.ActorId,
 										ActorState.ActorClassPath,
 										ActorState.OriginalSpawnTransform,
-										10.0f
+										10.0f,
+										&SpatialIndex.Get()
 									);
 								}
 								
@@ -424,171 +442,47 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 							}
 						}
 						
-						// Restore hunger
-						if (UHungerComponent* HungerComp = PlayerCharacter->GetHunger())
-						{
-							float SavedHunger = TempSave->PlayerData.CurrentHunger;
-							float CurrentHunger = HungerComp->GetCurrentHunger();
-							float HungerDelta = SavedHunger - CurrentHunger;
-							
-							// Use reflection to set CurrentHunger directly since RestoreHunger adds to current value
-							FProperty* CurrentHungerProp = UHungerComponent::StaticClass()->FindPropertyByName(TEXT("CurrentHunger"));
-							if (CurrentHungerProp)
-							{
-								float* CurrentHungerPtr = CurrentHungerProp->ContainerPtrToValuePtr<float>(HungerComp);
-								if (CurrentHungerPtr)
-								{
-									*CurrentHungerPtr = SavedHunger;
-									HungerComp->OnHungerChanged.Broadcast(SavedHunger, TempSave->PlayerData.MaxHunger);
-								}
-							}
-							else
-							{
-								// Fallback: use RestoreHunger if reflection fails
-								HungerComp->RestoreHunger(HungerDelta);
-							}
-							
-						}
-
-						// Check if new save data exists
-						bool bHasNewSaveData = !TempSave->InventoryData.SerializedEntries.IsEmpty() || 
-							TempSave->HotbarData.AssignedItemPaths.Num() > 0 ||
-							TempSave->EquipmentData.SerializedEquippedItems.Num() > 0;
-						
-
-						// Restore inventory
-						if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
-						{
-							TArray<FItemEntry> RestoredEntries = StorageSerialization::DeserializeStorageEntries(
-								TempSave->InventoryData.SerializedEntries);
-							
-							TArray<FGuid> ItemIdsToRemove;
-							for (const FItemEntry& Entry : InventoryComp->GetEntries())
-							{
-								ItemIdsToRemove.Add(Entry.ItemId);
-							}
-							for (const FGuid& ItemId : ItemIdsToRemove)
-							{
-								InventoryComp->RemoveById(ItemId);
-							}
-
-							int32 AddedCount = 0;
-							for (const FItemEntry& Entry : RestoredEntries)
-							{
-								if (InventoryComp->TryAdd(Entry))
-								{
-									AddedCount++;
-								}
-								else
-								{
-									UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to add inventory entry: %s"), 
-										Entry.Def ? *Entry.Def->GetPathName() : TEXT("NULL"));
-								}
-							}
-						}
-						else
-						{
-							UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Player character has no InventoryComponent"));
-						}
-
-						// Restore hotbar
-						if (UHotbarComponent* HotbarComp = PlayerCharacter->GetHotbar())
-						{
-							
-							for (int32 i = 0; i < HotbarComp->GetNumSlots(); ++i)
-							{
-								HotbarComp->ClearSlot(i);
-							}
-
-							int32 AssignedCount = 0;
-							for (int32 i = 0; i < TempSave->HotbarData.AssignedItemPaths.Num() && 
-								i < HotbarComp->GetNumSlots(); ++i)
-							{
-								const FString& ItemPath = TempSave->HotbarData.AssignedItemPaths[i];
-								if (!ItemPath.IsEmpty())
-								{
-									UItemDefinition* ItemDef = LoadObject<UItemDefinition>(nullptr, *ItemPath);
-									if (ItemDef)
-									{
-										HotbarComp->AssignSlot(i, ItemDef);
-										AssignedCount++;
-									}
-									else
-									{
-										UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to load ItemDefinition from path: %s"), *ItemPath);
-									}
-								}
-							}
-
-							if (TempSave->HotbarData.ActiveIndex != INDEX_NONE && 
-								TempSave->HotbarData.ActiveIndex >= 0 && 
-								TempSave->HotbarData.ActiveIndex < HotbarComp->GetNumSlots())
-							{
-								HotbarComp->SelectSlot(TempSave->HotbarData.ActiveIndex, PlayerCharacter->GetInventory());
-							}
-						}
-
-						// Restore equipment
-						if (UEquipmentComponent* EquipmentComp = PlayerCharacter->GetEquipment())
-						{
-							for (const FString& SerializedEquipment : TempSave->EquipmentData.SerializedEquippedItems)
-							{
-								EEquipmentSlot Slot;
-								FItemEntry Entry;
-								if (SaveSystemHelpers::DeserializeEquipmentSlot(SerializedEquipment, Slot, Entry))
-								{
-									bool bItemInInventory = false;
-									if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
-									{
-										for (const FItemEntry& InvEntry : InventoryComp->GetEntries())
-										{
-											if (InvEntry.ItemId == Entry.ItemId)
-											{
-												bItemInInventory = true;
-												break;
-											}
-										}
-
-										if (!bItemInInventory)
-										{
-											InventoryComp->TryAdd(Entry);
-										}
-
-										FText ErrorText;
-										EquipmentComp->EquipFromInventory(Entry.ItemId, ErrorText);
-									}
-								}
-							}
-						}
+						// Restore hunger, inventory, hotbar and equipment
+						SaveSystemHelpers::RestorePlayerComponents(PlayerCharacter, TempSave);
 
 						// === STEP 3: Two-Phase Actor Matching and State Restoration ===
+						// Records are applied a frame-budgeted batch at a time; cartridge/dimension restore and the fade-in
+						// run once the last one has been applied (see USaveSystemSubsystem::StartTimeSlicedRestore)
+						struct FRestoreCounts
+						{
+							int32 Restored = 0;
+							int32 NotFound = 0;
+							int32 Spawned = 0;
+							int32 Physics = 0;
+							int32 Storage = 0;
+							int32 MetadataFallback = 0;
+						};
+						TSharedRef<FRestoreCounts> Counts = MakeShared<FRestoreCounts>();
+						
 						// Track which actors have already been matched to prevent duplicate matches
-						TSet<AActor*> RestoredActors;
-						int32 ActorRestoredCount = 0;
-						int32 ActorNotFoundCount = 0;
-						int32 NewObjectSpawnedCount = 0;
-						int32 PhysicsRestoredCount = 0;
-						int32 StorageRestoredCount = 0;
-						int32 MetadataFallbackCount = 0;
+						TSharedRef<TSet<AActor*>> RestoredActors = MakeShared<TSet<AActor*>>();
+						TWeakObjectPtr<AFirstPersonCharacter> WeakPlayerCharacter = PlayerCharacter;
 						
-						for (const FActorStateSaveData& ActorState : TempSave->ActorStates)
+						TSharedRef<FSaveRestoreScheduler> Scheduler = MakeShared<FSaveRestoreScheduler>();
+						Scheduler->AddPhase(TempSave->ActorStates.Num(), [World, TempSaveRef, BaselineActorIds, bMatchByMetadata, SpatialIndex, RestoredActors, Counts](int32 Index)
 						{
+							const FActorStateSaveData& ActorState = TempSaveRef->ActorStates[Index];
 							if (!ActorState.bExists)
 							{
-								continue; // Skip actors that were marked as not existing (already handled in STEP 2)
+								return; // Skip actors that were marked as not existing (already handled in STEP 2)
 							}
 							
 							// === Phase 1: Primary Matching (By GUID) ===
 							AActor* Actor = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 							
 							// Check if this actor was already matched to a different saved state
-							if (Actor && RestoredActors.Contains(Actor))
+							if (Actor && RestoredActors->Contains(Actor))
 							{
 								// This actor was already matched - skip this saved state
 								UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor %s already matched to a different saved state, skipping GUID %s"), 
 									*Actor->GetName(), *ActorState.ActorId.ToString(EGuidFormats::DigitsWithHyphensInBraces));
-								ActorNotFoundCount++;
-								continue;
+								Counts->NotFound++;
+								return;
 							}
 							
 							// === Phase 2: Fallback Matching (By Metadata) ===
@@ -605,7 +499,7 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 										// Try to find by GUID again (in case it was restored in early step)
 										Actor = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 										
-										if (!Actor)
+										if (!Actor && bMatchByMetadata)
 										{
 											// Still not found - try metadata fallback
 											Actor = USaveableActorComponent::FindActorByGuidOrMetadata(
@@ -613,13 +507,14 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 												ActorState.ActorId,
 												ActorState.ActorClassPath,
 												ActorState.OriginalSpawnTransform,
-												10.0f  // 10cm tolerance
+												10.0f,  // 10cm tolerance
+												&SpatialIndex.Get()
 											);
 											
 											if (Actor)
 											{
 												// Check if this actor was already matched
-												if (RestoredActors.Contains(Actor))
+												if (RestoredActors->Contains(Actor))
 												{
 													// Actor already matched - skip
 													UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor %s already matched, skipping metadata fallback for GUID %s"), 
@@ -628,7 +523,7 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 												}
 												else
 												{
-													MetadataFallbackCount++;
+													Counts->MetadataFallback++;
 													UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Used metadata fallback to match actor %s (GUID: %s) - GUID was regenerated"), 
 														*Actor->GetName(), *ActorState.ActorId.ToString(EGuidFormats::DigitsWithHyphensInBraces));
 												}
@@ -638,10 +533,10 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 									
 									if (!Actor)
 									{
-										ActorNotFoundCount++;
+										Counts->NotFound++;
 										UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor with ID %s not found in world (was in baseline, class: %s)"), 
 											*ActorState.ActorId.ToString(EGuidFormats::DigitsWithHyphensInBraces), *ActorState.ActorClassPath);
-										continue;
+										return;
 									}
 								}
 								else
@@ -698,39 +593,39 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 													}
 												}
 												
-												NewObjectSpawnedCount++;
+												Counts->Spawned++;
 											}
 											else
 											{
 												UE_LOG(LogTemp, Error, TEXT("[SaveSystem] Failed to spawn new object (class: %s)"), *ActorState.SpawnActorClassPath);
-												ActorNotFoundCount++;
-												continue;
+												Counts->NotFound++;
+												return;
 											}
 										}
 										else
 										{
 											UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to load actor class for new object: %s"), *ActorState.SpawnActorClassPath);
-											ActorNotFoundCount++;
-											continue;
+											Counts->NotFound++;
+											return;
 										}
 									}
 									else
 									{
 										UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] New object with GUID %s cannot be spawned (missing spawn data)"), 
 											*ActorState.ActorId.ToString(EGuidFormats::DigitsWithHyphensInBraces));
-										ActorNotFoundCount++;
-										continue;
+										Counts->NotFound++;
+										return;
 									}
 								}
 							}
 							
 							if (!Actor)
 							{
-								continue;
+								return;
 							}
 							
 							// Mark this actor as matched
-							RestoredActors.Add(Actor);
+							RestoredActors->Add(Actor);
 
 							// Restore transform (only if bSaveTransform is enabled for this actor)
 							USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
@@ -778,50 +673,14 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 										PrimitiveComp->SetPhysicsLinearVelocity(ActorState.LinearVelocity);
 										PrimitiveComp->SetPhysicsAngularVelocityInRadians(ActorState.AngularVelocity);
 									}
-									PhysicsRestoredCount++;
+									Counts->Physics++;
 								}
 							}
 
-							// Restore storage state if applicable
-							if (ActorState.bHasStorage)
+							// Restore component state (storage contents and any other SaveGame properties)
+							if (SaveSystemHelpers::RestoreActorComponents(Actor, ActorState))
 							{
-								UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-								if (StorageComp)
-								{
-									TArray<FItemEntry> RestoredEntries = StorageSerialization::DeserializeStorageEntries(
-										ActorState.SerializedStorageEntries);
-									
-									TArray<FGuid> ItemIdsToRemove;
-									for (const FItemEntry& Entry : StorageComp->GetEntries())
-									{
-										ItemIdsToRemove.Add(Entry.ItemId);
-									}
-									
-									for (const FGuid& ItemId : ItemIdsToRemove)
-									{
-										StorageComp->RemoveById(ItemId);
-									}
-
-									int32 AddedCount = 0;
-									for (const FItemEntry& Entry : RestoredEntries)
-									{
-										if (StorageComp->TryAdd(Entry))
-										{
-											AddedCount++;
-										}
-										else
-										{
-											UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to add storage entry to actor %s"), *Actor->GetName());
-										}
-									}
-
-									StorageComp->MaxVolume = ActorState.StorageMaxVolume;
-									StorageRestoredCount++;
-								}
-								else
-								{
-									UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor %s has bHasStorage=true but no StorageComponent"), *Actor->GetName());
-								}
+								Counts->Storage++;
 							}
 
 							// Restore ItemEntry data for ItemPickup actors (includes CustomData like UsesRemaining)
@@ -842,72 +701,104 @@ void AFirstPersonPlayerController::RestorePlayerPositionAfterLevelLoad()
 								}
 							}
 
-							ActorRestoredCount++;
-						}
+							Counts->Restored++;
+						});
 						
-						// Restore cartridge instance IDs from saved dimension data
-						// This ensures cartridges have the correct instance IDs before they trigger dimension loading
-						if (UGameInstance* GameInstance = World->GetGameInstance())
+						PendingSaveSystem->StartTimeSlicedRestore(World, Scheduler, [this, World, TempSaveRef, WeakPlayerCharacter, PendingSaveSystem, Counts]()
 						{
-							if (USaveSystemSubsystem* SaveSystem = GameInstance->GetSubsystem<USaveSystemSubsystem>())
+							UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Restored %d actors (%d spawned, %d by metadata, %d not found)"),
+								Counts->Restored, Counts->Spawned, Counts->MetadataFallback, Counts->NotFound);
+						
+							UGameSaveData* TempSave = TempSaveRef.Get();
+							AFirstPersonCharacter* PlayerCharacter = WeakPlayerCharacter.Get();
+							if (!TempSave || !PlayerCharacter)
 							{
-								SaveSystem->RestoreCartridgeInstanceIds(World, TempSave, PlayerCharacter);
-								
-								// Restore loaded dimension if one was loaded when saving
-								// Use a delay to ensure all items and cartridges are fully restored first
-								if (TempSave->LoadedDimensionInstanceId.IsValid())
+								PendingSaveSystem->ClearPendingRestore();
+								return;
+							}
+						
+							// Restore cartridge instance IDs from saved dimension data
+							// This ensures cartridges have the correct instance IDs before they trigger dimension loading
+							if (UGameInstance* GameInstance = World->GetGameInstance())
+							{
+								if (USaveSystemSubsystem* SaveSystem = GameInstance->GetSubsystem<USaveSystemSubsystem>())
 								{
-									UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Will restore loaded dimension instance: %s"), 
-										*TempSave->LoadedDimensionInstanceId.ToString());
-									FTimerHandle RestoreDimensionTimer;
-									// Get saved player position for restoration after dimension loads
-									FVector SavedPlayerLocation = TempSave->PlayerData.Location.IsNearlyZero() ? 
-										TempSave->PlayerLocation : TempSave->PlayerData.Location;
-									FRotator SavedPlayerRotation = TempSave->PlayerData.Rotation.IsZero() ? 
-										TempSave->PlayerRotation : TempSave->PlayerData.Rotation;
-									
-									// Fade in callback - only fade in after dimension loads and player position is restored
-									TFunction<void()> FadeInCallback = [this, World]()
+									SaveSystem->RestoreCartridgeInstanceIds(World, TempSave, PlayerCharacter);
+								
+									// Restore loaded dimension if one was loaded when saving
+									// Use a delay to ensure all items and cartridges are fully restored first
+									if (TempSave->LoadedDimensionInstanceId.IsValid())
 									{
-										if (LoadingFadeWidget)
-										{
-											// Fade in smoothly (1.5 seconds) to reveal the loaded game
-											// Longer duration ensures player position is fully restored before fade completes
-											LoadingFadeWidget->FadeIn(1.5f);
-										}
-									};
+										UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Will restore loaded dimension instance: %s"), 
+											*TempSave->LoadedDimensionInstanceId.ToString());
+										FTimerHandle RestoreDimensionTimer;
+										// Get saved player position for restoration after dimension loads
+										FVector SavedPlayerLocation = TempSave->PlayerData.Location.IsNearlyZero() ? 
+											TempSave->PlayerLocation : TempSave->PlayerData.Location;
+										FRotator SavedPlayerRotation = TempSave->PlayerData.Rotation.IsZero() ? 
+											TempSave->PlayerRotation : TempSave->PlayerData.Rotation;
 									
-									World->GetTimerManager().SetTimer(RestoreDimensionTimer, [SaveSystem, World, TempSave, SavedPlayerLocation, SavedPlayerRotation, FadeInCallback]()
-									{
-										SaveSystem->RestoreLoadedDimension(World, TempSave, SavedPlayerLocation, SavedPlayerRotation, true, FadeInCallback);
-									}, 0.2f, false); // Reduced delay: 0.2 seconds should be enough for cartridges to restore
-								}
-								else
-								{
-									// No dimension to restore - fade in after restoration completes (for level transition loads)
-									// Add a small delay to ensure everything is visually settled before fading in
-									if (LoadingFadeWidget)
-									{
-										FTimerHandle FadeInTimer;
-										World->GetTimerManager().SetTimer(FadeInTimer, [this]()
+										// Fade in callback - only fade in after dimension loads and player position is restored
+										TFunction<void()> FadeInCallback = [this, World]()
 										{
 											if (LoadingFadeWidget)
 											{
 												// Fade in smoothly (1.5 seconds) to reveal the loaded game
+												// Longer duration ensures player position is fully restored before fade completes
 												LoadingFadeWidget->FadeIn(1.5f);
 											}
-										}, 0.2f, false); // 0.2 second delay before fading in
+										};
+									
+										World->GetTimerManager().SetTimer(RestoreDimensionTimer, [SaveSystem, World, TempSaveRef, SavedPlayerLocation, SavedPlayerRotation, FadeInCallback]()
+										{
+											SaveSystem->RestoreLoadedDimension(World, TempSaveRef.Get(), SavedPlayerLocation, SavedPlayerRotation, true, FadeInCallback);
+										}, 0.2f, false); // Reduced delay: 0.2 seconds should be enough for cartridges to restore
+									}
+									else
+									{
+										// No dimension to restore - fade in after restoration completes (for level transition loads)
+										// Add a small delay to ensure everything is visually settled before fading in
+										if (LoadingFadeWidget)
+										{
+											FTimerHandle FadeInTimer;
+											World->GetTimerManager().SetTimer(FadeInTimer, [this]()
+											{
+												if (LoadingFadeWidget)
+												{
+													// Fade in smoothly (1.5 seconds) to reveal the loaded game
+													LoadingFadeWidget->FadeIn(1.5f);
+												}
+											}, 0.2f, false); // 0.2 second delay before fading in
+										}
 									}
 								}
 							}
-						}
 						
-						// Clean up temp save
-						UGameplayStatics::DeleteGameInSlot(TempSlotName, 0);
+							// Handoff consumed
+							PendingSaveSystem->ClearPendingRestore();
+						});
 					}
 				}
 			}
-		}, 0.5f, false); // 0.5 second delay to ensure player and level are fully loaded
+		};
+
+		// Restore once every asset the save references is in memory (normally already requested by LoadGame
+		// while the previous level faded out), then wait a bit for the player to fully spawn and level to be ready
+		TWeakObjectPtr<AFirstPersonPlayerController> WeakThis(this);
+		PendingSaveSystem->PreloadSaveAssets(PendingSave, [WeakThis, RestoreSaveState, PendingSaveSystem]()
+		{
+			UWorld* World = WeakThis.IsValid() ? WeakThis->GetWorld() : nullptr;
+			if (World)
+			{
+				FTimerHandle RestoreTimer;
+				World->GetTimerManager().SetTimer(RestoreTimer, RestoreSaveState, 0.5f, false); // 0.5 second delay to ensure player and level are fully loaded
+			}
+			else
+			{
+				// The controller went away before the restore could start
+				PendingSaveSystem->ClearPendingRestore();
+			}
+		});
 	}
 }
 
@@ -17,6 +17,7 @@
 #include "UI/PauseMenuWidget.h"
 #include "UI/LoadingFadeWidget.h"
 #include "Save/GameSaveData.h"
+#include "Save/SaveSystemSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManagerGeneric.h"
@@ -193,36 +194,21 @@ struct FPlayerControllerUIManager
 				PC->LoadingFadeWidget->SetAlignmentInViewport(FVector2D(0.f, 0.f));
 				PC->LoadingFadeWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
 				
-				// Check if there's a temp save (indicating a level transition load or new game)
+				// Check for a pending handoff (indicating a level transition load or new game)
 				// If so, keep it black so we can fade in after restoration/save creation
-				FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-				FString NewGameSlotPrefix = TEXT("_NEWGAME_");
+				USaveSystemSubsystem* SaveSystem = PC->GetGameInstance() ? PC->GetGameInstance()->GetSubsystem<USaveSystemSubsystem>() : nullptr;
 				bool bShouldStartBlack = false;
 				
-				if (UGameSaveData* TempSave = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(TempSlotName, 0)))
+				if (SaveSystem && SaveSystem->HasPendingRestore())
 				{
 					// Level transition load - keep black so we can fade in after restoration
 					bShouldStartBlack = true;
 					UE_LOG(LogTemp, Display, TEXT("[SaveSystem] LoadingFadeWidget created during level transition - keeping black"));
 				}
-				else
+				else if (SaveSystem && SaveSystem->HasPendingNewGame())
 				{
-					// Check for new game temp save
-					FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-					IFileManager& FileManager = IFileManager::Get();
-					TArray<FString> SaveFiles;
-					FileManager.FindFiles(SaveFiles, *SaveDir, TEXT("*.sav"));
-					
-					for (const FString& SaveFile : SaveFiles)
-					{
-						FString FileName = FPaths::GetBaseFilename(SaveFile);
-						if (FileName.StartsWith(NewGameSlotPrefix))
-						{
-							// New game load - keep black so we can fade in after save creation
-							bShouldStartBlack = true;
-							break;
-						}
-					}
+					// New game load - keep black so we can fade in after save creation
+					bShouldStartBlack = true;
 				}
 				
 				if (bShouldStartBlack)
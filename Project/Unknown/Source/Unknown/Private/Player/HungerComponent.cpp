@@ -47,3 +47,7 @@ void UHungerComponent::NotifyHungerChanged()
 	OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
 }
 
+void UHungerComponent::PostRestoreSaveState(int32 SavedVersion)
+{
+	NotifyHungerChanged();
+}
@@ -0,0 +1,517 @@
+#include "Save/ActorStateTable.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+namespace ActorStateTable
+{
+	namespace
+	{
+		// 1: full-precision transforms and velocities
+		// 2: transforms relative to the original, smallest-three rotations, quantized velocities
+		// 3: component state records
+		constexpr int32 TableVersion = 3;
+		constexpr int32 FirstCompactTransformVersion = 2;
+
+		// Per-record flags; the matching section follows the common fields only when its flag is set
+		enum ERecordFlags : uint8
+		{
+			Exists = 1 << 0,
+			NewObject = 1 << 1,
+			SimulatePhysics = 1 << 2,
+			HasSpawnClass = 1 << 3,
+			HasItem = 1 << 4,
+			HasPhysics = 1 << 5,
+			HasStorage = 1 << 6,
+			HasComponents = 1 << 7
+		};
+
+		// Which transform/velocity fields are written (v2+); a set flag means the field was omitted
+		enum ETransformFlags : uint8
+		{
+			OriginalIsIdentity = 1 << 0,
+			OriginalUnitScale = 1 << 1,
+			LocationAtOriginal = 1 << 2,
+			RotationAtOriginal = 1 << 3,
+			UnitScale = 1 << 4,
+			ScaleAtOriginal = 1 << 5,
+			ZeroLinearVelocity = 1 << 6,
+			ZeroAngularVelocity = 1 << 7
+		};
+
+		// Zigzag varint: small magnitudes of either sign take one or two bytes
+		void WriteVarInt(FArchive& Ar, int64 Value)
+		{
+			uint64 Encoded = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+			do
+			{
+				uint8 Byte = Encoded & 0x7F;
+				Encoded >>= 7;
+				if (Encoded != 0)
+				{
+					Byte |= 0x80;
+				}
+				Ar << Byte;
+			}
+			while (Encoded != 0);
+		}
+
+		int64 ReadVarInt(FArchive& Ar)
+		{
+			uint64 Encoded = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				uint8 Byte = 0;
+				Ar << Byte;
+				Encoded |= static_cast<uint64>(Byte & 0x7F) << Shift;
+				if ((Byte & 0x80) == 0 || Ar.IsError())
+				{
+					return static_cast<int64>(Encoded >> 1) ^ -static_cast<int64>(Encoded & 1);
+				}
+			}
+			Ar.SetError();
+			return 0;
+		}
+
+		void WriteQuantizedVector(FArchive& Ar, const FVector& Value, double Step)
+		{
+			WriteVarInt(Ar, FMath::RoundToInt64(Value.X / Step));
+			WriteVarInt(Ar, FMath::RoundToInt64(Value.Y / Step));
+			WriteVarInt(Ar, FMath::RoundToInt64(Value.Z / Step));
+		}
+
+		FVector ReadQuantizedVector(FArchive& Ar, double Step)
+		{
+			const double X = ReadVarInt(Ar) * Step;
+			const double Y = ReadVarInt(Ar) * Step;
+			const double Z = ReadVarInt(Ar) * Step;
+			return FVector(X, Y, Z);
+		}
+
+		bool IsQuantizedZero(const FVector& Value, double Step)
+		{
+			return FMath::Abs(Value.X) < Step * 0.5 && FMath::Abs(Value.Y) < Step * 0.5 && FMath::Abs(Value.Z) < Step * 0.5;
+		}
+
+		// Smallest three: drop the largest quaternion component (recomputed from unit length on read) and
+		// store the other three, which lie within +-1/sqrt(2), as 16-bit fixed point
+		void WriteRotation(FArchive& Ar, const FQuat& Rotation)
+		{
+			const FQuat Q = Rotation.GetNormalized();
+			const double Components[4] = { Q.X, Q.Y, Q.Z, Q.W };
+
+			uint8 LargestIndex = 0;
+			for (uint8 Index = 1; Index < 4; ++Index)
+			{
+				if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+				{
+					LargestIndex = Index;
+				}
+			}
+
+			// Q and -Q are the same rotation; flip so the dropped component is positive
+			const double Sign = Components[LargestIndex] < 0.0 ? -1.0 : 1.0;
+			Ar << LargestIndex;
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				if (Index != LargestIndex)
+				{
+					const double Normalized = FMath::Clamp(Components[Index] * Sign * UE_SQRT_2, -1.0, 1.0);
+					int16 Quantized = static_cast<int16>(FMath::RoundToInt(Normalized * MAX_int16));
+					Ar << Quantized;
+				}
+			}
+		}
+
+		FQuat ReadRotation(FArchive& Ar)
+		{
+			uint8 LargestIndex = 0;
+			Ar << LargestIndex;
+			if (LargestIndex > 3)
+			{
+				Ar.SetError();
+				return FQuat::Identity;
+			}
+
+			double Components[4] = {};
+			double SumSquares = 0.0;
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				if (Index != LargestIndex)
+				{
+					int16 Quantized = 0;
+					Ar << Quantized;
+					Components[Index] = (static_cast<double>(Quantized) / MAX_int16) * UE_INV_SQRT_2;
+					SumSquares += Components[Index] * Components[Index];
+				}
+			}
+			Components[LargestIndex] = FMath::Sqrt(FMath::Max(0.0, 1.0 - SumSquares));
+
+			return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+		}
+
+		bool IsUnitScale(const FVector& Scale)
+		{
+			return Scale.Equals(FVector::OneVector, ScaleTolerance);
+		}
+
+		void WriteScale(FArchive& Ar, const FVector& Scale)
+		{
+			FVector3f Compact(Scale);
+			Ar << Compact;
+		}
+
+		FVector ReadScale(FArchive& Ar)
+		{
+			FVector3f Compact = FVector3f::OneVector;
+			Ar << Compact;
+			return FVector(Compact);
+		}
+
+		void WriteCompactTransforms(FArchive& Ar, const FActorStateSaveData& State)
+		{
+			const FTransform& Original = State.OriginalSpawnTransform;
+			const FQuat OriginalRotation = Original.GetRotation();
+			const FQuat Rotation = State.Rotation.Quaternion();
+
+			uint8 Flags = 0;
+			if (Original.GetLocation().IsZero() && OriginalRotation.Equals(FQuat::Identity, 0.0) && Original.GetScale3D().Equals(FVector::OneVector, 0.0))
+			{
+				Flags |= OriginalIsIdentity;
+			}
+			if (IsUnitScale(Original.GetScale3D()))
+			{
+				Flags |= OriginalUnitScale;
+			}
+			if (State.Location.Equals(Original.GetLocation(), LocationTolerance))
+			{
+				Flags |= LocationAtOriginal;
+			}
+			if (FMath::RadiansToDegrees(Rotation.AngularDistance(OriginalRotation)) <= RotationToleranceDegrees)
+			{
+				Flags |= RotationAtOriginal;
+			}
+			if (IsUnitScale(State.Scale))
+			{
+				Flags |= UnitScale;
+			}
+			else if (State.Scale.Equals(Original.GetScale3D(), ScaleTolerance))
+			{
+				Flags |= ScaleAtOriginal;
+			}
+			if (!State.bHasPhysics || IsQuantizedZero(State.LinearVelocity, LinearVelocityStep))
+			{
+				Flags |= ZeroLinearVelocity;
+			}
+			if (!State.bHasPhysics || IsQuantizedZero(State.AngularVelocity, AngularVelocityStep))
+			{
+				Flags |= ZeroAngularVelocity;
+			}
+			Ar << Flags;
+
+			// The original stays at full precision: restore matches actors against it
+			if (!(Flags & OriginalIsIdentity))
+			{
+				FVector OriginalLocation = Original.GetLocation();
+				Ar << OriginalLocation;
+				WriteRotation(Ar, OriginalRotation);
+				if (!(Flags & OriginalUnitScale))
+				{
+					WriteScale(Ar, Original.GetScale3D());
+				}
+			}
+			if (!(Flags & LocationAtOriginal))
+			{
+				WriteQuantizedVector(Ar, State.Location - Original.GetLocation(), LocationTolerance);
+			}
+			if (!(Flags & RotationAtOriginal))
+			{
+				WriteRotation(Ar, Rotation);
+			}
+			if (!(Flags & (UnitScale | ScaleAtOriginal)))
+			{
+				WriteScale(Ar, State.Scale);
+			}
+			if (State.bHasPhysics && !(Flags & ZeroLinearVelocity))
+			{
+				WriteQuantizedVector(Ar, State.LinearVelocity, LinearVelocityStep);
+			}
+			if (State.bHasPhysics && !(Flags & ZeroAngularVelocity))
+			{
+				WriteQuantizedVector(Ar, State.AngularVelocity, AngularVelocityStep);
+			}
+		}
+
+		void ReadCompactTransforms(FArchive& Ar, FActorStateSaveData& State)
+		{
+			uint8 Flags = 0;
+			Ar << Flags;
+
+			State.OriginalSpawnTransform = FTransform::Identity;
+			if (!(Flags & OriginalIsIdentity))
+			{
+				FVector OriginalLocation = FVector::ZeroVector;
+				Ar << OriginalLocation;
+				State.OriginalSpawnTransform.SetLocation(OriginalLocation);
+				State.OriginalSpawnTransform.SetRotation(ReadRotation(Ar));
+				if (!(Flags & OriginalUnitScale))
+				{
+					State.OriginalSpawnTransform.SetScale3D(ReadScale(Ar));
+				}
+			}
+
+			const FTransform& Original = State.OriginalSpawnTransform;
+			State.Location = (Flags & LocationAtOriginal)
+				? Original.GetLocation()
+				: Original.GetLocation() + ReadQuantizedVector(Ar, LocationTolerance);
+			State.Rotation = (Flags & RotationAtOriginal) ? Original.Rotator() : ReadRotation(Ar).Rotator();
+			if (Flags & UnitScale)
+			{
+				State.Scale = FVector::OneVector;
+			}
+			else
+			{
+				State.Scale = (Flags & ScaleAtOriginal) ? Original.GetScale3D() : ReadScale(Ar);
+			}
+
+			State.LinearVelocity = FVector::ZeroVector;
+			State.AngularVelocity = FVector::ZeroVector;
+			if (State.bHasPhysics && !(Flags & ZeroLinearVelocity))
+			{
+				State.LinearVelocity = ReadQuantizedVector(Ar, LinearVelocityStep);
+			}
+			if (State.bHasPhysics && !(Flags & ZeroAngularVelocity))
+			{
+				State.AngularVelocity = ReadQuantizedVector(Ar, AngularVelocityStep);
+			}
+		}
+
+		struct FStringInterner
+		{
+			TArray<FString>& Strings;
+			TMap<FString, int32> Indices;
+
+			explicit FStringInterner(TArray<FString>& InStrings) : Strings(InStrings) {}
+
+			int32 Intern(const FString& Value)
+			{
+				if (const int32* Existing = Indices.Find(Value))
+				{
+					return *Existing;
+				}
+				const int32 Index = Strings.Add(Value);
+				Indices.Add(Value, Index);
+				return Index;
+			}
+		};
+
+		bool ReadString(FArchive& Ar, const TArray<FString>& Strings, FString& OutValue)
+		{
+			int32 Index = INDEX_NONE;
+			Ar << Index;
+			if (!Strings.IsValidIndex(Index))
+			{
+				return false;
+			}
+			OutValue = Strings[Index];
+			return true;
+		}
+
+		// Component names and referenced asset paths are interned; the captured data itself is written as is
+		void WriteComponentStates(FArchive& Ar, FStringInterner& Interner, const TArray<FComponentSaveRecord>& Records)
+		{
+			WriteVarInt(Ar, Records.Num());
+			for (const FComponentSaveRecord& Record : Records)
+			{
+				int32 NameIndex = Interner.Intern(Record.ComponentName.ToString());
+				Ar << NameIndex;
+				// A saving archive only reads the array; operator<< just isn't const
+				Ar << const_cast<TArray<uint8>&>(Record.Data);
+				WriteVarInt(Ar, Record.AssetReferences.Num());
+				for (const FSoftObjectPath& Reference : Record.AssetReferences)
+				{
+					int32 ReferenceIndex = Interner.Intern(Reference.ToString());
+					Ar << ReferenceIndex;
+				}
+			}
+		}
+
+		bool ReadComponentStates(FArchive& Ar, const TArray<FString>& Strings, TArray<FComponentSaveRecord>& OutRecords)
+		{
+			// Each record is at least a name index and an array count; bounds the count before allocating
+			const int64 Count = ReadVarInt(Ar);
+			if (Ar.IsError() || Count < 0 || Count > (Ar.TotalSize() - Ar.Tell()) / 8)
+			{
+				return false;
+			}
+
+			OutRecords.Reserve(static_cast<int32>(Count));
+			for (int64 Index = 0; Index < Count; ++Index)
+			{
+				FComponentSaveRecord& Record = OutRecords.AddDefaulted_GetRef();
+				FString Name;
+				if (!ReadString(Ar, Strings, Name))
+				{
+					return false;
+				}
+				Record.ComponentName = FName(*Name);
+				Ar << Record.Data;
+
+				const int64 ReferenceCount = ReadVarInt(Ar);
+				if (Ar.IsError() || ReferenceCount < 0 || ReferenceCount > Strings.Num())
+				{
+					return false;
+				}
+				for (int64 ReferenceIndex = 0; ReferenceIndex < ReferenceCount; ++ReferenceIndex)
+				{
+					FString Path;
+					if (!ReadString(Ar, Strings, Path))
+					{
+						return false;
+					}
+					Record.AssetReferences.Emplace(Path);
+				}
+			}
+			return !Ar.IsError();
+		}
+	}
+
+	void Pack(const TArray<FActorStateSaveData>& States, FPackedActorStateSaveData& Out)
+	{
+		Out.Strings.Reset();
+		Out.Records.Reset();
+
+		FStringInterner Interner(Out.Strings);
+		FMemoryWriter Ar(Out.Records);
+
+		int32 Version = TableVersion;
+		int32 Count = States.Num();
+		Ar << Version;
+		Ar << Count;
+
+		for (const FActorStateSaveData& State : States)
+		{
+			const bool bHasItem = !State.ItemDefinitionPath.IsEmpty() || !State.SerializedItemEntry.IsEmpty();
+			uint8 Flags = (State.bExists ? Exists : 0)
+				| (State.bIsNewObject ? NewObject : 0)
+				| (State.bSimulatePhysics ? SimulatePhysics : 0)
+				| (!State.SpawnActorClassPath.IsEmpty() ? HasSpawnClass : 0)
+				| (bHasItem ? HasItem : 0)
+				| (State.bHasPhysics ? HasPhysics : 0)
+				| (State.bHasStorage ? HasStorage : 0)
+				| (State.ComponentStates.Num() > 0 ? HasComponents : 0);
+
+			int32 NameIndex = Interner.Intern(State.ActorName);
+			int32 ClassIndex = Interner.Intern(State.ActorClassPath);
+			FGuid ActorId = State.ActorId;
+			Ar << Flags;
+			Ar << ActorId;
+			Ar << NameIndex;
+			Ar << ClassIndex;
+			WriteCompactTransforms(Ar, State);
+
+			if (Flags & HasSpawnClass)
+			{
+				int32 SpawnClassIndex = Interner.Intern(State.SpawnActorClassPath);
+				Ar << SpawnClassIndex;
+			}
+			if (Flags & HasItem)
+			{
+				int32 ItemDefinitionIndex = Interner.Intern(State.ItemDefinitionPath);
+				Ar << ItemDefinitionIndex;
+				// Saving archives only read these strings; operator<< just isn't const
+				Ar << const_cast<FString&>(State.SerializedItemEntry);
+			}
+			if (Flags & HasStorage)
+			{
+				float StorageMaxVolume = State.StorageMaxVolume;
+				Ar << const_cast<FString&>(State.SerializedStorageEntries);
+				Ar << StorageMaxVolume;
+			}
+			if (Flags & HasComponents)
+			{
+				WriteComponentStates(Ar, Interner, State.ComponentStates);
+			}
+		}
+	}
+
+	bool Unpack(const FPackedActorStateSaveData& Packed, TArray<FActorStateSaveData>& OutStates)
+	{
+		OutStates.Reset();
+
+		FMemoryReader Ar(Packed.Records);
+		int32 Version = 0;
+		int32 Count = 0;
+		Ar << Version;
+		Ar << Count;
+
+		// Every record takes at least a flag byte, which bounds Count before allocating
+		if (Ar.IsError() || Version > TableVersion || Count < 0 || Count > Packed.Records.Num())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ActorStateTable] Unsupported or corrupt actor state table (version %d, %d records)"), Version, Count);
+			return false;
+		}
+
+		OutStates.Reserve(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			FActorStateSaveData& State = OutStates.AddDefaulted_GetRef();
+
+			uint8 Flags = 0;
+			Ar << Flags;
+			Ar << State.ActorId;
+			bool bValid = ReadString(Ar, Packed.Strings, State.ActorName)
+				&& ReadString(Ar, Packed.Strings, State.ActorClassPath);
+
+			State.bExists = (Flags & Exists) != 0;
+			State.bIsNewObject = (Flags & NewObject) != 0;
+			State.bSimulatePhysics = (Flags & SimulatePhysics) != 0;
+			State.bHasPhysics = (Flags & HasPhysics) != 0;
+			State.bHasStorage = (Flags & HasStorage) != 0;
+
+			if (Version >= FirstCompactTransformVersion)
+			{
+				ReadCompactTransforms(Ar, State);
+			}
+			else
+			{
+				Ar << State.OriginalSpawnTransform;
+				Ar << State.Location;
+				Ar << State.Rotation;
+				Ar << State.Scale;
+			}
+
+			if (Flags & HasSpawnClass)
+			{
+				bValid = bValid && ReadString(Ar, Packed.Strings, State.SpawnActorClassPath);
+			}
+			if (Flags & HasItem)
+			{
+				bValid = bValid && ReadString(Ar, Packed.Strings, State.ItemDefinitionPath);
+				Ar << State.SerializedItemEntry;
+			}
+			if ((Flags & HasPhysics) && Version < FirstCompactTransformVersion)
+			{
+				Ar << State.LinearVelocity;
+				Ar << State.AngularVelocity;
+			}
+			if (Flags & HasStorage)
+			{
+				Ar << State.SerializedStorageEntries;
+				Ar << State.StorageMaxVolume;
+			}
+			if (Flags & HasComponents)
+			{
+				bValid = bValid && ReadComponentStates(Ar, Packed.Strings, State.ComponentStates);
+			}
+
+			if (!bValid || Ar.IsError())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ActorStateTable] Corrupt actor state record %d of %d"), Index, Count);
+				OutStates.Reset();
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
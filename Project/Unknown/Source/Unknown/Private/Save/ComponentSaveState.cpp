@@ -0,0 +1,224 @@
+#include "Save/ComponentSaveState.h"
+#include "Components/ActorComponent.h"
+#include "Components/SaveableActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+namespace ComponentSaveState
+{
+	namespace
+	{
+		// SaveGame-filtered archive that stores object references as paths and notes every asset it writes
+		class FComponentSaveArchive : public FObjectAndNameAsStringProxyArchive
+		{
+		public:
+			FComponentSaveArchive(FArchive& InInnerArchive, TArray<FSoftObjectPath>* InAssetReferences)
+				: FObjectAndNameAsStringProxyArchive(InInnerArchive, true)
+				, AssetReferences(InAssetReferences)
+			{
+				ArIsSaveGame = true;
+			}
+
+			virtual FArchive& operator<<(UObject*& Obj) override
+			{
+				if (IsSaving() && AssetReferences && Obj && Obj->IsAsset())
+				{
+					AssetReferences->AddUnique(FSoftObjectPath(Obj));
+				}
+				return FObjectAndNameAsStringProxyArchive::operator<<(Obj);
+			}
+
+		private:
+			TArray<FSoftObjectPath>* AssetReferences;
+		};
+
+		ISaveableComponentState* GetHooks(UActorComponent* Component)
+		{
+			return Cast<ISaveableComponentState>(Component);
+		}
+
+		void SerializeComponent(UActorComponent* Component, FArchive& Ar, int32 Version)
+		{
+			UClass* Class = Component->GetClass();
+			Class->SerializeTaggedProperties(Ar, reinterpret_cast<uint8*>(Component), Class, nullptr);
+
+			if (ISaveableComponentState* Hooks = GetHooks(Component))
+			{
+				Hooks->SerializeSaveState(Ar, Version);
+			}
+		}
+
+		// Apply saved data without the Post hook; returns the version it was written with, or INDEX_NONE if corrupt
+		int32 ReadComponentData(UActorComponent* Component, const TArray<uint8>& Data)
+		{
+			FMemoryReader MemoryReader(Data, true);
+			int32 Version = 0;
+			MemoryReader << Version;
+			if (MemoryReader.IsError() || Version < 0)
+			{
+				return INDEX_NONE;
+			}
+
+			FComponentSaveArchive Ar(MemoryReader, nullptr);
+			SerializeComponent(Component, Ar, Version);
+			if (Ar.IsError())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ComponentSaveState] Corrupt saved state for component %s"), *Component->GetName());
+				return INDEX_NONE;
+			}
+			return Version;
+		}
+	}
+
+	bool IsCaptured(const UActorComponent* Component)
+	{
+		if (!Component || Component->IsA<USaveableActorComponent>())
+		{
+			return false;
+		}
+
+		const UClass* Class = Component->GetClass();
+		if (Class->ImplementsInterface(USaveableComponentState::StaticClass()))
+		{
+			return true;
+		}
+
+		for (TFieldIterator<FProperty> It(Class); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_SaveGame))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void WriteComponent(const UActorComponent* Component, TArray<uint8>& OutData, TArray<FSoftObjectPath>* OutAssetReferences)
+	{
+		OutData.Reset();
+		if (!Component)
+		{
+			return;
+		}
+
+		// Saving only reads the component; the serializers just aren't const
+		UActorComponent* MutableComponent = const_cast<UActorComponent*>(Component);
+		const ISaveableComponentState* Hooks = GetHooks(MutableComponent);
+
+		FMemoryWriter MemoryWriter(OutData, true);
+		int32 Version = Hooks ? Hooks->GetSaveStateVersion() : 0;
+		MemoryWriter << Version;
+
+		FComponentSaveArchive Ar(MemoryWriter, OutAssetReferences);
+		SerializeComponent(MutableComponent, Ar, Version);
+	}
+
+	bool ReadComponent(UActorComponent* Component, const TArray<uint8>& Data)
+	{
+		if (!Component)
+		{
+			return false;
+		}
+
+		ISaveableComponentState* Hooks = GetHooks(Component);
+		if (Hooks)
+		{
+			Hooks->PreRestoreSaveState();
+		}
+
+		const int32 Version = ReadComponentData(Component, Data);
+		if (Version == INDEX_NONE)
+		{
+			return false;
+		}
+
+		if (Hooks)
+		{
+			Hooks->PostRestoreSaveState(Version);
+		}
+		return true;
+	}
+
+	void CaptureActor(const AActor* Actor, TArray<FComponentSaveRecord>& OutRecords)
+	{
+		OutRecords.Reset();
+		if (!Actor)
+		{
+			return;
+		}
+
+		TInlineComponentArray<UActorComponent*> Components;
+		Actor->GetComponents(Components);
+		for (const UActorComponent* Component : Components)
+		{
+			if (IsCaptured(Component))
+			{
+				FComponentSaveRecord& Record = OutRecords.AddDefaulted_GetRef();
+				Record.ComponentName = Component->GetFName();
+				WriteComponent(Component, Record.Data, &Record.AssetReferences);
+			}
+		}
+	}
+
+	int32 RestoreActor(AActor* Actor, const TArray<FComponentSaveRecord>& Records)
+	{
+		if (!Actor || Records.Num() == 0)
+		{
+			return 0;
+		}
+
+		TInlineComponentArray<UActorComponent*> Components;
+		Actor->GetComponents(Components);
+
+		// Match every record first so PreRestore hooks see the actor before anything has been overwritten
+		TArray<TPair<UActorComponent*, const FComponentSaveRecord*>, TInlineAllocator<8>> Matches;
+		for (const FComponentSaveRecord& Record : Records)
+		{
+			UActorComponent* const* Found = Components.FindByPredicate([&Record](const UActorComponent* Component)
+			{
+				return Component && Component->GetFName() == Record.ComponentName;
+			});
+
+			if (Found && IsCaptured(*Found))
+			{
+				Matches.Emplace(*Found, &Record);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Verbose, TEXT("[ComponentSaveState] %s has no component %s to restore"),
+					*Actor->GetName(), *Record.ComponentName.ToString());
+			}
+		}
+
+		for (const TPair<UActorComponent*, const FComponentSaveRecord*>& Match : Matches)
+		{
+			if (ISaveableComponentState* Hooks = GetHooks(Match.Key))
+			{
+				Hooks->PreRestoreSaveState();
+			}
+		}
+
+		// Post hooks run once everything is in place (e.g. the hotbar re-selects against the restored inventory)
+		TArray<TPair<UActorComponent*, int32>, TInlineAllocator<8>> Restored;
+		for (const TPair<UActorComponent*, const FComponentSaveRecord*>& Match : Matches)
+		{
+			const int32 Version = ReadComponentData(Match.Key, Match.Value->Data);
+			if (Version != INDEX_NONE)
+			{
+				Restored.Emplace(Match.Key, Version);
+			}
+		}
+
+		for (const TPair<UActorComponent*, int32>& Entry : Restored)
+		{
+			if (ISaveableComponentState* Hooks = GetHooks(Entry.Key))
+			{
+				Hooks->PostRestoreSaveState(Entry.Value);
+			}
+		}
+
+		return Restored.Num();
+	}
+}
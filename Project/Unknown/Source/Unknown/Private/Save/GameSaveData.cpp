@@ -1,6 +1,7 @@
 #include "Save/GameSaveData.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/DateTime.h"
+#include "UObject/UnrealType.h"
 
 UGameSaveData::UGameSaveData()
 	: SaveName(TEXT("Untitled Save"))
@@ -21,3 +22,16 @@ UGameSaveData::UGameSaveData()
 	HotbarData.ActiveIndex = INDEX_NONE;
 }
 
+
+UGameSaveData* UGameSaveData::CreateSnapshot(UObject* Outer) const
+{
+	UGameSaveData* Snapshot = NewObject<UGameSaveData>(Outer ? Outer : GetTransientPackage());
+	
+	// Typed per-property copy (no serialization round-trip like DuplicateObject)
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		It->CopyCompleteValue_InContainer(Snapshot, this);
+	}
+	
+	return Snapshot;
+}
@@ -0,0 +1,500 @@
+#include "Save/ItemEntryArchive.h"
+#include "Inventory/ItemDefinition.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/Base64.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace ItemEntryArchive
+{
+	const TCHAR* const StringPrefix = TEXT("IEA1:");
+
+	namespace
+	{
+		// "IEAR" - lets raw byte consumers tell an item archive apart from other blobs
+		constexpr uint32 ArchiveMagic = 0x52414549;
+
+		enum class EValueType : uint8
+		{
+			String = 0,
+			Int = 1,
+			Float = 2,
+			Bool = 3,
+			// Nested item archive (e.g. a backpack's StorageData), stored as raw bytes instead of Base64
+			Archive = 4
+		};
+
+		int32 GetPrefixLength()
+		{
+			return FCString::Strlen(StringPrefix);
+		}
+
+		// Returns the index of Value in Table, adding it if missing
+		template <typename T>
+		uint32 Intern(const T& Value, TArray<T>& Table, TMap<T, uint32>& Lookup)
+		{
+			if (const uint32* Found = Lookup.Find(Value))
+			{
+				return *Found;
+			}
+			const uint32 Index = static_cast<uint32>(Table.Add(Value));
+			Lookup.Add(Value, Index);
+			return Index;
+		}
+
+		// A count can never exceed the bytes left in the archive (every element is at least one byte),
+		// so this rejects corrupt counts before they turn into huge allocations
+		bool IsPlausibleCount(FArchive& Ar, uint32 Count)
+		{
+			return !Ar.IsError() && static_cast<int64>(Count) <= Ar.TotalSize() - Ar.Tell();
+		}
+
+		// Pick the narrowest type that reproduces the original string exactly, so decoding is lossless
+		void WriteValue(FArchive& Ar, const FString& Value)
+		{
+			int64 IntValue = 0;
+			double FloatValue = 0.0;
+			TArray<uint8> NestedBytes;
+
+			if (Value == TEXT("true") || Value == TEXT("false"))
+			{
+				uint8 Type = static_cast<uint8>(EValueType::Bool);
+				uint8 bValue = Value == TEXT("true") ? 1 : 0;
+				Ar << Type;
+				Ar << bValue;
+			}
+			else if (LexTryParseString(IntValue, *Value) && LexToString(IntValue) == Value)
+			{
+				uint8 Type = static_cast<uint8>(EValueType::Int);
+				Ar << Type;
+				Ar << IntValue;
+			}
+			else if (LexTryParseString(FloatValue, *Value) && FString::SanitizeFloat(FloatValue) == Value)
+			{
+				uint8 Type = static_cast<uint8>(EValueType::Float);
+				Ar << Type;
+				Ar << FloatValue;
+			}
+			else if (IsArchiveString(Value)
+				&& FBase64::Decode(Value.RightChop(GetPrefixLength()), NestedBytes)
+				&& StringPrefix + FBase64::Encode(NestedBytes) == Value)
+			{
+				uint8 Type = static_cast<uint8>(EValueType::Archive);
+				Ar << Type;
+				Ar << NestedBytes;
+			}
+			else
+			{
+				uint8 Type = static_cast<uint8>(EValueType::String);
+				FString Copy = Value;
+				Ar << Type;
+				Ar << Copy;
+			}
+		}
+
+		bool ReadValue(FArchive& Ar, FString& OutValue)
+		{
+			uint8 Type = 0;
+			Ar << Type;
+
+			switch (static_cast<EValueType>(Type))
+			{
+			case EValueType::String:
+				Ar << OutValue;
+				break;
+			case EValueType::Int:
+				{
+					int64 IntValue = 0;
+					Ar << IntValue;
+					OutValue = LexToString(IntValue);
+				}
+				break;
+			case EValueType::Float:
+				{
+					double FloatValue = 0.0;
+					Ar << FloatValue;
+					OutValue = FString::SanitizeFloat(FloatValue);
+				}
+				break;
+			case EValueType::Bool:
+				{
+					uint8 bValue = 0;
+					Ar << bValue;
+					OutValue = bValue ? TEXT("true") : TEXT("false");
+				}
+				break;
+			case EValueType::Archive:
+				{
+					TArray<uint8> NestedBytes;
+					Ar << NestedBytes;
+					OutValue = StringPrefix + FBase64::Encode(NestedBytes);
+				}
+				break;
+			default:
+				UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Unknown CustomData value type %d"), Type);
+				Ar.SetError();
+				return false;
+			}
+
+			return !Ar.IsError();
+		}
+
+		// Backpacks inside backpacks are legal, but never this deep
+		constexpr int32 MaxNestingDepth = 16;
+
+		void CollectPathsFromString(const FString& Data, TArray<FString>& OutPaths, int32 Depth);
+
+		void CollectPathsFromBytes(const TArray<uint8>& Bytes, TArray<FString>& OutPaths, int32 Depth)
+		{
+			FMemoryReader Ar(Bytes);
+
+			uint32 Magic = 0;
+			uint8 Version = 0;
+			Ar << Magic;
+			Ar << Version;
+			if (Ar.IsError() || Magic != ArchiveMagic || Version == 0 || Version > CurrentVersion)
+			{
+				return;
+			}
+
+			uint32 PathCount = 0;
+			Ar.SerializeIntPacked(PathCount);
+			if (!IsPlausibleCount(Ar, PathCount))
+			{
+				return;
+			}
+			for (uint32 i = 0; i < PathCount; ++i)
+			{
+				FString Path;
+				Ar << Path;
+				if (!Ar.IsError() && !Path.IsEmpty())
+				{
+					OutPaths.AddUnique(MoveTemp(Path));
+				}
+			}
+
+			// Keys carry no paths; entries only matter for their nested archives
+			uint32 KeyCount = 0;
+			Ar.SerializeIntPacked(KeyCount);
+			if (!IsPlausibleCount(Ar, KeyCount))
+			{
+				return;
+			}
+			for (uint32 i = 0; i < KeyCount; ++i)
+			{
+				FString KeyString;
+				Ar << KeyString;
+			}
+
+			uint32 EntryCount = 0;
+			Ar.SerializeIntPacked(EntryCount);
+			if (!IsPlausibleCount(Ar, EntryCount))
+			{
+				return;
+			}
+			for (uint32 i = 0; i < EntryCount && !Ar.IsError(); ++i)
+			{
+				uint32 PathIndex = 0;
+				FGuid ItemId;
+				uint32 CustomDataCount = 0;
+				Ar.SerializeIntPacked(PathIndex);
+				Ar << ItemId;
+				Ar.SerializeIntPacked(CustomDataCount);
+				if (!IsPlausibleCount(Ar, CustomDataCount))
+				{
+					return;
+				}
+
+				for (uint32 j = 0; j < CustomDataCount; ++j)
+				{
+					uint32 KeyIndex = 0;
+					Ar.SerializeIntPacked(KeyIndex);
+					FString Value;
+					if (!ReadValue(Ar, Value))
+					{
+						return;
+					}
+					if (IsArchiveString(Value))
+					{
+						CollectPathsFromString(Value, OutPaths, Depth + 1);
+					}
+				}
+			}
+		}
+
+		void CollectPathsFromString(const FString& Data, TArray<FString>& OutPaths, int32 Depth)
+		{
+			if (Data.IsEmpty() || Depth > MaxNestingDepth)
+			{
+				return;
+			}
+
+			if (IsArchiveString(Data))
+			{
+				TArray<uint8> Bytes;
+				if (FBase64::Decode(Data.RightChop(GetPrefixLength()), Bytes))
+				{
+					CollectPathsFromBytes(Bytes, OutPaths, Depth);
+				}
+				return;
+			}
+
+			// Legacy pipe-delimited strings: definition paths are the parts that look like object paths
+			TArray<FString> Parts;
+			Data.ParseIntoArray(Parts, TEXT("|"), true);
+			for (FString& Part : Parts)
+			{
+				if (Part.StartsWith(TEXT("/")))
+				{
+					OutPaths.AddUnique(MoveTemp(Part));
+				}
+			}
+		}
+
+		UItemDefinition* ResolveDefinition(const FString& Path)
+		{
+			const FSoftObjectPath SoftPath(Path);
+			if (UObject* Existing = SoftPath.ResolveObject())
+			{
+				return Cast<UItemDefinition>(Existing);
+			}
+			return Cast<UItemDefinition>(SoftPath.TryLoad());
+		}
+	}
+
+	void WriteEntries(const TArray<FItemEntry>& Entries, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+
+		// Build the path and key tables up front so each entry only stores small indices
+		TArray<FString> Paths;
+		TMap<FString, uint32> PathLookup;
+		TArray<FName> Keys;
+		TMap<FName, uint32> KeyLookup;
+		TArray<uint32> EntryPathIndices;
+		EntryPathIndices.Reserve(Entries.Num());
+
+		for (const FItemEntry& Entry : Entries)
+		{
+			if (!Entry.Def)
+			{
+				continue;
+			}
+			EntryPathIndices.Add(Intern(Entry.Def->GetPathName(), Paths, PathLookup));
+			for (const auto& Pair : Entry.CustomData)
+			{
+				Intern(Pair.Key, Keys, KeyLookup);
+			}
+		}
+
+		FMemoryWriter Ar(OutBytes);
+
+		uint32 Magic = ArchiveMagic;
+		uint8 Version = CurrentVersion;
+		Ar << Magic;
+		Ar << Version;
+
+		uint32 PathCount = Paths.Num();
+		Ar.SerializeIntPacked(PathCount);
+		for (FString& Path : Paths)
+		{
+			Ar << Path;
+		}
+
+		uint32 KeyCount = Keys.Num();
+		Ar.SerializeIntPacked(KeyCount);
+		for (const FName& Key : Keys)
+		{
+			FString KeyString = Key.ToString();
+			Ar << KeyString;
+		}
+
+		uint32 EntryCount = EntryPathIndices.Num();
+		Ar.SerializeIntPacked(EntryCount);
+
+		int32 WrittenIndex = 0;
+		for (const FItemEntry& Entry : Entries)
+		{
+			if (!Entry.Def)
+			{
+				continue;
+			}
+
+			uint32 PathIndex = EntryPathIndices[WrittenIndex++];
+			FGuid ItemId = Entry.ItemId;
+			Ar.SerializeIntPacked(PathIndex);
+			Ar << ItemId;
+
+			uint32 CustomDataCount = Entry.CustomData.Num();
+			Ar.SerializeIntPacked(CustomDataCount);
+			for (const auto& Pair : Entry.CustomData)
+			{
+				uint32 KeyIndex = KeyLookup.FindChecked(Pair.Key);
+				Ar.SerializeIntPacked(KeyIndex);
+				WriteValue(Ar, Pair.Value);
+			}
+		}
+	}
+
+	bool ReadEntries(const TArray<uint8>& Bytes, TArray<FItemEntry>& OutEntries)
+	{
+		OutEntries.Reset();
+
+		FMemoryReader Ar(Bytes);
+
+		uint32 Magic = 0;
+		uint8 Version = 0;
+		Ar << Magic;
+		Ar << Version;
+		if (Ar.IsError() || Magic != ArchiveMagic)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Data is not an item entry archive"));
+			return false;
+		}
+		if (Version == 0 || Version > CurrentVersion)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Unsupported archive version %d (current %d)"), Version, CurrentVersion);
+			return false;
+		}
+
+		uint32 PathCount = 0;
+		Ar.SerializeIntPacked(PathCount);
+		if (!IsPlausibleCount(Ar, PathCount))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Corrupt path table"));
+			return false;
+		}
+		TArray<FString> Paths;
+		Paths.SetNum(PathCount);
+		for (FString& Path : Paths)
+		{
+			Ar << Path;
+		}
+
+		uint32 KeyCount = 0;
+		Ar.SerializeIntPacked(KeyCount);
+		if (!IsPlausibleCount(Ar, KeyCount))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Corrupt key table"));
+			return false;
+		}
+		TArray<FName> Keys;
+		Keys.Reserve(KeyCount);
+		for (uint32 i = 0; i < KeyCount; ++i)
+		{
+			FString KeyString;
+			Ar << KeyString;
+			Keys.Add(FName(*KeyString));
+		}
+
+		uint32 EntryCount = 0;
+		Ar.SerializeIntPacked(EntryCount);
+		if (!IsPlausibleCount(Ar, EntryCount))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Corrupt entry count"));
+			return false;
+		}
+
+		// Each distinct definition is resolved once, no matter how many entries reference it
+		TArray<UItemDefinition*> Defs;
+		Defs.Init(nullptr, Paths.Num());
+		TBitArray<> DefResolved(false, Paths.Num());
+
+		OutEntries.Reserve(EntryCount);
+		for (uint32 i = 0; i < EntryCount; ++i)
+		{
+			uint32 PathIndex = 0;
+			FGuid ItemId;
+			uint32 CustomDataCount = 0;
+			Ar.SerializeIntPacked(PathIndex);
+			Ar << ItemId;
+			Ar.SerializeIntPacked(CustomDataCount);
+
+			if (PathIndex >= PathCount || !IsPlausibleCount(Ar, CustomDataCount))
+			{
+				Ar.SetError();
+				break;
+			}
+
+			FItemEntry Entry;
+			Entry.ItemId = ItemId;
+			Entry.CustomData.Reserve(CustomDataCount);
+			for (uint32 j = 0; j < CustomDataCount; ++j)
+			{
+				uint32 KeyIndex = 0;
+				Ar.SerializeIntPacked(KeyIndex);
+				FString Value;
+				if (KeyIndex >= KeyCount || !ReadValue(Ar, Value))
+				{
+					Ar.SetError();
+					break;
+				}
+				Entry.CustomData.Add(Keys[KeyIndex], MoveTemp(Value));
+			}
+			if (Ar.IsError())
+			{
+				break;
+			}
+
+			if (!DefResolved[PathIndex])
+			{
+				Defs[PathIndex] = ResolveDefinition(Paths[PathIndex]);
+				DefResolved[PathIndex] = true;
+				if (!Defs[PathIndex])
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Failed to load ItemDefinition from path: %s"), *Paths[PathIndex]);
+				}
+			}
+			if (!Defs[PathIndex])
+			{
+				continue;
+			}
+
+			Entry.Def = Defs[PathIndex];
+			OutEntries.Add(MoveTemp(Entry));
+		}
+
+		if (Ar.IsError())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Archive is truncated or corrupt"));
+			OutEntries.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	FString EncodeEntries(const TArray<FItemEntry>& Entries)
+	{
+		TArray<uint8> Bytes;
+		WriteEntries(Entries, Bytes);
+		return StringPrefix + FBase64::Encode(Bytes);
+	}
+
+	bool DecodeEntries(const FString& Data, TArray<FItemEntry>& OutEntries)
+	{
+		OutEntries.Reset();
+		if (!IsArchiveString(Data))
+		{
+			return false;
+		}
+
+		TArray<uint8> Bytes;
+		if (!FBase64::Decode(Data.RightChop(GetPrefixLength()), Bytes))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ItemEntryArchive] Invalid Base64 payload"));
+			return false;
+		}
+		return ReadEntries(Bytes, OutEntries);
+	}
+
+	bool IsArchiveString(const FString& Data)
+	{
+		return Data.StartsWith(StringPrefix, ESearchCase::CaseSensitive);
+	}
+
+	void CollectDefinitionPaths(const FString& Data, TArray<FString>& OutPaths)
+	{
+		CollectPathsFromString(Data, OutPaths, 0);
+	}
+}
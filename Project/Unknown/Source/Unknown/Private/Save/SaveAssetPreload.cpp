@@ -0,0 +1,129 @@
+#include "Save/SaveAssetPreload.h"
+#include "Save/GameSaveData.h"
+#include "Save/ItemEntryArchive.h"
+#include "Engine/AssetManager.h"
+
+namespace SaveAssetPreload
+{
+	namespace
+	{
+		void AddPath(const FString& Path, TArray<FSoftObjectPath>& OutPaths)
+		{
+			if (Path.IsEmpty())
+			{
+				return;
+			}
+
+			const FSoftObjectPath SoftPath(Path);
+			if (SoftPath.IsValid())
+			{
+				OutPaths.AddUnique(SoftPath);
+			}
+		}
+
+		void AddItemPaths(const FString& SerializedItems, TArray<FSoftObjectPath>& OutPaths)
+		{
+			TArray<FString> DefinitionPaths;
+			ItemEntryArchive::CollectDefinitionPaths(SerializedItems, DefinitionPaths);
+			for (const FString& Path : DefinitionPaths)
+			{
+				AddPath(Path, OutPaths);
+			}
+		}
+
+		void AddComponentPaths(const TArray<FComponentSaveRecord>& Records, TArray<FSoftObjectPath>& OutPaths)
+		{
+			for (const FComponentSaveRecord& Record : Records)
+			{
+				for (const FSoftObjectPath& Reference : Record.AssetReferences)
+				{
+					if (Reference.IsValid())
+					{
+						OutPaths.AddUnique(Reference);
+					}
+				}
+			}
+		}
+	}
+
+	void CollectActorStateAssetPaths(const FActorStateSaveData& ActorState, TArray<FSoftObjectPath>& OutPaths)
+	{
+		if (!ActorState.bExists)
+		{
+			return;
+		}
+
+		AddPath(ActorState.ActorClassPath, OutPaths);
+		AddPath(ActorState.SpawnActorClassPath, OutPaths);
+		AddPath(ActorState.ItemDefinitionPath, OutPaths);
+		AddItemPaths(ActorState.SerializedItemEntry, OutPaths);
+		if (ActorState.bHasStorage)
+		{
+			AddItemPaths(ActorState.SerializedStorageEntries, OutPaths);
+		}
+		AddComponentPaths(ActorState.ComponentStates, OutPaths);
+	}
+
+	void CollectAssetPaths(const UGameSaveData* SaveData, TArray<FSoftObjectPath>& OutPaths)
+	{
+		if (!SaveData)
+		{
+			return;
+		}
+
+		AddComponentPaths(SaveData->PlayerData.ComponentStates, OutPaths);
+		AddItemPaths(SaveData->InventoryData.SerializedEntries, OutPaths);
+		for (const FString& ItemPath : SaveData->HotbarData.AssignedItemPaths)
+		{
+			AddPath(ItemPath, OutPaths);
+		}
+		for (const FString& SerializedEquipment : SaveData->EquipmentData.SerializedEquippedItems)
+		{
+			// "SlotIndex|<serialized item entry>"
+			FString SlotIndex;
+			FString SerializedEntry;
+			if (SerializedEquipment.Split(TEXT("|"), &SlotIndex, &SerializedEntry))
+			{
+				AddItemPaths(SerializedEntry, OutPaths);
+			}
+		}
+
+		for (const FActorStateSaveData& ActorState : SaveData->ActorStates)
+		{
+			CollectActorStateAssetPaths(ActorState, OutPaths);
+		}
+
+		// DimensionDefinitionPath is a level that level instancing loads under a unique package name,
+		// so preloading it would never be reused; only the actors saved inside dimensions are gathered
+		for (const FDimensionInstanceSaveData& Dimension : SaveData->DimensionInstances)
+		{
+			for (const FActorStateSaveData& ActorState : Dimension.ActorStates)
+			{
+				CollectActorStateAssetPaths(ActorState, OutPaths);
+			}
+		}
+	}
+
+	TSharedPtr<FStreamableHandle> RequestAsyncLoad(const UGameSaveData* SaveData, FStreamableDelegate OnLoaded)
+	{
+		TArray<FSoftObjectPath> Paths;
+		CollectAssetPaths(SaveData, Paths);
+
+		// Paths already in memory are still requested: the handle is what keeps them resident until restore runs
+		if (Paths.Num() == 0)
+		{
+			OnLoaded.ExecuteIfBound();
+			return nullptr;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[SaveAssetPreload] Requesting %d assets referenced by save"), Paths.Num());
+		TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			MoveTemp(Paths), OnLoaded, FStreamableManager::AsyncLoadHighPriority);
+		if (!Handle.IsValid())
+		{
+			// Nothing could be requested (e.g. invalid paths); restore falls back to loading on demand
+			OnLoaded.ExecuteIfBound();
+		}
+		return Handle;
+	}
+}
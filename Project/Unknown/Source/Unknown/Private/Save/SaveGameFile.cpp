@@ -0,0 +1,1554 @@
+#include "Save/SaveGameFile.h"
+#include "Save/GameSaveData.h"
+#include "Save/ActorStateTable.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/CustomVersion.h"
+#include "UObject/ObjectVersion.h"
+
+FArchive& operator<<(FArchive& Ar, FSaveFileHeader& Header)
+{
+	Ar << Header.SaveName;
+	Ar << Header.Timestamp;
+	Ar << Header.LevelPackagePath;
+	Ar << Header.PlaytimeSeconds;
+	Ar << Header.ActorStateCount;
+	Ar << Header.DimensionInstanceCount;
+	Ar << Header.UncompressedSize;
+	Ar << Header.CompressedSize;
+
+	// Appended later; headers written before it simply end here
+	if (Ar.IsSaving() || Ar.Tell() < Ar.TotalSize())
+	{
+		Ar << Header.JournalBaseId;
+	}
+	return Ar;
+}
+
+namespace SaveGameFile
+{
+	namespace
+	{
+		// "USVZ" - compressed save container; files without it are raw SaveGameToSlot output
+		constexpr uint32 ContainerMagic = 0x5A565355;
+
+		// 1: Magic, Version, Method, UncompressedSize, Payload
+		// 2: Magic, Version, HeaderSize, Header, Method, UncompressedSize, Payload
+		// 3: Magic, Version, HeaderSize, Header, package versions, SectionCount, section table, section payloads
+		constexpr uint32 ContainerVersion = 3;
+		constexpr uint32 FirstVersionWithHeader = 2;
+		constexpr uint32 FirstVersionWithSections = 3;
+
+		// Refuse absurd header sizes and section counts from corrupt files before allocating
+		constexpr uint32 MaxHeaderSize = 64 * 1024;
+		constexpr int32 MaxSectionCount = 64 * 1024;
+
+		// "USVD" - dimension sidecar: Magic, Version, InstanceId, package versions, Method, UncompressedSize, Payload
+		constexpr uint32 SidecarMagic = 0x44565355;
+		constexpr uint32 SidecarVersion = 1;
+
+		// "USVJ" - save journal: Magic, Version, BaseId, then entries of PayloadSize, PayloadCrc, Payload
+		// 1: entries carry a container image of the save without its records
+		// 2: entries carry only the changed core/player/inventory/dimension blocks
+		constexpr uint32 JournalMagic = 0x4A565355;
+		constexpr uint32 JournalVersion = 2;
+		constexpr uint32 FirstJournalVersionWithBlocks = 2;
+		constexpr int64 JournalFileHeaderSize = sizeof(uint32) * 2 + sizeof(FGuid);
+		constexpr int64 JournalEntryHeaderSize = sizeof(uint32) * 2;
+
+		enum class ECompressionMethod : uint8
+		{
+			None = 0,
+			Oodle = 1
+		};
+
+		// Compress RawBytes into OutPayload; falls back to storing them raw if compression fails or doesn't help
+		ECompressionMethod CompressPayload(TArray<uint8>& RawBytes, TArray<uint8>& OutPayload)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, RawBytes.Num());
+			OutPayload.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(NAME_Oodle, OutPayload.GetData(), CompressedSize, RawBytes.GetData(), RawBytes.Num())
+				&& CompressedSize < RawBytes.Num())
+			{
+				OutPayload.SetNum(CompressedSize);
+				return ECompressionMethod::Oodle;
+			}
+
+			OutPayload = MoveTemp(RawBytes);
+			return ECompressionMethod::None;
+		}
+
+		bool DecompressPayload(uint8 MethodValue, const uint8* Payload, int32 PayloadSize, int64 UncompressedSize, TArray<uint8>& OutRawBytes)
+		{
+			switch (static_cast<ECompressionMethod>(MethodValue))
+			{
+			case ECompressionMethod::None:
+				OutRawBytes.Append(Payload, PayloadSize);
+				return true;
+			case ECompressionMethod::Oodle:
+				OutRawBytes.SetNumUninitialized(static_cast<int32>(UncompressedSize));
+				if (!FCompression::UncompressMemory(NAME_Oodle, OutRawBytes.GetData(), OutRawBytes.Num(), Payload, PayloadSize))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Failed to decompress save data"));
+					return false;
+				}
+				return true;
+			default:
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Unknown compression method %d"), MethodValue);
+				return false;
+			}
+		}
+
+		// Swaps a record array for its packed form (see ActorStateTable) for as long as the scope lives
+		struct FScopedPackedActorStates
+		{
+			TArray<FActorStateSaveData>& States;
+			FPackedActorStateSaveData& Packed;
+			TArray<FActorStateSaveData> Stash;
+
+			FScopedPackedActorStates(TArray<FActorStateSaveData>& InStates, FPackedActorStateSaveData& InPacked)
+				: States(InStates), Packed(InPacked)
+			{
+				if (States.Num() > 0)
+				{
+					ActorStateTable::Pack(States, Packed);
+					Stash = MoveTemp(States);
+					States.Reset();
+				}
+			}
+
+			~FScopedPackedActorStates()
+			{
+				if (Stash.Num() > 0)
+				{
+					States = MoveTemp(Stash);
+				}
+				Packed = FPackedActorStateSaveData();
+			}
+		};
+
+		// Turn a packed table read from disk back into records (legacy files keep their records inline)
+		bool UnpackActorStates(TArray<FActorStateSaveData>& States, FPackedActorStateSaveData& Packed)
+		{
+			if (Packed.Records.Num() == 0)
+			{
+				return true;
+			}
+
+			const bool bSuccess = ActorStateTable::Unpack(Packed, States);
+			Packed = FPackedActorStateSaveData();
+			return bSuccess;
+		}
+
+		// Independently compressed and checksummed parts of a v3 container
+		enum class ESaveSection : uint8
+		{
+			Core = 0,			// Everything not split out below (SaveGameToMemory image)
+			Player = 1,			// FPlayerSaveData without its component states
+			Inventory = 2,		// Player component states and the legacy inventory/hotbar/equipment blocks
+			WorldActors = 3,	// Main-world actor records as a packed table
+			Dimension = 4		// One dimension instance (its records too, unless they live in a sidecar)
+		};
+
+		// Section table entry; payloads follow the table in order
+		struct FSaveSection
+		{
+			uint8 Type = 0;
+			uint8 Method = 0;
+			uint32 Crc = 0;
+			int64 UncompressedSize = 0;
+			int64 Size = 0;
+
+			// Not serialized: the stored bytes on save, the decompressed bytes on load
+			TArray<uint8> Bytes;
+
+			friend FArchive& operator<<(FArchive& Ar, FSaveSection& Section)
+			{
+				Ar << Section.Type;
+				Ar << Section.Method;
+				Ar << Section.Crc;
+				Ar << Section.UncompressedSize;
+				Ar << Section.Size;
+				return Ar;
+			}
+		};
+
+		// Package versions the tagged sections of a container were written with
+		struct FSectionVersions
+		{
+			FPackageFileVersion UEVersion = GPackageFileUEVersion;
+			int32 LicenseeVersion = GPackageFileLicenseeUEVersion;
+			FCustomVersionContainer CustomVersions = FCurrentCustomVersions::GetAll();
+
+			void Serialize(FArchive& Ar)
+			{
+				Ar << UEVersion;
+				Ar << LicenseeVersion;
+				CustomVersions.Serialize(Ar);
+			}
+
+			void Apply(FArchive& Ar) const
+			{
+				Ar.SetUEVer(UEVersion);
+				Ar.SetLicenseeUEVer(LicenseeVersion);
+				Ar.SetCustomVersions(CustomVersions);
+			}
+		};
+
+		// Tagged SaveGame serialization of one struct value, so sections survive fields being added to it
+		void WriteTaggedStruct(FArchive& MemoryWriter, UScriptStruct* Struct, void* Value)
+		{
+			FObjectAndNameAsStringProxyArchive StructAr(MemoryWriter, false);
+			StructAr.ArIsSaveGame = true;
+			Struct->SerializeItem(StructAr, Value, nullptr);
+		}
+
+		bool ReadTaggedStruct(FArchive& MemoryReader, UScriptStruct* Struct, void* Value)
+		{
+			FObjectAndNameAsStringProxyArchive StructAr(MemoryReader, true);
+			StructAr.ArIsSaveGame = true;
+			Struct->SerializeItem(StructAr, Value, nullptr);
+			return !StructAr.IsError();
+		}
+
+		// Queue RawBytes as a new section (compressed once every section is built)
+		void AddSection(TArray<FSaveSection>& Sections, ESaveSection Type, TArray<uint8>&& RawBytes)
+		{
+			FSaveSection& Section = Sections.AddDefaulted_GetRef();
+			Section.Type = static_cast<uint8>(Type);
+			Section.Bytes = MoveTemp(RawBytes);
+		}
+
+		const TCHAR* GetSectionName(uint8 Type)
+		{
+			switch (static_cast<ESaveSection>(Type))
+			{
+			case ESaveSection::Core: return TEXT("core");
+			case ESaveSection::Player: return TEXT("player");
+			case ESaveSection::Inventory: return TEXT("inventory");
+			case ESaveSection::WorldActors: return TEXT("world actors");
+			case ESaveSection::Dimension: return TEXT("dimension");
+			default: return TEXT("unknown");
+			}
+		}
+
+		// Player and inventory sections of SaveData (raw bytes)
+		void BuildPlayerSections(UGameSaveData* SaveData, TArray<FSaveSection>& OutSections)
+		{
+			TArray<uint8> PlayerBytes;
+			TArray<uint8> InventoryBytes;
+			FMemoryWriter PlayerWriter(PlayerBytes, true);
+			FMemoryWriter InventoryWriter(InventoryBytes, true);
+
+			TArray<FComponentSaveRecord> ComponentStates = MoveTemp(SaveData->PlayerData.ComponentStates);
+			SaveData->PlayerData.ComponentStates.Reset();
+			WriteTaggedStruct(PlayerWriter, FPlayerSaveData::StaticStruct(), &SaveData->PlayerData);
+			SaveData->PlayerData.ComponentStates = MoveTemp(ComponentStates);
+
+			WriteTaggedStruct(InventoryWriter, FInventorySaveData::StaticStruct(), &SaveData->InventoryData);
+			WriteTaggedStruct(InventoryWriter, FHotbarSaveData::StaticStruct(), &SaveData->HotbarData);
+			WriteTaggedStruct(InventoryWriter, FEquipmentSaveData::StaticStruct(), &SaveData->EquipmentData);
+			int32 ComponentCount = SaveData->PlayerData.ComponentStates.Num();
+			InventoryWriter << ComponentCount;
+			for (FComponentSaveRecord& Record : SaveData->PlayerData.ComponentStates)
+			{
+				WriteTaggedStruct(InventoryWriter, FComponentSaveRecord::StaticStruct(), &Record);
+			}
+
+			AddSection(OutSections, ESaveSection::Player, MoveTemp(PlayerBytes));
+			AddSection(OutSections, ESaveSection::Inventory, MoveTemp(InventoryBytes));
+		}
+
+		// One section per dimension instance (raw bytes)
+		void BuildDimensionSections(UGameSaveData* SaveData, TArray<FSaveSection>& OutSections)
+		{
+			for (FDimensionInstanceSaveData& Dimension : SaveData->DimensionInstances)
+			{
+				TArray<uint8> DimensionBytes;
+				FMemoryWriter DimensionWriter(DimensionBytes, true);
+				FScopedPackedActorStates PackedStates(Dimension.ActorStates, Dimension.PackedActorStates);
+				WriteTaggedStruct(DimensionWriter, FDimensionInstanceSaveData::StaticStruct(), &Dimension);
+				AddSection(OutSections, ESaveSection::Dimension, MoveTemp(DimensionBytes));
+			}
+		}
+
+		// Core: the rest of the object, through the regular SaveGame path. The parts split into other sections are
+		// moved aside while it is written and put back before returning.
+		bool WriteCoreImage(UGameSaveData* SaveData, TArray<uint8>& OutBytes)
+		{
+			FPlayerSaveData PlayerData = MoveTemp(SaveData->PlayerData);
+			FInventorySaveData InventoryData = MoveTemp(SaveData->InventoryData);
+			FHotbarSaveData HotbarData = MoveTemp(SaveData->HotbarData);
+			FEquipmentSaveData EquipmentData = MoveTemp(SaveData->EquipmentData);
+			TArray<FActorStateSaveData> ActorStates = MoveTemp(SaveData->ActorStates);
+			TArray<FDimensionInstanceSaveData> DimensionInstances = MoveTemp(SaveData->DimensionInstances);
+			SaveData->PlayerData = FPlayerSaveData();
+			SaveData->InventoryData = FInventorySaveData();
+			SaveData->HotbarData = FHotbarSaveData();
+			SaveData->EquipmentData = FEquipmentSaveData();
+			SaveData->ActorStates.Reset();
+			SaveData->DimensionInstances.Reset();
+
+			const bool bSuccess = UGameplayStatics::SaveGameToMemory(SaveData, OutBytes);
+
+			SaveData->PlayerData = MoveTemp(PlayerData);
+			SaveData->InventoryData = MoveTemp(InventoryData);
+			SaveData->HotbarData = MoveTemp(HotbarData);
+			SaveData->EquipmentData = MoveTemp(EquipmentData);
+			SaveData->ActorStates = MoveTemp(ActorStates);
+			SaveData->DimensionInstances = MoveTemp(DimensionInstances);
+
+			if (!bSuccess)
+			{
+				UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Failed to serialize save data"));
+			}
+			return bSuccess;
+		}
+
+		// Split SaveData into sections (raw bytes)
+		bool BuildSections(UGameSaveData* SaveData, TArray<FSaveSection>& OutSections)
+		{
+			BuildPlayerSections(SaveData, OutSections);
+
+			// Main-world actor records
+			{
+				FPackedActorStateSaveData Packed;
+				ActorStateTable::Pack(SaveData->ActorStates, Packed);
+				TArray<uint8> WorldBytes;
+				FMemoryWriter WorldWriter(WorldBytes, true);
+				WorldWriter << Packed.Strings;
+				WorldWriter << Packed.Records;
+				AddSection(OutSections, ESaveSection::WorldActors, MoveTemp(WorldBytes));
+			}
+
+			BuildDimensionSections(SaveData, OutSections);
+
+			TArray<uint8> CoreBytes;
+			if (!WriteCoreImage(SaveData, CoreBytes))
+			{
+				return false;
+			}
+
+			// Core goes first so a reader can build the object before applying the rest
+			OutSections.Insert(FSaveSection(), 0);
+			OutSections[0].Type = static_cast<uint8>(ESaveSection::Core);
+			OutSections[0].Bytes = MoveTemp(CoreBytes);
+			return true;
+		}
+
+		// Apply one decompressed, non-core section to SaveData
+		bool ApplySection(UGameSaveData* SaveData, const FSaveSection& Section, const FSectionVersions& Versions)
+		{
+			FMemoryReader MemoryReader(Section.Bytes, true);
+			Versions.Apply(MemoryReader);
+
+			switch (static_cast<ESaveSection>(Section.Type))
+			{
+			case ESaveSection::Player:
+			{
+				TArray<FComponentSaveRecord> ComponentStates = MoveTemp(SaveData->PlayerData.ComponentStates);
+				const bool bRead = ReadTaggedStruct(MemoryReader, FPlayerSaveData::StaticStruct(), &SaveData->PlayerData);
+				SaveData->PlayerData.ComponentStates = MoveTemp(ComponentStates);
+				return bRead;
+			}
+			case ESaveSection::Inventory:
+			{
+				bool bRead = ReadTaggedStruct(MemoryReader, FInventorySaveData::StaticStruct(), &SaveData->InventoryData)
+					&& ReadTaggedStruct(MemoryReader, FHotbarSaveData::StaticStruct(), &SaveData->HotbarData)
+					&& ReadTaggedStruct(MemoryReader, FEquipmentSaveData::StaticStruct(), &SaveData->EquipmentData);
+				int32 ComponentCount = 0;
+				MemoryReader << ComponentCount;
+				if (!bRead || MemoryReader.IsError() || ComponentCount < 0 || ComponentCount > MemoryReader.TotalSize())
+				{
+					return false;
+				}
+				SaveData->PlayerData.ComponentStates.SetNum(ComponentCount);
+				for (FComponentSaveRecord& Record : SaveData->PlayerData.ComponentStates)
+				{
+					bRead &= ReadTaggedStruct(MemoryReader, FComponentSaveRecord::StaticStruct(), &Record);
+				}
+				return bRead;
+			}
+			case ESaveSection::WorldActors:
+			{
+				FPackedActorStateSaveData Packed;
+				MemoryReader << Packed.Strings;
+				MemoryReader << Packed.Records;
+				return !MemoryReader.IsError() && ActorStateTable::Unpack(Packed, SaveData->ActorStates);
+			}
+			case ESaveSection::Dimension:
+			{
+				FDimensionInstanceSaveData& Dimension = SaveData->DimensionInstances.AddDefaulted_GetRef();
+				return ReadTaggedStruct(MemoryReader, FDimensionInstanceSaveData::StaticStruct(), &Dimension)
+					&& UnpackActorStates(Dimension.ActorStates, Dimension.PackedActorStates);
+			}
+			default:
+				// Written by a newer build; the sections this build knows about still load
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Skipping unknown save section type %d"), Section.Type);
+				return true;
+			}
+		}
+
+		// ESaveSectionFlags has one bit per section type
+		bool IsSectionWanted(uint8 Type, ESaveSectionFlags Sections)
+		{
+			return Type < 32 && EnumHasAnyFlags(Sections, static_cast<ESaveSectionFlags>(1u << Type));
+		}
+
+		// Read the preamble of a v3 container and skip its header; false for older containers and legacy files
+		bool SeekToSectionTable(FArchive& Ar)
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint32 HeaderSize = 0;
+			Ar << Magic;
+			if (Ar.IsError() || Magic != ContainerMagic)
+			{
+				return false;
+			}
+			Ar << Version;
+			Ar << HeaderSize;
+			if (Ar.IsError() || Version < FirstVersionWithSections || Version > ContainerVersion || HeaderSize > MaxHeaderSize)
+			{
+				return false;
+			}
+			Ar.Seek(Ar.Tell() + HeaderSize);
+			return !Ar.IsError();
+		}
+
+		// Read the sections of a v3 container selected by Sections, plus the core (Ar is positioned right after the
+		// header). The payloads of the other sections are seeked past and never read or checked.
+		UGameSaveData* DeserializeSections(FArchive& Ar, ESaveSectionFlags Sections)
+		{
+			FSectionVersions Versions;
+			Versions.Serialize(Ar);
+			int32 SectionCount = 0;
+			Ar << SectionCount;
+			if (Ar.IsError() || SectionCount < 1 || SectionCount > MaxSectionCount)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt section table in save container"));
+				return nullptr;
+			}
+
+			TArray<FSaveSection> Table;
+			Table.SetNum(SectionCount);
+			for (FSaveSection& Section : Table)
+			{
+				Ar << Section;
+			}
+
+			// Validate the table against the file before touching any payload
+			TArray<int64> Offsets;
+			Offsets.SetNumUninitialized(SectionCount);
+			int64 Offset = Ar.Tell();
+			for (int32 Index = 0; Index < SectionCount; ++Index)
+			{
+				const FSaveSection& Section = Table[Index];
+				if (Ar.IsError() || Section.Size < 0 || Section.Size > Ar.TotalSize() - Offset
+					|| Section.UncompressedSize < 0 || Section.UncompressedSize > MAX_int32)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt section table in save container"));
+					return nullptr;
+				}
+				Offsets[Index] = Offset;
+				Offset += Section.Size;
+			}
+			if (Table[0].Type != static_cast<uint8>(ESaveSection::Core))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Save container has no core section"));
+				return nullptr;
+			}
+
+			// Only the wanted payloads are read
+			TArray<int32> Wanted;
+			TArray<TArray<uint8>> Stored;
+			Stored.SetNum(SectionCount);
+			for (int32 Index = 0; Index < SectionCount; ++Index)
+			{
+				if (Index == 0 || IsSectionWanted(Table[Index].Type, Sections))
+				{
+					Wanted.Add(Index);
+					Stored[Index].SetNumUninitialized(static_cast<int32>(Table[Index].Size));
+					Ar.Seek(Offsets[Index]);
+					Ar.Serialize(Stored[Index].GetData(), Table[Index].Size);
+				}
+			}
+			if (Ar.IsError())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Truncated save container"));
+				return nullptr;
+			}
+
+			// Each section is checked and inflated on its own, so they go wide
+			TArray<uint8> SectionValid;
+			SectionValid.SetNumZeroed(Wanted.Num());
+			ParallelFor(Wanted.Num(), [&Table, &Wanted, &Stored, &SectionValid](int32 WantedIndex)
+			{
+				const int32 Index = Wanted[WantedIndex];
+				FSaveSection& Section = Table[Index];
+				const TArray<uint8>& Payload = Stored[Index];
+				if (FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != Section.Crc)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Checksum mismatch in %s section %d"), GetSectionName(Section.Type), Index);
+					return;
+				}
+				SectionValid[WantedIndex] = DecompressPayload(Section.Method, Payload.GetData(), Payload.Num(), Section.UncompressedSize, Section.Bytes) ? 1 : 0;
+			});
+			if (SectionValid.Contains(0))
+			{
+				return nullptr;
+			}
+
+			UGameSaveData* SaveData = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromMemory(Table[0].Bytes));
+			if (!SaveData)
+			{
+				return nullptr;
+			}
+
+			for (int32 WantedIndex = 1; WantedIndex < Wanted.Num(); ++WantedIndex)
+			{
+				const int32 Index = Wanted[WantedIndex];
+				if (!ApplySection(SaveData, Table[Index], Versions))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt %s section %d in save container"), GetSectionName(Table[Index].Type), Index);
+					return nullptr;
+				}
+			}
+			return SaveData;
+		}
+
+		// Write Bytes to a temp file next to FinalPath, for CommitTempFile to move into place
+		bool WriteTempFile(const FString& FinalPath, const TArray<uint8>& Bytes)
+		{
+			const FString TempPath = FinalPath + TEXT(".tmp");
+			if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath))
+			{
+				UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Failed to write temp save file: %s"), *TempPath);
+				return false;
+			}
+			return true;
+		}
+
+		bool CommitTempFile(const FString& FinalPath)
+		{
+			const FString TempPath = FinalPath + TEXT(".tmp");
+			if (!IFileManager::Get().Move(*FinalPath, *TempPath, true, true))
+			{
+				UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Failed to move temp save file into place: %s"), *FinalPath);
+				IFileManager::Get().Delete(*TempPath);
+				return false;
+			}
+			return true;
+		}
+
+		bool WriteFileAtomic(const FString& FinalPath, const TArray<uint8>& Bytes)
+		{
+			return WriteTempFile(FinalPath, Bytes) && CommitTempFile(FinalPath);
+		}
+
+		void SerializeDimensionSidecar(FDimensionInstanceSaveData& Dimension, TArray<uint8>& OutRawBytes)
+		{
+			// Tagged SaveGame serialization, so sidecars survive fields being added to the struct
+			FMemoryWriter MemoryWriter(OutRawBytes, true);
+			FObjectAndNameAsStringProxyArchive StructAr(MemoryWriter, false);
+			StructAr.ArIsSaveGame = true;
+			FScopedPackedActorStates PackedStates(Dimension.ActorStates, Dimension.PackedActorStates);
+			FDimensionInstanceSaveData::StaticStruct()->SerializeItem(StructAr, &Dimension, nullptr);
+		}
+
+		bool SaveDimensionSidecar(const FString& SlotName, const FGuid& InstanceId, const TArray<uint8>& RawBytes)
+		{
+			TArray<uint8> Payload;
+			const int64 RawSize = RawBytes.Num();
+			const ECompressionMethod Method = CompressPayload(RawBytes, Payload);
+
+			TArray<uint8> Bytes;
+			FMemoryWriter Ar(Bytes);
+			uint32 Magic = SidecarMagic;
+			uint32 Version = SidecarVersion;
+			FGuid StoredInstanceId = InstanceId;
+			FPackageFileVersion UEVersion = GPackageFileUEVersion;
+			int32 LicenseeVersion = GPackageFileLicenseeUEVersion;
+			FCustomVersionContainer CustomVersions = FCurrentCustomVersions::GetAll();
+			uint8 MethodValue = static_cast<uint8>(Method);
+			int64 UncompressedSize = RawSize;
+			Ar << Magic;
+			Ar << Version;
+			Ar << StoredInstanceId;
+			Ar << UEVersion;
+			Ar << LicenseeVersion;
+			CustomVersions.Serialize(Ar);
+			Ar << MethodValue;
+			Ar << UncompressedSize;
+			Ar.Serialize(Payload.GetData(), Payload.Num());
+
+			return WriteFileAtomic(GetDimensionSidecarPath(SlotName, InstanceId), Bytes);
+		}
+
+		bool LoadDimensionSidecar(const FString& SlotName, const FGuid& InstanceId, FDimensionInstanceSaveData& OutDimension)
+		{
+			TArray<uint8> Bytes;
+			if (SlotName.IsEmpty() || !FFileHelper::LoadFileToArray(Bytes, *GetDimensionSidecarPath(SlotName, InstanceId), FILEREAD_Silent))
+			{
+				return false;
+			}
+
+			FMemoryReader Ar(Bytes);
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			FGuid StoredInstanceId;
+			FPackageFileVersion UEVersion;
+			int32 LicenseeVersion = 0;
+			FCustomVersionContainer CustomVersions;
+			uint8 MethodValue = 0;
+			int64 UncompressedSize = 0;
+			Ar << Magic;
+			if (Ar.IsError() || Magic != SidecarMagic)
+			{
+				return false;
+			}
+			Ar << Version;
+			Ar << StoredInstanceId;
+			Ar << UEVersion;
+			Ar << LicenseeVersion;
+			CustomVersions.Serialize(Ar);
+			Ar << MethodValue;
+			Ar << UncompressedSize;
+			if (Ar.IsError() || Version > SidecarVersion || StoredInstanceId != InstanceId || UncompressedSize < 0 || UncompressedSize > MAX_int32)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Unsupported or corrupt dimension sidecar %s in slot %s"), *InstanceId.ToString(), *SlotName);
+				return false;
+			}
+
+			const int64 PayloadOffset = Ar.Tell();
+			TArray<uint8> RawBytes;
+			if (!DecompressPayload(MethodValue, Bytes.GetData() + PayloadOffset, Bytes.Num() - static_cast<int32>(PayloadOffset), UncompressedSize, RawBytes))
+			{
+				return false;
+			}
+
+			FMemoryReader MemoryReader(RawBytes, true);
+			MemoryReader.SetUEVer(UEVersion);
+			MemoryReader.SetLicenseeUEVer(LicenseeVersion);
+			MemoryReader.SetCustomVersions(CustomVersions);
+			FObjectAndNameAsStringProxyArchive StructAr(MemoryReader, true);
+			StructAr.ArIsSaveGame = true;
+			FDimensionInstanceSaveData::StaticStruct()->SerializeItem(StructAr, &OutDimension, nullptr);
+			return !StructAr.IsError() && UnpackActorStates(OutDimension.ActorStates, OutDimension.PackedActorStates);
+		}
+
+		bool CopyDimensionSidecar(const FString& FromSlotName, const FString& ToSlotName, const FGuid& InstanceId)
+		{
+			const FString FinalPath = GetDimensionSidecarPath(ToSlotName, InstanceId);
+			const FString TempPath = FinalPath + TEXT(".tmp");
+			if (IFileManager::Get().Copy(*TempPath, *GetDimensionSidecarPath(FromSlotName, InstanceId), true, true) != COPY_OK
+				|| !IFileManager::Get().Move(*FinalPath, *TempPath, true, true))
+			{
+				UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Failed to copy dimension sidecar %s from slot %s to %s"),
+					*InstanceId.ToString(), *FromSlotName, *ToSlotName);
+				IFileManager::Get().Delete(*TempPath, false, false, true);
+				return false;
+			}
+			return true;
+		}
+
+		// One journal entry: the header for slot listings, the blocks of the save that changed since the previous entry
+		// (raw core/player/inventory/dimension sections, applied like the sections of a snapshot) and the record changes.
+		// Version 1 entries carried a full container image of the save without its records instead of the blocks.
+		struct FJournalEntry
+		{
+			FSaveFileHeader Header;
+			FSectionVersions Versions;
+			TArray<FSaveSection> Blocks;
+			bool bDimensionsChanged = false;
+			TArray<uint8> CoreImage;
+			bool bBaselineChanged = false;
+			TArray<FGuid> BaselineActorIds;
+			FPackedActorStateSaveData ChangedRecords;
+			TArray<FGuid> RemovedActorIds;
+
+			void Serialize(FArchive& Ar, uint32 Version)
+			{
+				Ar << Header;
+				if (Version >= FirstJournalVersionWithBlocks)
+				{
+					Versions.Serialize(Ar);
+					int32 BlockCount = Blocks.Num();
+					Ar << BlockCount;
+					if (Ar.IsLoading())
+					{
+						if (Ar.IsError() || BlockCount < 0 || BlockCount > MaxSectionCount)
+						{
+							Ar.SetError();
+							return;
+						}
+						Blocks.SetNum(BlockCount);
+					}
+					for (FSaveSection& Block : Blocks)
+					{
+						Ar << Block.Type;
+						Ar << Block.Bytes;
+					}
+					Ar << bDimensionsChanged;
+				}
+				else
+				{
+					Ar << CoreImage;
+				}
+				Ar << bBaselineChanged;
+				if (bBaselineChanged)
+				{
+					Ar << BaselineActorIds;
+				}
+				Ar << ChangedRecords.Strings;
+				Ar << ChangedRecords.Records;
+				Ar << RemovedActorIds;
+			}
+		};
+
+		// Records are compared in their packed form, so changes below the save tolerances don't count
+		uint32 RecordChecksum(const FActorStateSaveData& State)
+		{
+			FPackedActorStateSaveData Packed;
+			ActorStateTable::Pack(TArray<FActorStateSaveData>{ State }, Packed);
+			uint32 Crc = FCrc::MemCrc32(Packed.Records.GetData(), Packed.Records.Num());
+			for (const FString& String : Packed.Strings)
+			{
+				Crc = FCrc::StrCrc32(*String, Crc);
+			}
+			return Crc;
+		}
+
+		uint32 BaselineChecksum(const TArray<FGuid>& BaselineActorIds)
+		{
+			return FCrc::MemCrc32(BaselineActorIds.GetData(), BaselineActorIds.Num() * sizeof(FGuid));
+		}
+
+		// Core block of a journal entry: the core image without the baseline (it is journaled separately)
+		bool SerializeCore(UGameSaveData* SaveData, TArray<uint8>& OutBytes)
+		{
+			TArray<FGuid> BaselineActorIds = MoveTemp(SaveData->BaselineActorIds);
+			SaveData->BaselineActorIds.Reset();
+
+			const bool bSuccess = WriteCoreImage(SaveData, OutBytes);
+
+			SaveData->BaselineActorIds = MoveTemp(BaselineActorIds);
+			return bSuccess;
+		}
+
+		// Player, inventory and dimension index blocks of SaveData, as the journal compares and writes them
+		void BuildJournalBlocks(UGameSaveData* SaveData, TArray<FSaveSection>& OutBlocks)
+		{
+			BuildPlayerSections(SaveData, OutBlocks);
+			BuildDimensionSections(SaveData, OutBlocks);
+		}
+
+		// Checksum of each block type; the dimension blocks are chained into one (zero when there are none)
+		TMap<uint8, uint32> ChecksumJournalBlocks(const TArray<FSaveSection>& Blocks)
+		{
+			TMap<uint8, uint32> Checksums;
+			Checksums.Add(static_cast<uint8>(ESaveSection::Dimension), 0);
+			for (const FSaveSection& Block : Blocks)
+			{
+				uint32& Crc = Checksums.FindOrAdd(Block.Type);
+				Crc = FCrc::MemCrc32(Block.Bytes.GetData(), Block.Bytes.Num(), Crc);
+			}
+			return Checksums;
+		}
+
+		// The save data an entry describes: a new object from its core block, with everything else copied over from
+		// Previous (so a corrupt entry leaves it intact) and then overwritten by the entry's other blocks that
+		// Sections selects. Records and baseline are left to the caller.
+		UGameSaveData* ApplyJournalBlocks(UGameSaveData* Previous, const FJournalEntry& Entry, ESaveSectionFlags Sections)
+		{
+			if (Entry.Blocks.Num() == 0 || Entry.Blocks[0].Type != static_cast<uint8>(ESaveSection::Core))
+			{
+				return nullptr;
+			}
+			UGameSaveData* SaveData = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromMemory(Entry.Blocks[0].Bytes));
+			if (!SaveData)
+			{
+				return nullptr;
+			}
+
+			SaveData->PlayerData = Previous->PlayerData;
+			SaveData->InventoryData = Previous->InventoryData;
+			SaveData->HotbarData = Previous->HotbarData;
+			SaveData->EquipmentData = Previous->EquipmentData;
+			const bool bReadDimensions = EnumHasAnyFlags(Sections, ESaveSectionFlags::Dimensions);
+			if (!Entry.bDimensionsChanged || !bReadDimensions)
+			{
+				SaveData->DimensionInstances = Previous->DimensionInstances;
+			}
+
+			for (int32 Index = 1; Index < Entry.Blocks.Num(); ++Index)
+			{
+				if (IsSectionWanted(Entry.Blocks[Index].Type, Sections)
+					&& !ApplySection(SaveData, Entry.Blocks[Index], Entry.Versions))
+				{
+					return nullptr;
+				}
+			}
+			return SaveData;
+		}
+
+		// Replay the journal entries that belong to SaveData's snapshot, as far as Sections selects (record changes
+		// only with the world actors); returns the resulting save data
+		UGameSaveData* ReplayJournal(const FString& SlotName, UGameSaveData* SaveData, ESaveSectionFlags Sections)
+		{
+			TArray<uint8> Bytes;
+			if (!SaveData->JournalBaseId.IsValid()
+				|| !FFileHelper::LoadFileToArray(Bytes, *GetSlotJournalPath(SlotName), FILEREAD_Silent))
+			{
+				return SaveData;
+			}
+
+			FMemoryReader Ar(Bytes);
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			FGuid BaseId;
+			Ar << Magic;
+			Ar << Version;
+			Ar << BaseId;
+			if (Ar.IsError() || Magic != JournalMagic || Version > JournalVersion || BaseId != SaveData->JournalBaseId)
+			{
+				// Left behind by a compaction that was cut short; the snapshot already holds everything
+				return SaveData;
+			}
+
+			int32 Replayed = 0;
+			while (Ar.Tell() + JournalEntryHeaderSize <= Ar.TotalSize())
+			{
+				uint32 PayloadSize = 0;
+				uint32 PayloadCrc = 0;
+				Ar << PayloadSize;
+				Ar << PayloadCrc;
+				const int64 PayloadOffset = Ar.Tell();
+				if (PayloadOffset + PayloadSize > Ar.TotalSize()
+					|| FCrc::MemCrc32(Bytes.GetData() + PayloadOffset, PayloadSize) != PayloadCrc)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Dropping torn journal entry %d in slot %s"), Replayed, *SlotName);
+					break;
+				}
+
+				TArray<uint8> Payload(Bytes.GetData() + PayloadOffset, PayloadSize);
+				Ar.Seek(PayloadOffset + PayloadSize);
+
+				FMemoryReader EntryAr(Payload);
+				FJournalEntry Entry;
+				Entry.Serialize(EntryAr, Version);
+				const bool bReadRecords = EnumHasAnyFlags(Sections, ESaveSectionFlags::WorldActors);
+				TArray<FActorStateSaveData> ChangedRecords;
+				UGameSaveData* Core = EntryAr.IsError() ? nullptr
+					: Version >= FirstJournalVersionWithBlocks ? ApplyJournalBlocks(SaveData, Entry, Sections)
+					: DeserializeSaveData(Entry.CoreImage);
+				if (!Core || (bReadRecords && !ActorStateTable::Unpack(Entry.ChangedRecords, ChangedRecords)))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt journal entry %d in slot %s"), Replayed, *SlotName);
+					break;
+				}
+
+				// Upsert in place so unchanged records keep their order
+				TArray<FActorStateSaveData> ActorStates = MoveTemp(SaveData->ActorStates);
+				TMap<FGuid, int32> IndexById;
+				IndexById.Reserve(ActorStates.Num());
+				for (int32 Index = 0; Index < ActorStates.Num(); ++Index)
+				{
+					IndexById.Add(ActorStates[Index].ActorId, Index);
+				}
+				for (FActorStateSaveData& Changed : ChangedRecords)
+				{
+					if (const int32* Existing = IndexById.Find(Changed.ActorId))
+					{
+						ActorStates[*Existing] = MoveTemp(Changed);
+					}
+					else
+					{
+						IndexById.Add(Changed.ActorId, ActorStates.Add(MoveTemp(Changed)));
+					}
+				}
+				if (bReadRecords && Entry.RemovedActorIds.Num() > 0)
+				{
+					const TSet<FGuid> Removed(Entry.RemovedActorIds);
+					ActorStates.RemoveAll([&Removed](const FActorStateSaveData& State) { return Removed.Contains(State.ActorId); });
+				}
+
+				Core->ActorStates = MoveTemp(ActorStates);
+				Core->BaselineActorIds = Entry.bBaselineChanged ? MoveTemp(Entry.BaselineActorIds) : MoveTemp(SaveData->BaselineActorIds);
+				SaveData = Core;
+				++Replayed;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("[SaveGameFile] Replayed %d journal entries for slot %s"), Replayed, *SlotName);
+			return SaveData;
+		}
+
+		// Offset of the newest complete entry's payload, or INDEX_NONE (payload checksums are not verified here)
+		int64 FindLatestJournalEntry(FArchive& Reader, const FGuid& ExpectedBaseId)
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			FGuid BaseId;
+			Reader << Magic;
+			Reader << Version;
+			Reader << BaseId;
+			if (Reader.IsError() || Magic != JournalMagic || Version > JournalVersion || !BaseId.IsValid() || BaseId != ExpectedBaseId)
+			{
+				return INDEX_NONE;
+			}
+
+			int64 Latest = INDEX_NONE;
+			while (Reader.Tell() + JournalEntryHeaderSize <= Reader.TotalSize())
+			{
+				uint32 PayloadSize = 0;
+				uint32 PayloadCrc = 0;
+				Reader << PayloadSize;
+				Reader << PayloadCrc;
+				if (Reader.IsError() || Reader.Tell() + PayloadSize > Reader.TotalSize())
+				{
+					break;
+				}
+				Latest = Reader.Tell();
+				Reader.Seek(Latest + PayloadSize);
+			}
+			return Latest;
+		}
+	}
+
+	FString GetSlotFilePath(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+	}
+
+	bool SerializeSaveData(UGameSaveData* SaveData, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+		if (!SaveData)
+		{
+			return false;
+		}
+
+		TArray<FSaveSection> Sections;
+		if (!BuildSections(SaveData, Sections))
+		{
+			return false;
+		}
+
+		FSaveFileHeader Header = MakeHeader(SaveData);
+
+		// Sections compress independently, so they go wide too
+		ParallelFor(Sections.Num(), [&Sections](int32 Index)
+		{
+			FSaveSection& Section = Sections[Index];
+			TArray<uint8> RawBytes = MoveTemp(Section.Bytes);
+			Section.UncompressedSize = RawBytes.Num();
+			Section.Method = static_cast<uint8>(CompressPayload(RawBytes, Section.Bytes));
+			Section.Size = Section.Bytes.Num();
+			Section.Crc = FCrc::MemCrc32(Section.Bytes.GetData(), Section.Bytes.Num());
+		});
+
+		for (const FSaveSection& Section : Sections)
+		{
+			Header.UncompressedSize += Section.UncompressedSize;
+			Header.CompressedSize += Section.Size;
+		}
+
+		TArray<uint8> HeaderBytes;
+		FMemoryWriter HeaderAr(HeaderBytes);
+		HeaderAr << Header;
+
+		FMemoryWriter Ar(OutBytes);
+		uint32 Magic = ContainerMagic;
+		uint32 Version = ContainerVersion;
+		uint32 HeaderSize = HeaderBytes.Num();
+		FSectionVersions Versions;
+		int32 SectionCount = Sections.Num();
+		Ar << Magic;
+		Ar << Version;
+		Ar << HeaderSize;
+		Ar.Serialize(HeaderBytes.GetData(), HeaderBytes.Num());
+		Versions.Serialize(Ar);
+		Ar << SectionCount;
+		for (FSaveSection& Section : Sections)
+		{
+			Ar << Section;
+		}
+		for (FSaveSection& Section : Sections)
+		{
+			Ar.Serialize(Section.Bytes.GetData(), Section.Bytes.Num());
+		}
+
+		return true;
+	}
+
+	UGameSaveData* DeserializeSaveData(const TArray<uint8>& Bytes)
+	{
+		if (Bytes.Num() < static_cast<int32>(sizeof(uint32)))
+		{
+			return nullptr;
+		}
+
+		FMemoryReader Ar(Bytes);
+		uint32 Magic = 0;
+		Ar << Magic;
+		if (Magic != ContainerMagic)
+		{
+			// Legacy file written by UGameplayStatics::SaveGameToSlot
+			return Cast<UGameSaveData>(UGameplayStatics::LoadGameFromMemory(Bytes));
+		}
+
+		uint32 Version = 0;
+		uint8 MethodValue = 0;
+		int64 UncompressedSize = 0;
+		Ar << Version;
+		if (Version >= FirstVersionWithHeader)
+		{
+			// The header only matters for slot listings; skip straight to the payload
+			uint32 HeaderSize = 0;
+			Ar << HeaderSize;
+			if (Ar.IsError() || HeaderSize > MaxHeaderSize)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt save container header"));
+				return nullptr;
+			}
+			Ar.Seek(Ar.Tell() + HeaderSize);
+		}
+		if (Version >= FirstVersionWithSections && Version <= ContainerVersion)
+		{
+			return DeserializeSections(Ar, ESaveSectionFlags::All);
+		}
+		Ar << MethodValue;
+		Ar << UncompressedSize;
+		if (Ar.IsError() || Version > ContainerVersion || UncompressedSize < 0 || UncompressedSize > MAX_int32)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Unsupported or corrupt save container (version %u)"), Version);
+			return nullptr;
+		}
+
+		const int64 PayloadOffset = Ar.Tell();
+		const uint8* Payload = Bytes.GetData() + PayloadOffset;
+		const int32 PayloadSize = Bytes.Num() - static_cast<int32>(PayloadOffset);
+
+		TArray<uint8> RawBytes;
+		if (!DecompressPayload(MethodValue, Payload, PayloadSize, UncompressedSize, RawBytes))
+		{
+			return nullptr;
+		}
+
+		UGameSaveData* SaveData = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromMemory(RawBytes));
+		if (!SaveData)
+		{
+			return nullptr;
+		}
+
+		bool bRecordsValid = UnpackActorStates(SaveData->ActorStates, SaveData->PackedActorStates);
+		for (FDimensionInstanceSaveData& Dimension : SaveData->DimensionInstances)
+		{
+			bRecordsValid &= UnpackActorStates(Dimension.ActorStates, Dimension.PackedActorStates);
+		}
+		return bRecordsValid ? SaveData : nullptr;
+	}
+
+	bool WriteSlotFileAtomic(const FString& SlotName, const TArray<uint8>& Bytes)
+	{
+		return WriteFileAtomic(GetSlotFilePath(SlotName), Bytes);
+	}
+
+	bool SaveToSlot(UGameSaveData* SaveData, const FString& SlotName)
+	{
+		if (!SaveData)
+		{
+			return false;
+		}
+
+		// Sidecar writing strips dimension actor states, so work on a copy and leave the caller's data whole
+		UGameSaveData* FileData = SaveData->DimensionInstances.Num() > 0 ? SaveData->CreateSnapshot(nullptr) : SaveData;
+
+		// A plain snapshot; any journal left for the slot no longer applies to it
+		FileData->JournalBaseId.Invalidate();
+
+		TArray<uint8> Bytes;
+		if (!WriteDimensionSidecars(FileData, SlotName)
+			|| !SerializeSaveData(FileData, Bytes)
+			|| !WriteSlotFileAtomic(SlotName, Bytes))
+		{
+			return false;
+		}
+
+		DeleteSlotJournal(SlotName);
+		return true;
+	}
+
+	UGameSaveData* LoadFromSlot(const FString& SlotName)
+	{
+		return ReadSections(SlotName, ESaveSectionFlags::All);
+	}
+
+	UGameSaveData* ReadSections(const FString& SlotName, ESaveSectionFlags Sections)
+	{
+		UGameSaveData* SaveData = nullptr;
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetSlotFilePath(SlotName), FILEREAD_Silent));
+		if (!Reader)
+		{
+			return nullptr;
+		}
+		if (SeekToSectionTable(*Reader))
+		{
+			SaveData = DeserializeSections(*Reader, Sections);
+		}
+		else
+		{
+			// Older containers and legacy files are a single payload; there is nothing to skip
+			Reader.Reset();
+			TArray<uint8> Bytes;
+			if (!FFileHelper::LoadFileToArray(Bytes, *GetSlotFilePath(SlotName), FILEREAD_Silent))
+			{
+				return nullptr;
+			}
+			SaveData = DeserializeSaveData(Bytes);
+		}
+
+		if (SaveData)
+		{
+			SaveData = ReplayJournal(SlotName, SaveData, Sections);
+
+			// Dimension actor states stay on disk until their dimension is streamed in
+			SaveData->SidecarSlotName = SlotName;
+			for (FDimensionInstanceSaveData& Dimension : SaveData->DimensionInstances)
+			{
+				Dimension.bActorStatesResident = !Dimension.bStoredInSidecar;
+			}
+		}
+		return SaveData;
+	}
+
+	bool ReadSlotHeader(const FString& SlotName, FSaveFileHeader& OutHeader)
+	{
+		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetSlotFilePath(SlotName), FILEREAD_Silent));
+		if (!Reader)
+		{
+			return false;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint32 HeaderSize = 0;
+		*Reader << Magic;
+		if (Reader->IsError() || Magic != ContainerMagic)
+		{
+			return false;
+		}
+		*Reader << Version;
+		if (Version < FirstVersionWithHeader || Version > ContainerVersion)
+		{
+			return false;
+		}
+		*Reader << HeaderSize;
+		if (Reader->IsError() || HeaderSize > MaxHeaderSize)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SaveGameFile] Corrupt header in slot: %s"), *SlotName);
+			return false;
+		}
+
+		// Only the header bytes are read from disk; the payload is never touched
+		TArray<uint8> HeaderBytes;
+		HeaderBytes.SetNumUninitialized(HeaderSize);
+		Reader->Serialize(HeaderBytes.GetData(), HeaderSize);
+		if (Reader->IsError())
+		{
+			return false;
+		}
+
+		FMemoryReader HeaderAr(HeaderBytes);
+		HeaderAr << OutHeader;
+		if (HeaderAr.IsError())
+		{
+			return false;
+		}
+
+		// Quicksaves since the snapshot only touched the journal; its newest entry describes the slot
+		if (OutHeader.JournalBaseId.IsValid())
+		{
+			TUniquePtr<FArchive> JournalReader(IFileManager::Get().CreateFileReader(*GetSlotJournalPath(SlotName), FILEREAD_Silent));
+			const int64 LatestEntry = JournalReader ? FindLatestJournalEntry(*JournalReader, OutHeader.JournalBaseId) : INDEX_NONE;
+			if (LatestEntry != INDEX_NONE)
+			{
+				FSaveFileHeader EntryHeader;
+				JournalReader->Seek(LatestEntry);
+				*JournalReader << EntryHeader;
+				if (!JournalReader->IsError())
+				{
+					EntryHeader.UncompressedSize = OutHeader.UncompressedSize;
+					EntryHeader.CompressedSize = OutHeader.CompressedSize;
+					OutHeader = EntryHeader;
+				}
+			}
+		}
+		return true;
+	}
+
+	FSaveFileHeader MakeHeader(const UGameSaveData* SaveData)
+	{
+		FSaveFileHeader Header;
+		if (SaveData)
+		{
+			Header.SaveName = SaveData->SaveName;
+			Header.Timestamp = SaveData->Timestamp;
+			Header.LevelPackagePath = SaveData->LevelPackagePath;
+			Header.PlaytimeSeconds = SaveData->PlaytimeSeconds;
+			Header.ActorStateCount = SaveData->ActorStates.Num();
+			Header.DimensionInstanceCount = SaveData->DimensionInstances.Num();
+			Header.JournalBaseId = SaveData->JournalBaseId;
+		}
+		return Header;
+	}
+
+	FString GetDimensionSidecarDir(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT("_Dimensions"));
+	}
+
+	FString GetDimensionSidecarPath(const FString& SlotName, const FGuid& InstanceId)
+	{
+		return GetDimensionSidecarDir(SlotName) / (InstanceId.ToString(EGuidFormats::Digits) + TEXT(".dim"));
+	}
+
+	bool WriteDimensionSidecars(UGameSaveData* SaveData, const FString& SlotName, FSaveJournalState* State)
+	{
+		if (!SaveData)
+		{
+			return false;
+		}
+
+		// Checksums only describe the slot the state was last written for
+		TMap<FGuid, uint32>* Checksums = State && State->SlotName == SlotName ? &State->SidecarChecksums : nullptr;
+		TSet<FGuid> LiveInstanceIds;
+
+		TSet<FString> LiveFiles;
+		for (FDimensionInstanceSaveData& Dimension : SaveData->DimensionInstances)
+		{
+			if (!Dimension.InstanceId.IsValid())
+			{
+				continue;
+			}
+			LiveInstanceIds.Add(Dimension.InstanceId);
+
+			if (Dimension.bActorStatesResident)
+			{
+				TArray<uint8> RawBytes;
+				SerializeDimensionSidecar(Dimension, RawBytes);
+				const uint32 Checksum = FCrc::MemCrc32(RawBytes.GetData(), RawBytes.Num());
+
+				// Unchanged since the last save of this slot: the file on disk already holds exactly this
+				const uint32* Previous = Checksums ? Checksums->Find(Dimension.InstanceId) : nullptr;
+				if (!Previous || *Previous != Checksum
+					|| !IFileManager::Get().FileExists(*GetDimensionSidecarPath(SlotName, Dimension.InstanceId)))
+				{
+					if (!SaveDimensionSidecar(SlotName, Dimension.InstanceId, RawBytes))
+					{
+						if (Checksums)
+						{
+							Checksums->Remove(Dimension.InstanceId);
+						}
+						return false;
+					}
+					if (Checksums)
+					{
+						Checksums->Add(Dimension.InstanceId, Checksum);
+					}
+				}
+				Dimension.ActorStates.Empty();
+				Dimension.BaselineActorIds.Empty();
+				Dimension.bStoredInSidecar = true;
+			}
+			else if (SaveData->SidecarSlotName != SlotName)
+			{
+				// Copied in from another slot; its contents are unknown here
+				if (Checksums)
+				{
+					Checksums->Remove(Dimension.InstanceId);
+				}
+				if (!CopyDimensionSidecar(SaveData->SidecarSlotName, SlotName, Dimension.InstanceId))
+				{
+					return false;
+				}
+			}
+
+			LiveFiles.Add(FPaths::GetCleanFilename(GetDimensionSidecarPath(SlotName, Dimension.InstanceId)));
+		}
+
+		// Drop sidecars of dimensions that are no longer part of this save
+		TArray<FString> ExistingFiles;
+		IFileManager::Get().FindFiles(ExistingFiles, *(GetDimensionSidecarDir(SlotName) / TEXT("*.dim")), true, false);
+		for (const FString& FileName : ExistingFiles)
+		{
+			if (!LiveFiles.Contains(FileName))
+			{
+				IFileManager::Get().Delete(*(GetDimensionSidecarDir(SlotName) / FileName), false, false, true);
+			}
+		}
+		if (Checksums)
+		{
+			for (auto It = Checksums->CreateIterator(); It; ++It)
+			{
+				if (!LiveInstanceIds.Contains(It.Key()))
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool EnsureDimensionResident(const UGameSaveData* SaveData, FDimensionInstanceSaveData& Dimension)
+	{
+		if (Dimension.bActorStatesResident)
+		{
+			return true;
+		}
+
+		Dimension.bActorStatesResident = true;
+
+		FDimensionInstanceSaveData Loaded;
+		if (!SaveData || !LoadDimensionSidecar(SaveData->SidecarSlotName, Dimension.InstanceId, Loaded))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Missing or corrupt sidecar for dimension %s in slot %s - its saved state is lost"),
+				*Dimension.InstanceId.ToString(), SaveData ? *SaveData->SidecarSlotName : TEXT("None"));
+			return false;
+		}
+
+		Dimension.ActorStates = MoveTemp(Loaded.ActorStates);
+		Dimension.BaselineActorIds = MoveTemp(Loaded.BaselineActorIds);
+		UE_LOG(LogTemp, Log, TEXT("[SaveGameFile] Loaded sidecar for dimension %s: %d actor states"),
+			*Dimension.InstanceId.ToString(), Dimension.ActorStates.Num());
+		return true;
+	}
+
+	bool ReadDimensionSidecar(const FString& SlotName, const FGuid& InstanceId, FDimensionInstanceSaveData& OutDimension)
+	{
+		return LoadDimensionSidecar(SlotName, InstanceId, OutDimension);
+	}
+
+	void DeleteDimensionSidecars(const FString& SlotName)
+	{
+		IFileManager::Get().DeleteDirectory(*GetDimensionSidecarDir(SlotName), false, true);
+	}
+
+	FString GetSlotJournalPath(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".journal"));
+	}
+
+	bool WriteJournalSnapshot(UGameSaveData* SaveData, const FString& SlotName, FSaveJournalState& OutState)
+	{
+		OutState.SlotName = SlotName;
+		OutState.BaseId.Invalidate();
+		if (!SaveData || OutState.bAbandoned)
+		{
+			return false;
+		}
+
+		const FGuid BaseId = FGuid::NewGuid();
+		SaveData->JournalBaseId = BaseId;
+
+		TArray<uint8> Bytes;
+		if (!SerializeSaveData(SaveData, Bytes))
+		{
+			return false;
+		}
+
+		TArray<uint8> JournalBytes;
+		FMemoryWriter Ar(JournalBytes);
+		uint32 Magic = JournalMagic;
+		uint32 Version = JournalVersion;
+		FGuid JournalBaseId = BaseId;
+		Ar << Magic;
+		Ar << Version;
+		Ar << JournalBaseId;
+
+		const FString SlotPath = GetSlotFilePath(SlotName);
+		const FString JournalPath = GetSlotJournalPath(SlotName);
+		if (!WriteTempFile(SlotPath, Bytes) || !WriteTempFile(JournalPath, JournalBytes))
+		{
+			return false;
+		}
+		{
+			FScopeLock CommitScope(&OutState.CommitLock);
+			if (OutState.bAbandoned)
+			{
+				UE_LOG(LogTemp, Log, TEXT("[SaveGameFile] Dropping snapshot of abandoned slot: %s"), *SlotName);
+				IFileManager::Get().Delete(*(SlotPath + TEXT(".tmp")), false, false, true);
+				IFileManager::Get().Delete(*(JournalPath + TEXT(".tmp")), false, false, true);
+				return false;
+			}
+
+			// The snapshot is in place first: a crash before the journal is reset leaves an old journal whose
+			// BaseId no longer matches, which loading ignores
+			if (!CommitTempFile(SlotPath) || !CommitTempFile(JournalPath))
+			{
+				return false;
+			}
+		}
+		OutState.SnapshotBytes = Bytes.Num();
+
+		OutState.RecordChecksums.Reset();
+		OutState.RecordChecksums.Reserve(SaveData->ActorStates.Num());
+		for (const FActorStateSaveData& State : SaveData->ActorStates)
+		{
+			OutState.RecordChecksums.Add(State.ActorId, RecordChecksum(State));
+		}
+		OutState.BaselineChecksum = BaselineChecksum(SaveData->BaselineActorIds);
+		TArray<FSaveSection> Blocks;
+		BuildJournalBlocks(SaveData, Blocks);
+		OutState.BlockChecksums = ChecksumJournalBlocks(Blocks);
+		OutState.JournalBytes = JournalBytes.Num();
+		OutState.EntryCount = 0;
+		OutState.BaseId = BaseId;
+		return true;
+	}
+
+	bool AppendJournalEntry(UGameSaveData* SaveData, const TSet<FGuid>& RecapturedActorIds, FSaveJournalState& State)
+	{
+		if (!SaveData || !State.BaseId.IsValid() || State.bAbandoned)
+		{
+			return false;
+		}
+
+		// Anything that fails from here leaves the journal in an unknown state; only a snapshot recovers it
+		const FGuid BaseId = State.BaseId;
+		State.BaseId.Invalidate();
+
+		SaveData->JournalBaseId = BaseId;
+
+		FJournalEntry Entry;
+		Entry.Header = MakeHeader(SaveData);
+
+		const uint32 NewBaselineChecksum = BaselineChecksum(SaveData->BaselineActorIds);
+		Entry.bBaselineChanged = NewBaselineChecksum != State.BaselineChecksum;
+		if (Entry.bBaselineChanged)
+		{
+			Entry.BaselineActorIds = SaveData->BaselineActorIds;
+		}
+
+		// Only recaptured records can differ from what was last written, so only they are packed and compared; the
+		// rest just have to be known. A new baseline changes what every record says about itself, so then all are.
+		TSet<FGuid> CurrentActorIds;
+		CurrentActorIds.Reserve(SaveData->ActorStates.Num());
+		TArray<FActorStateSaveData> ChangedRecords;
+		for (const FActorStateSaveData& Record : SaveData->ActorStates)
+		{
+			CurrentActorIds.Add(Record.ActorId);
+			uint32* Previous = State.RecordChecksums.Find(Record.ActorId);
+			if (Previous && !Entry.bBaselineChanged && !RecapturedActorIds.Contains(Record.ActorId))
+			{
+				continue;
+			}
+
+			const uint32 Checksum = RecordChecksum(Record);
+			if (!Previous || *Previous != Checksum)
+			{
+				State.RecordChecksums.Add(Record.ActorId, Checksum);
+				ChangedRecords.Add(Record);
+			}
+		}
+		for (auto It = State.RecordChecksums.CreateIterator(); It; ++It)
+		{
+			if (!CurrentActorIds.Contains(It.Key()))
+			{
+				Entry.RemovedActorIds.Add(It.Key());
+				It.RemoveCurrent();
+			}
+		}
+		ActorStateTable::Pack(ChangedRecords, Entry.ChangedRecords);
+
+		// The core block always goes in (the timestamp and playtime change every save); the player, inventory and
+		// dimension blocks only when their bytes differ from what the journal last wrote
+		TArray<uint8> CoreBytes;
+		if (!SerializeCore(SaveData, CoreBytes))
+		{
+			return false;
+		}
+		FSaveSection& CoreBlock = Entry.Blocks.AddDefaulted_GetRef();
+		CoreBlock.Type = static_cast<uint8>(ESaveSection::Core);
+		CoreBlock.Bytes = MoveTemp(CoreBytes);
+
+		TArray<FSaveSection> Blocks;
+		BuildJournalBlocks(SaveData, Blocks);
+		TMap<uint8, uint32> BlockChecksums = ChecksumJournalBlocks(Blocks);
+		auto IsBlockChanged = [&State, &BlockChecksums](uint8 Type)
+		{
+			const uint32* Previous = State.BlockChecksums.Find(Type);
+			return !Previous || *Previous != BlockChecksums.FindRef(Type);
+		};
+		Entry.bDimensionsChanged = IsBlockChanged(static_cast<uint8>(ESaveSection::Dimension));
+		for (FSaveSection& Block : Blocks)
+		{
+			if (IsBlockChanged(Block.Type))
+			{
+				Entry.Blocks.Add(MoveTemp(Block));
+			}
+		}
+
+		TArray<uint8> Payload;
+		FMemoryWriter PayloadAr(Payload);
+		Entry.Serialize(PayloadAr, JournalVersion);
+
+		TArray<uint8> Bytes;
+		FMemoryWriter Ar(Bytes);
+		uint32 PayloadSize = Payload.Num();
+		uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+		Ar << PayloadSize;
+		Ar << PayloadCrc;
+		Ar.Serialize(Payload.GetData(), Payload.Num());
+
+		// One write at the end of the file; a crash mid-write leaves a torn entry that loading drops
+		FScopeLock CommitScope(&State.CommitLock);
+		if (State.bAbandoned)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[SaveGameFile] Dropping journal entry of abandoned slot: %s"), *State.SlotName);
+			return false;
+		}
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetSlotJournalPath(State.SlotName), FILEWRITE_Append));
+		if (!Writer || Writer->TotalSize() < JournalFileHeaderSize)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Missing journal for slot: %s"), *State.SlotName);
+			return false;
+		}
+		Writer->Serialize(Bytes.GetData(), Bytes.Num());
+		const bool bWritten = Writer->Close() && !Writer->IsError();
+		if (!bWritten)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[SaveGameFile] Failed to append to journal of slot: %s"), *State.SlotName);
+			return false;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[SaveGameFile] Journaled %d changed and %d removed records and %d blocks for slot %s (%d bytes)"),
+			ChangedRecords.Num(), Entry.RemovedActorIds.Num(), Entry.Blocks.Num(), *State.SlotName, Bytes.Num());
+
+		State.BlockChecksums = MoveTemp(BlockChecksums);
+		State.BaselineChecksum = NewBaselineChecksum;
+		State.JournalBytes += Bytes.Num();
+		++State.EntryCount;
+		State.BaseId = BaseId;
+		return true;
+	}
+
+	bool ShouldCompactJournal(const FSaveJournalState& State)
+	{
+		return State.BaseId.IsValid() && State.JournalBytes > FMath::Max(JournalCompactionMinBytes, State.SnapshotBytes);
+	}
+
+	void DeleteSlotJournal(const FString& SlotName)
+	{
+		IFileManager::Get().Delete(*GetSlotJournalPath(SlotName), false, false, true);
+	}
+}
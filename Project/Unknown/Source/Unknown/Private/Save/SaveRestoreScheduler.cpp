@@ -0,0 +1,50 @@
+#include "Save/SaveRestoreScheduler.h"
+#include "HAL/PlatformTime.h"
+
+void FSaveRestoreScheduler::AddPhase(int32 Count, TFunction<void(int32)> Work)
+{
+	if (Count <= 0 || !Work)
+	{
+		return;
+	}
+
+	Phases.Add(FPhase{ Count, MoveTemp(Work) });
+	NumItems += Count;
+}
+
+void FSaveRestoreScheduler::AddStep(TFunction<void()> Work)
+{
+	if (!Work)
+	{
+		return;
+	}
+
+	AddPhase(1, [Work = MoveTemp(Work)](int32) { Work(); });
+}
+
+bool FSaveRestoreScheduler::Tick(double BudgetSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	while (PhaseIndex < Phases.Num())
+	{
+		FPhase& Phase = Phases[PhaseIndex];
+		Phase.Work(ItemIndex);
+		NumProcessed++;
+
+		if (++ItemIndex >= Phase.Count)
+		{
+			// Release whatever the finished phase captured
+			Phase.Work = nullptr;
+			PhaseIndex++;
+			ItemIndex = 0;
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	return IsComplete();
+}
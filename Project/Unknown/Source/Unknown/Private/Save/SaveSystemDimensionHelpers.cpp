@@ -2,17 +2,34 @@
 #include "Save/GameSaveData.h"
 #include "Dimensions/DimensionManagerSubsystem.h"
 #include "Components/SaveableActorComponent.h"
+#include "Save/SaveableActorRegistry.h"
+#include "Save/SaveableActorSpatialIndex.h"
 #include "Inventory/ItemPickup.h"
 #include "Inventory/StorageComponent.h"
 #include "Inventory/StorageSerialization.h"
 #include "Inventory/ItemDefinition.h"
 #include "Save/SaveSystemHelpers.h"
+#include "Save/SaveGameFile.h"
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Engine/Level.h"
 #include "EngineUtils.h"
 
+// Metadata candidates near a saved level-local location; candidates may be indexed in world or level-local space
+static void GatherDimensionCandidates(
+	const FSaveableActorSpatialIndex& SpatialIndex,
+	const FString& ClassPath,
+	const FVector& SavedLocation,
+	const FVector& DimensionWorldPos,
+	float Tolerance,
+	TArray<AActor*>& OutCandidates)
+{
+	const FName ClassPathName = FSaveableActorSpatialIndex::InternClassPath(ClassPath);
+	SpatialIndex.Query(ClassPathName, SavedLocation, Tolerance, OutCandidates);
+	SpatialIndex.Query(ClassPathName, SavedLocation + DimensionWorldPos, Tolerance, OutCandidates);
+}
+
 bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 	UWorld* World,
 	UGameSaveData* SaveData,
@@ -53,8 +70,11 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 		DimensionSaveData = &SaveData->DimensionInstances.Last();
 	}
 
+	// The baseline and previous states are needed below; pull them in if the dimension was never streamed in
+	SaveGameFile::EnsureDimensionResident(SaveData, *DimensionSaveData);
+
 	// Get dimension instance info
-	FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+	FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 	if (InstanceInfo.InstanceId == InstanceId)
 	{
 		DimensionSaveData->CartridgeId = InstanceInfo.CartridgeId;
@@ -75,6 +95,10 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 	// Save all actors in the dimension level
 	DimensionSaveData->ActorStates.Empty();
 	TArray<FGuid> CurrentActorIds;
+	const TSet<FGuid> BaselineActorIdSet(DimensionSaveData->BaselineActorIds);
+
+	// Clean actors reuse the record captured by an earlier save of this dimension
+	USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World);
 
 	for (AActor* Actor : DimensionLevel->Actors)
 	{
@@ -103,6 +127,22 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 
 		CurrentActorIds.Add(ActorId);
 
+		// Check if this is a new object
+		bool bIsInBaseline = BaselineActorIdSet.Num() > 0 && BaselineActorIdSet.Contains(ActorId);
+		bool bIsNewObject = BaselineActorIdSet.Num() > 0 && !bIsInBaseline;
+
+		if (const FActorStateSaveData* CapturedState = Registry ? Registry->FindCapturedState(SaveableComp) : nullptr)
+		{
+			FActorStateSaveData& ReusedState = DimensionSaveData->ActorStates.Add_GetRef(*CapturedState);
+			ReusedState.bIsNewObject = bIsNewObject;
+			ReusedState.SpawnActorClassPath = bIsNewObject ? ReusedState.ActorClassPath : FString();
+			if (SaveSystemHelpers::RecaptureActorComponents(Actor, ReusedState))
+			{
+				Registry->StoreCapturedState(SaveableComp, ReusedState);
+			}
+			continue;
+		}
+
 		// Create actor state data
 		FActorStateSaveData ActorState;
 		ActorState.ActorId = ActorId;
@@ -184,11 +224,6 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 		
 		ActorState.OriginalSpawnTransform = LocalTransform;
 
-		// Check if this is a new object
-		bool bIsInBaseline = DimensionSaveData->BaselineActorIds.Num() > 0 && 
-			DimensionSaveData->BaselineActorIds.Contains(ActorId);
-		bool bIsNewObject = DimensionSaveData->BaselineActorIds.Num() > 0 && !bIsInBaseline;
-		
 		if (bIsNewObject)
 		{
 			ActorState.bIsNewObject = true;
@@ -219,15 +254,8 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 			}
 		}
 
-		// Save storage component data
-		UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-		if (StorageComp)
-		{
-			ActorState.bHasStorage = true;
-			TArray<FItemEntry> StorageEntries = StorageComp->GetEntries();
-			ActorState.SerializedStorageEntries = StorageSerialization::SerializeStorageEntries(StorageEntries);
-			ActorState.StorageMaxVolume = StorageComp->MaxVolume;
-		}
+		// Save component state (storage contents and any other SaveGame properties)
+		SaveSystemHelpers::CaptureActorComponents(Actor, ActorState);
 
 		// Save ItemPickup data
 		AItemPickup* ItemPickup = Cast<AItemPickup>(Actor);
@@ -241,6 +269,10 @@ bool SaveSystemDimensionHelpers::SaveDimensionInstance(
 			}
 		}
 
+		if (Registry)
+		{
+			Registry->StoreCapturedState(SaveableComp, ActorState);
+		}
 		DimensionSaveData->ActorStates.Add(ActorState);
 	}
 
@@ -388,7 +420,7 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		// Create new save data entry
 		FDimensionInstanceSaveData NewDimData;
 		NewDimData.InstanceId = InstanceId;
-		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 		if (InstanceInfo.InstanceId == InstanceId)
 		{
 			NewDimData.CartridgeId = InstanceInfo.CartridgeId;
@@ -460,6 +492,9 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		return true;
 	}
 
+	// Actor states are kept in a sidecar until the dimension is first streamed in
+	SaveGameFile::EnsureDimensionResident(SaveData, *DimensionSaveData);
+
 	// Check if baseline is empty (shouldn't happen, but handle it)
 	if (DimensionSaveData->BaselineActorIds.Num() == 0)
 	{
@@ -498,7 +533,7 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 			// Convert to level-local space immediately for consistency
 			if (SaveableComp->OriginalTransform.GetLocation().IsNearlyZero())
 			{
-				FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+				FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 				FTransform WorldTransform = Actor->GetActorTransform();
 				FVector DimensionWorldPos = InstanceInfo.WorldPosition;
 				FTransform LocalTransform = WorldTransform;
@@ -529,6 +564,17 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 	int32 RestoredCount = 0;
 	int32 NewObjectSpawnedCount = 0;
 
+	// Saves with deterministic IDs match every record exactly by ID (TagActorsInDimension derived the same IDs);
+	// older saves still fall back to matching by class and original transform
+	const bool bMatchByMetadata = !SaveData->bDeterministicActorIds;
+
+	// Spatial hash of the dimension's saveable actors for metadata fallback matching, built once for the whole restore
+	FSaveableActorSpatialIndex SpatialIndex;
+	if (bMatchByMetadata)
+	{
+		SpatialIndex.AddLevelActors(DimensionLevel);
+	}
+
 	// === STEP 1: Destroy removed actors ===
 	// Destroy actors that are marked as not existing in the save
 	// (GUIDs should have been restored in STEP 1.5)
@@ -543,14 +589,15 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		AActor* ActorToRemove = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 		
 		// If not found by GUID, try metadata fallback
-		if (!ActorToRemove && !ActorState.ActorClassPath.IsEmpty() && !ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
+		if (!ActorToRemove && bMatchByMetadata && !ActorState.ActorClassPath.IsEmpty() && !ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
 		{
 			ActorToRemove = USaveableActorComponent::FindActorByGuidOrMetadata(
 				World,
 				ActorState.ActorId,
 				ActorState.ActorClassPath,
 				ActorState.OriginalSpawnTransform,
-				10.0f
+				10.0f,
+				&SpatialIndex
 			);
 		}
 		
@@ -605,9 +652,16 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 			EarlyGUIDRestoredCount++;
 			continue;
 		}
+
+		if (!bMatchByMetadata)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SaveSystemDimension] STEP 1.5: Could not find baseline actor %s (class: %s) in level"), 
+				*ActorState.ActorId.ToString(), *ActorState.ActorClassPath);
+			continue;
+		}
 		
 		// If not found, try metadata fallback matching
-		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+		FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 		FVector DimensionWorldPos = InstanceInfo.WorldPosition;
 		FVector SavedLocation = ActorState.OriginalSpawnTransform.GetLocation();
 		
@@ -620,13 +674,12 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		int32 CandidatesWithDimensionID = 0;
 		int32 CandidatesWithTransformCheck = 0;
 		
-		for (AActor* Candidate : DimensionLevel->Actors)
+		// Only actors of the saved class within tolerance of the saved location are considered
+		TArray<AActor*> Candidates;
+		GatherDimensionCandidates(SpatialIndex, ActorState.ActorClassPath, SavedLocation, DimensionWorldPos, 100.0f, Candidates);
+		
+		for (AActor* Candidate : Candidates)
 		{
-			if (!Candidate)
-			{
-				continue;
-			}
-			
 			CandidatesChecked++;
 			
 			if (MatchedActors.Contains(Candidate))
@@ -635,16 +688,6 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 				continue;
 			}
 			
-			// Check if class path matches
-			FString CandidateClassPath = Candidate->GetClass()->GetPathName();
-			UE_LOG(LogTemp, Log, TEXT("[SaveSystemDimension] STEP 1.5: Checking candidate %s (class: %s, expected: %s)"), 
-				*Candidate->GetName(), *CandidateClassPath, *ActorState.ActorClassPath);
-			
-			if (CandidateClassPath != ActorState.ActorClassPath)
-			{
-				continue;
-			}
-			
 			CandidatesWithClassMatch++;
 			UE_LOG(LogTemp, Log, TEXT("[SaveSystemDimension] STEP 1.5: Candidate %s has matching class"), *Candidate->GetName());
 			
@@ -792,8 +835,8 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 	int32 RemovedActorGUIDRestoredCount = 0;
 	for (const FActorStateSaveData& ActorState : DimensionSaveData->ActorStates)
 	{
-		// Only handle removed actors
-		if (ActorState.bExists || ActorState.ActorClassPath.IsEmpty() || ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
+		// Only handle removed actors (exact IDs need no restoring)
+		if (!bMatchByMetadata || ActorState.bExists || ActorState.ActorClassPath.IsEmpty() || ActorState.OriginalSpawnTransform.GetLocation().IsNearlyZero())
 		{
 			continue;
 		}
@@ -805,16 +848,13 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		}
 		
 		// Find actor by metadata to restore its GUID
-		for (AActor* Candidate : DimensionLevel->Actors)
+		TArray<AActor*> Candidates;
+		GatherDimensionCandidates(SpatialIndex, ActorState.ActorClassPath, ActorState.OriginalSpawnTransform.GetLocation(),
+			DimensionManager->GetInstanceInfo(InstanceId).WorldPosition, 50.0f, Candidates);
+		
+		for (AActor* Candidate : Candidates)
 		{
-			if (!Candidate || MatchedActors.Contains(Candidate))
-			{
-				continue;
-			}
-			
-			// Check if class path matches
-			FString CandidateClassPath = Candidate->GetClass()->GetPathName();
-			if (CandidateClassPath != ActorState.ActorClassPath)
+			if (MatchedActors.Contains(Candidate))
 			{
 				continue;
 			}
@@ -837,7 +877,7 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 			
 			// Check if transform matches (within tolerance)
 			// Convert to level-local space for comparison
-			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 			FVector DimensionWorldPos = InstanceInfo.WorldPosition;
 			FVector SavedLocation = ActorState.OriginalSpawnTransform.GetLocation();
 			FVector CandidateLocation = TransformToCompare.GetLocation();
@@ -950,13 +990,13 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		
 		// If not found by GUID, try metadata lookup (but only for baseline actors to avoid false matches)
 		// This is a fallback for when STEP 1.5 didn't match the actor (e.g., after save/load when GUIDs are lost)
-		if (!Actor && bIsInBaseline && !ActorState.ActorClassPath.IsEmpty())
+		if (!Actor && bMatchByMetadata && bIsInBaseline && !ActorState.ActorClassPath.IsEmpty())
 		{
 			UE_LOG(LogTemp, Log, TEXT("[SaveSystemDimension] STEP 2: Trying metadata matching for baseline actor %s"), *ActorState.ActorId.ToString());
 			
 			// For baseline actors, try to find by metadata in the dimension level
 			// This handles cases where the level was reloaded and actors don't have GUIDs yet
-			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 			FVector DimensionWorldPos = InstanceInfo.WorldPosition;
 			FVector SavedLocation = ActorState.OriginalSpawnTransform.GetLocation();
 			
@@ -969,13 +1009,11 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 			int32 CandidatesWithDimensionID = 0;
 			int32 CandidatesWithTransformCheck = 0;
 			
-			for (AActor* Candidate : DimensionLevel->Actors)
+			TArray<AActor*> Candidates;
+			GatherDimensionCandidates(SpatialIndex, ActorState.ActorClassPath, SavedLocation, DimensionWorldPos, 100.0f, Candidates);
+			
+			for (AActor* Candidate : Candidates)
 			{
-				if (!Candidate)
-				{
-					continue;
-				}
-				
 				CandidatesChecked++;
 				
 				if (MatchedActors.Contains(Candidate))
@@ -984,16 +1022,6 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 					continue;
 				}
 				
-				// Check if class path matches
-				FString CandidateClassPath = Candidate->GetClass()->GetPathName();
-				UE_LOG(LogTemp, Log, TEXT("[SaveSystemDimension] STEP 2: Checking candidate %s (class: %s, expected: %s)"), 
-					*Candidate->GetName(), *CandidateClassPath, *ActorState.ActorClassPath);
-				
-				if (CandidateClassPath != ActorState.ActorClassPath)
-				{
-					continue;
-				}
-				
 				CandidatesWithClassMatch++;
 				UE_LOG(LogTemp, Log, TEXT("[SaveSystemDimension] STEP 2: Candidate %s has matching class"), *Candidate->GetName());
 				
@@ -1169,12 +1197,28 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		bool bShouldSpawn = !Actor && bIsNewObject && (!ActorState.SpawnActorClassPath.IsEmpty() || !ActorState.ActorClassPath.IsEmpty());
 		
 		// Double-check: if it's a new object, make sure it doesn't already exist with a different GUID
-		if (bShouldSpawn)
+		// (with deterministic IDs an earlier copy keeps its saved ID and was already found above)
+		if (bShouldSpawn && bMatchByMetadata)
 		{
 			// Check if an actor with this class and transform already exists (might have been spawned before)
-			for (AActor* ExistingActor : DimensionLevel->Actors)
+			// Actors spawned by this restore are not in the index, so they can't be mistaken for earlier copies
+			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
+			FVector DimensionWorldPos = InstanceInfo.WorldPosition;
+			FVector SavedWorldLocation = ActorState.OriginalSpawnTransform.GetLocation() + DimensionWorldPos;
+			
+			TArray<AActor*> ExistingCandidates;
+			if (!ActorState.SpawnActorClassPath.IsEmpty())
+			{
+				SpatialIndex.Query(FSaveableActorSpatialIndex::InternClassPath(ActorState.SpawnActorClassPath), SavedWorldLocation, 100.0f, ExistingCandidates);
+			}
+			if (!ActorState.ActorClassPath.IsEmpty())
 			{
-				if (!ExistingActor || MatchedActors.Contains(ExistingActor))
+				SpatialIndex.Query(FSaveableActorSpatialIndex::InternClassPath(ActorState.ActorClassPath), SavedWorldLocation, 100.0f, ExistingCandidates);
+			}
+			
+			for (AActor* ExistingActor : ExistingCandidates)
+			{
+				if (MatchedActors.Contains(ExistingActor))
 				{
 					continue;
 				}
@@ -1185,18 +1229,8 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 					continue;
 				}
 				
-				// Check if class matches
-				if (ExistingActor->GetClass()->GetPathName() != ActorState.SpawnActorClassPath && 
-					ExistingActor->GetClass()->GetPathName() != ActorState.ActorClassPath)
-				{
-					continue;
-				}
-				
 				// Check if transform is close (within 100cm)
 				FVector ExistingLocation = ExistingActor->GetActorLocation();
-				FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
-				FVector DimensionWorldPos = InstanceInfo.WorldPosition;
-				FVector SavedWorldLocation = ActorState.OriginalSpawnTransform.GetLocation() + DimensionWorldPos;
 				FVector LocationDelta = ExistingLocation - SavedWorldLocation;
 				
 				if (LocationDelta.Size() <= 100.0f)
@@ -1307,7 +1341,7 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 		// Restore transform (convert from level-local to world space for streaming levels)
 		if (SaveableComp->bSaveTransform)
 		{
-			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetCurrentInstanceInfo();
+			FDimensionInstanceInfo InstanceInfo = DimensionManager->GetInstanceInfo(InstanceId);
 			FVector DimensionWorldPos = InstanceInfo.WorldPosition;
 			FVector WorldLocation = ActorState.Location + DimensionWorldPos;
 			Actor->SetActorLocation(WorldLocation);
@@ -1330,17 +1364,8 @@ bool SaveSystemDimensionHelpers::LoadDimensionInstance(
 			}
 		}
 
-		// Restore storage component
-		if (ActorState.bHasStorage)
-		{
-			UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-			if (StorageComp)
-			{
-				TArray<FItemEntry> StorageEntries = StorageSerialization::DeserializeStorageEntries(ActorState.SerializedStorageEntries);
-				StorageComp->Entries = StorageEntries;
-				StorageComp->MaxVolume = ActorState.StorageMaxVolume;
-			}
-		}
+		// Restore component state (storage contents and any other SaveGame properties)
+		SaveSystemHelpers::RestoreActorComponents(Actor, ActorState);
 
 		// Restore ItemPickup data
 		AItemPickup* ItemPickup = Cast<AItemPickup>(Actor);
@@ -1370,19 +1395,9 @@ TArray<AActor*> SaveSystemDimensionHelpers::GetActorsForDimension(UWorld* World,
 		return DimensionActors;
 	}
 
-	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World))
 	{
-		AActor* Actor = *ActorIterator;
-		if (!Actor)
-		{
-			continue;
-		}
-
-		USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
-		if (SaveableComp && SaveableComp->GetDimensionInstanceId() == InstanceId)
-		{
-			DimensionActors.Add(Actor);
-		}
+		DimensionActors = Registry->GetActorsForDimension(InstanceId);
 	}
 
 	return DimensionActors;
@@ -1,4 +1,13 @@
 #include "Save/SaveSystemHelpers.h"
+#include "Save/ItemEntryArchive.h"
+#include "Save/GameSaveData.h"
+#include "Save/ComponentSaveState.h"
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/HotbarComponent.h"
+#include "Inventory/EquipmentComponent.h"
+#include "Inventory/StorageComponent.h"
+#include "Inventory/StorageSerialization.h"
+#include "Player/HungerComponent.h"
 #include "Inventory/ItemDefinition.h"
 #include "Inventory/ItemTypes.h"
 #include "Inventory/EquipmentTypes.h"
@@ -15,26 +24,8 @@ namespace SaveSystemHelpers
 			return FString();
 		}
 
-		FString Result;
-		
-		// Store ItemDefinition path
-		FString DefPath = Entry.Def->GetPathName();
-		Result += DefPath;
-		
-		// Store ItemId
-		Result += TEXT("|");
-		Result += Entry.ItemId.ToString(EGuidFormats::DigitsWithHyphensInBraces);
-		
-		// Store CustomData
-		for (const auto& Pair : Entry.CustomData)
-		{
-			Result += TEXT("|");
-			Result += Pair.Key.ToString();
-			Result += TEXT("=");
-			Result += Pair.Value;
-		}
-		
-		return Result;
+		// Single-entry item archive; legacy strings are only ever read
+		return ItemEntryArchive::EncodeEntries({ Entry });
 	}
 
 	bool DeserializeItemEntry(const FString& SerializedData, FItemEntry& OutEntry)
@@ -44,6 +35,19 @@ namespace SaveSystemHelpers
 			return false;
 		}
 
+		if (ItemEntryArchive::IsArchiveString(SerializedData))
+		{
+			TArray<FItemEntry> Entries;
+			if (!ItemEntryArchive::DecodeEntries(SerializedData, Entries) || Entries.Num() == 0)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SaveSystemHelpers] DeserializeItemEntry: Failed to decode item archive"));
+				return false;
+			}
+			OutEntry = MoveTemp(Entries[0]);
+			return true;
+		}
+
+		// Legacy pipe-delimited format (pre-archive saves), migrated on the next save
 		TArray<FString> Parts;
 		SerializedData.ParseIntoArray(Parts, TEXT("|"), true);
 		
@@ -112,10 +116,10 @@ namespace SaveSystemHelpers
 			return false;
 		}
 
-		TArray<FString> Parts;
-		SerializedData.ParseIntoArray(Parts, TEXT("|"), true);
-		
-		if (Parts.Num() < 2)
+		// Only the leading slot index is pipe-delimited; the remainder is the item entry (archive or legacy)
+		FString SlotString;
+		FString ItemEntryString;
+		if (!SerializedData.Split(TEXT("|"), &SlotString, &ItemEntryString))
 		{
 			UE_LOG(LogTemp, Warning, TEXT("[SaveSystemHelpers] DeserializeEquipmentSlot: Invalid format, need at least 2 parts"));
 			return false;
@@ -123,9 +127,9 @@ namespace SaveSystemHelpers
 
 		// Parse slot index
 		int32 SlotIndex = 0;
-		if (!LexTryParseString(SlotIndex, *Parts[0]))
+		if (!LexTryParseString(SlotIndex, *SlotString))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[SaveSystemHelpers] Failed to parse slot index: %s"), *Parts[0]);
+			UE_LOG(LogTemp, Warning, TEXT("[SaveSystemHelpers] Failed to parse slot index: %s"), *SlotString);
 			return false;
 		}
 
@@ -137,14 +141,6 @@ namespace SaveSystemHelpers
 
 		OutSlot = static_cast<EEquipmentSlot>(SlotIndex);
 
-		// Reconstruct item entry string (everything after first |)
-		FString ItemEntryString = Parts[1];
-		for (int32 i = 2; i < Parts.Num(); ++i)
-		{
-			ItemEntryString += TEXT("|");
-			ItemEntryString += Parts[i];
-		}
-
 		return DeserializeItemEntry(ItemEntryString, OutEntry);
 	}
 
@@ -201,6 +197,199 @@ namespace SaveSystemHelpers
 
 		return false;
 	}
-}
 
+	namespace
+	{
+		// Replace a container's entries through RemoveById/TryAdd so listeners see the change
+		template<typename ContainerType>
+		void ReplaceEntries(ContainerType* Container, const TArray<FItemEntry>& Entries)
+		{
+			TArray<FGuid> ItemIdsToRemove;
+			for (const FItemEntry& Entry : Container->GetEntries())
+			{
+				ItemIdsToRemove.Add(Entry.ItemId);
+			}
+			for (const FGuid& ItemId : ItemIdsToRemove)
+			{
+				Container->RemoveById(ItemId);
+			}
+
+			for (const FItemEntry& Entry : Entries)
+			{
+				if (!Container->TryAdd(Entry))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to restore entry %s into %s"),
+						Entry.Def ? *Entry.Def->GetPathName() : TEXT("NULL"), *GetNameSafe(Container->GetOwner()));
+				}
+			}
+		}
+
+		// Saves written before ComponentStates kept each player component in its own section
+		void RestoreLegacyPlayerComponents(AActor* Player, const UGameSaveData* SaveData)
+		{
+			if (UHungerComponent* HungerComp = Player->FindComponentByClass<UHungerComponent>())
+			{
+				// CurrentHunger is protected and RestoreHunger only adds, so set the property directly
+				if (FProperty* CurrentHungerProp = UHungerComponent::StaticClass()->FindPropertyByName(TEXT("CurrentHunger")))
+				{
+					*CurrentHungerProp->ContainerPtrToValuePtr<float>(HungerComp) = SaveData->PlayerData.CurrentHunger;
+					HungerComp->OnHungerChanged.Broadcast(SaveData->PlayerData.CurrentHunger, SaveData->PlayerData.MaxHunger);
+				}
+			}
+
+			if (!HasPlayerComponentState(SaveData))
+			{
+				return;
+			}
+
+			UInventoryComponent* InventoryComp = Player->FindComponentByClass<UInventoryComponent>();
+			if (InventoryComp)
+			{
+				ReplaceEntries(InventoryComp, StorageSerialization::DeserializeStorageEntries(SaveData->InventoryData.SerializedEntries));
+			}
+
+			if (UHotbarComponent* HotbarComp = Player->FindComponentByClass<UHotbarComponent>())
+			{
+				for (int32 i = 0; i < HotbarComp->GetNumSlots(); ++i)
+				{
+					HotbarComp->ClearSlot(i);
+				}
+
+				const FHotbarSaveData& HotbarData = SaveData->HotbarData;
+				for (int32 i = 0; i < HotbarData.AssignedItemPaths.Num() && i < HotbarComp->GetNumSlots(); ++i)
+				{
+					const FString& ItemPath = HotbarData.AssignedItemPaths[i];
+					if (ItemPath.IsEmpty())
+					{
+						continue;
+					}
+					if (UItemDefinition* ItemDef = LoadObject<UItemDefinition>(nullptr, *ItemPath))
+					{
+						HotbarComp->AssignSlot(i, ItemDef);
+					}
+					else
+					{
+						UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to load ItemDefinition from path: %s"), *ItemPath);
+					}
+				}
+
+				if (HotbarData.ActiveIndex >= 0 && HotbarData.ActiveIndex < HotbarComp->GetNumSlots())
+				{
+					HotbarComp->SelectSlot(HotbarData.ActiveIndex, InventoryComp);
+				}
+			}
+
+			// Equipped items were saved as inventory entries to re-equip, so this runs after the inventory
+			UEquipmentComponent* EquipmentComp = Player->FindComponentByClass<UEquipmentComponent>();
+			if (EquipmentComp && InventoryComp)
+			{
+				for (const FString& SerializedEquipment : SaveData->EquipmentData.SerializedEquippedItems)
+				{
+					EEquipmentSlot Slot;
+					FItemEntry Entry;
+					if (!DeserializeEquipmentSlot(SerializedEquipment, Slot, Entry))
+					{
+						continue;
+					}
 
+					const bool bItemInInventory = InventoryComp->GetEntries().ContainsByPredicate([&Entry](const FItemEntry& InvEntry)
+					{
+						return InvEntry.ItemId == Entry.ItemId;
+					});
+					if (!bItemInInventory)
+					{
+						InventoryComp->TryAdd(Entry);
+					}
+
+					FText ErrorText;
+					if (!EquipmentComp->EquipFromInventory(Entry.ItemId, ErrorText))
+					{
+						UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to restore equipment in slot %d: %s"),
+							static_cast<int32>(Slot), *ErrorText.ToString());
+					}
+				}
+			}
+		}
+	}
+
+	bool HasPlayerComponentState(const UGameSaveData* SaveData)
+	{
+		return SaveData && (SaveData->PlayerData.ComponentStates.Num() > 0
+			|| !SaveData->InventoryData.SerializedEntries.IsEmpty()
+			|| SaveData->HotbarData.AssignedItemPaths.Num() > 0
+			|| SaveData->EquipmentData.SerializedEquippedItems.Num() > 0);
+	}
+
+	void RestorePlayerComponents(AActor* Player, const UGameSaveData* SaveData)
+	{
+		if (!Player || !SaveData)
+		{
+			return;
+		}
+
+		if (SaveData->PlayerData.ComponentStates.Num() > 0)
+		{
+			const int32 Restored = ComponentSaveState::RestoreActor(Player, SaveData->PlayerData.ComponentStates);
+			UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Restored %d of %d player components"), Restored, SaveData->PlayerData.ComponentStates.Num());
+		}
+		else
+		{
+			RestoreLegacyPlayerComponents(Player, SaveData);
+		}
+	}
+
+	void CaptureActorComponents(const AActor* Actor, FActorStateSaveData& OutState)
+	{
+		ComponentSaveState::CaptureActor(Actor, OutState.ComponentStates);
+	}
+
+	bool RecaptureActorComponents(const AActor* Actor, FActorStateSaveData& InOutState)
+	{
+		TArray<FComponentSaveRecord> Records;
+		ComponentSaveState::CaptureActor(Actor, Records);
+
+		bool bChanged = Records.Num() != InOutState.ComponentStates.Num();
+		for (int32 Index = 0; Index < Records.Num() && !bChanged; ++Index)
+		{
+			const FComponentSaveRecord& Previous = InOutState.ComponentStates[Index];
+			bChanged = Records[Index].ComponentName != Previous.ComponentName
+				|| Records[Index].Data != Previous.Data
+				|| Records[Index].AssetReferences != Previous.AssetReferences;
+		}
+
+		if (bChanged)
+		{
+			InOutState.ComponentStates = MoveTemp(Records);
+		}
+		return bChanged;
+	}
+
+	bool RestoreActorComponents(AActor* Actor, const FActorStateSaveData& State)
+	{
+		if (!Actor)
+		{
+			return false;
+		}
+
+		if (State.ComponentStates.Num() > 0)
+		{
+			return ComponentSaveState::RestoreActor(Actor, State.ComponentStates) > 0;
+		}
+
+		if (!State.bHasStorage)
+		{
+			return false;
+		}
+
+		UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
+		if (!StorageComp)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor %s has bHasStorage=true but no StorageComponent"), *Actor->GetName());
+			return false;
+		}
+
+		ReplaceEntries(StorageComp, StorageSerialization::DeserializeStorageEntries(State.SerializedStorageEntries));
+		StorageComp->MaxVolume = State.StorageMaxVolume;
+		return true;
+	}
+}
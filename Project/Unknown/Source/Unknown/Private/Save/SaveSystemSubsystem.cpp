@@ -1,7 +1,12 @@
 #include "Save/SaveSystemSubsystem.h"
 #include "Save/GameSaveData.h"
+#include "Save/SaveGameFile.h"
 #include "Save/SaveSystemHelpers.h"
 #include "Save/SaveSystemDimensionHelpers.h"
+#include "Save/SaveableActorRegistry.h"
+#include "Save/SaveRestoreScheduler.h"
+#include "Save/SaveAssetPreload.h"
+#include "Save/SaveableActorSpatialIndex.h"
 #include "Dimensions/DimensionManagerSubsystem.h"
 #include "Player/FirstPersonCharacter.h"
 #include "Player/FirstPersonPlayerController.h"
@@ -29,6 +34,7 @@
 #include "HAL/FileManagerGeneric.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "GenericPlatform/GenericPlatformFile.h"
 #include "HAL/PlatformFile.h"
 #include "UObject/Object.h"
@@ -36,6 +42,9 @@
 #include "Engine/Engine.h"
 #include "EngineUtils.h"
 #include "TimerManager.h"
+#include "Async/Async.h"
+#include "UObject/GCScopeLock.h"
+#include "UObject/StrongObjectPtr.h"
 
 void USaveSystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -45,6 +54,33 @@ void USaveSystemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	CurrentSaveName.Empty();
 }
 
+void USaveSystemSubsystem::Deinitialize()
+{
+	// Don't let shutdown cut a save write short
+	if (InFlightSaveResult.IsValid())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Waiting for in-flight save to finish before shutdown"));
+		InFlightSaveResult.Wait();
+	}
+	// A compaction only folds the journal into a fresh snapshot (the slot is complete without it), so it is dropped
+	if (CompactionJournal.IsValid())
+	{
+		CompactionJournal->Abandon();
+		CompactionJournal.Reset();
+	}
+	InFlightSaveSnapshot = nullptr;
+	CompactionSnapshot = nullptr;
+	SlotJournal.Reset();
+	bSaveInFlight = false;
+
+	// A restore still in flight belongs to a world that is going away
+	ActiveRestore.Reset();
+	SaveAssetPreloadHandle.Reset();
+	ActiveRestoreOnComplete = nullptr;
+
+	Super::Deinitialize();
+}
+
 FString USaveSystemSubsystem::SanitizeSaveNameForFilename(const FString& SaveName) const
 {
 	FString Sanitized = SaveName;
@@ -137,6 +173,19 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		return false;
 	}
 
+	if (bSaveInFlight)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Cannot save: a previous save is still being written"));
+		return false;
+	}
+
+	// A handoff the last level transition never applied must not be picked up by a later one
+	if (HasPendingRestore())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Discarding a level transition restore that was never applied"));
+		ClearPendingRestore();
+	}
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -186,10 +235,13 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		// Deep copy the current save data (including baseline) - this preserves the original baseline
 		SaveGameInstance->LevelPackagePath = CurrentSaveData->LevelPackagePath;
 		SaveGameInstance->BaselineActorIds = CurrentSaveData->BaselineActorIds;
+		SaveGameInstance->bDeterministicActorIds = CurrentSaveData->bDeterministicActorIds;
 		
 		// Copy dimension instance data - this preserves all dimension states across save slots
 		SaveGameInstance->DimensionInstances = CurrentSaveData->DimensionInstances;
 		SaveGameInstance->LoadedDimensionInstanceId = CurrentSaveData->LoadedDimensionInstanceId;
+		SaveGameInstance->SidecarSlotName = CurrentSaveData->SidecarSlotName;
+		SaveGameInstance->DimensionScanSeed = CurrentSaveData->DimensionScanSeed;
 		
 		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Copied dimension instance data to new save slot: %d dimension instances, loaded dimension: %s"), 
 			SaveGameInstance->DimensionInstances.Num(), 
@@ -205,7 +257,7 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 	else
 	{
 		// No current save data - try to load existing save from disk
-		SaveGameInstance = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+		SaveGameInstance = SaveGameFile::LoadFromSlot(SlotName);
 		
 		if (SaveGameInstance)
 		{
@@ -247,52 +299,12 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 	SaveGameInstance->PlayerData.Location = PlayerCharacter->GetActorLocation();
 	SaveGameInstance->PlayerData.Rotation = PlayerCharacter->GetActorRotation();
 	
-	// Save hunger stats
-	if (UHungerComponent* HungerComp = PlayerCharacter->GetHunger())
-	{
-		SaveGameInstance->PlayerData.CurrentHunger = HungerComp->GetCurrentHunger();
-		SaveGameInstance->PlayerData.MaxHunger = HungerComp->GetMaxHunger();
-	}
-	
-	// Save inventory
-	if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
-	{
-		SaveGameInstance->InventoryData.SerializedEntries = 
-			StorageSerialization::SerializeStorageEntries(InventoryComp->GetEntries());
-	}
-
-	// Save hotbar
-	if (UHotbarComponent* HotbarComp = PlayerCharacter->GetHotbar())
-	{
-		SaveGameInstance->HotbarData.ActiveIndex = HotbarComp->GetActiveIndex();
-		SaveGameInstance->HotbarData.AssignedItemPaths.Empty();
-		
-		for (int32 i = 0; i < HotbarComp->GetNumSlots(); ++i)
-		{
-			const FHotbarSlot& Slot = HotbarComp->GetSlot(i);
-			if (Slot.AssignedType)
-			{
-				SaveGameInstance->HotbarData.AssignedItemPaths.Add(Slot.AssignedType->GetPathName());
-			}
-			else
-			{
-				SaveGameInstance->HotbarData.AssignedItemPaths.Add(FString()); // Empty string for unassigned slots
-			}
-		}
-	}
-
-	// Save equipment
-	if (UEquipmentComponent* EquipmentComp = PlayerCharacter->GetEquipment())
-	{
-		SaveGameInstance->EquipmentData.SerializedEquippedItems.Empty();
-		TMap<EEquipmentSlot, FItemEntry> EquippedItems = EquipmentComp->GetAllEquippedItems();
-		
-		for (const auto& Pair : EquippedItems)
-		{
-			FString Serialized = SaveSystemHelpers::SerializeEquipmentSlot(Pair.Key, Pair.Value);
-			SaveGameInstance->EquipmentData.SerializedEquippedItems.Add(Serialized);
-		}
-	}
+	// Save player component state (hunger, inventory, hotbar, equipment) in one reflected pass;
+	// the per-component sections a loaded older save came with are superseded by it
+	ComponentSaveState::CaptureActor(PlayerCharacter, SaveGameInstance->PlayerData.ComponentStates);
+	SaveGameInstance->InventoryData = FInventorySaveData();
+	SaveGameInstance->HotbarData = FHotbarSaveData();
+	SaveGameInstance->EquipmentData = FEquipmentSaveData();
 
 	// Save current level package path (for standalone builds, use package path)
 	// Get the level's package - this works in both editor and standalone
@@ -440,18 +452,37 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 	// Save all actors with SaveableActorComponent and their current state
 	SaveGameInstance->ActorStates.Empty();
 	TArray<FGuid> CurrentActorIds;
+	TSet<FGuid> CurrentActorIdSet;
+	const TSet<FGuid> BaselineActorIdSet(SaveGameInstance->BaselineActorIds);
 	
-	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	// Clean actors reuse the record captured by an earlier save, so save cost tracks what changed
+	USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World);
+	int32 ReusedActorStateCount = 0;
+
+	// Records built by this save rather than reused; only these can differ from what the slot journal holds
+	TSet<FGuid> RecapturedActorIds;
+
+	// The registry already knows every saveable actor, so the save never walks the whole world
+	TArray<USaveableActorComponent*> SaveableComponents;
+	if (Registry)
 	{
-		AActor* Actor = *ActorIterator;
-		if (!Actor)
+		SaveableComponents = Registry->GetComponents();
+	}
+	else
+	{
+		for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
 		{
-			continue;
+			if (USaveableActorComponent* SaveableComp = ActorIterator->FindComponentByClass<USaveableActorComponent>())
+			{
+				SaveableComponents.Add(SaveableComp);
+			}
 		}
-
-		// Check if actor has SaveableActorComponent
-		USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
-		if (!SaveableComp)
+	}
+	
+	for (USaveableActorComponent* SaveableComp : SaveableComponents)
+	{
+		AActor* Actor = SaveableComp->GetOwner();
+		if (!Actor)
 		{
 			continue;
 		}
@@ -472,6 +503,28 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		}
 
 		CurrentActorIds.Add(ActorId);
+		CurrentActorIdSet.Add(ActorId);
+
+		// Check if this is a new object (not in baseline)
+		// A new object is one that was added after the baseline was established
+		// If baseline is empty, this is the first save, so all actors are part of the baseline (not new objects)
+		bool bIsInBaseline = BaselineActorIdSet.Num() > 0 && BaselineActorIdSet.Contains(ActorId);
+		bool bIsNewObject = BaselineActorIdSet.Num() > 0 && !bIsInBaseline;
+
+		if (const FActorStateSaveData* CapturedState = Registry ? Registry->FindCapturedState(SaveableComp) : nullptr)
+		{
+			// Baseline membership belongs to the save being written, not to the capture
+			FActorStateSaveData& ReusedState = SaveGameInstance->ActorStates.Add_GetRef(*CapturedState);
+			ReusedState.bIsNewObject = bIsNewObject;
+			ReusedState.SpawnActorClassPath = bIsNewObject ? ReusedState.ActorClassPath : FString();
+			if (SaveSystemHelpers::RecaptureActorComponents(Actor, ReusedState))
+			{
+				Registry->StoreCapturedState(SaveableComp, ReusedState);
+				RecapturedActorIds.Add(ActorId);
+			}
+			ReusedActorStateCount++;
+			continue;
+		}
 
 		// Create actor state data
 		FActorStateSaveData ActorState;
@@ -492,13 +545,6 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		}
 		ActorState.OriginalSpawnTransform = OriginalTransformToSave;
 		
-		// Check if this is a new object (not in baseline)
-		// A new object is one that was added after the baseline was established
-		// If baseline is empty, this is the first save, so all actors are part of the baseline (not new objects)
-		bool bIsInBaseline = SaveGameInstance->BaselineActorIds.Num() > 0 && 
-			SaveGameInstance->BaselineActorIds.Contains(ActorId);
-		bool bIsNewObject = SaveGameInstance->BaselineActorIds.Num() > 0 && !bIsInBaseline;
-		
 		if (bIsNewObject)
 		{
 			// This is a new object added after baseline was established (e.g., dropped item)
@@ -547,19 +593,20 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 			}
 		}
 
-		// Check for storage component
-		UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-		if (StorageComp)
+		// Capture component state (storage contents and any other SaveGame properties)
+		SaveSystemHelpers::CaptureActorComponents(Actor, ActorState);
+
+		if (Registry)
 		{
-			ActorState.bHasStorage = true;
-			TArray<FItemEntry> StorageEntries = StorageComp->GetEntries();
-			ActorState.SerializedStorageEntries = StorageSerialization::SerializeStorageEntries(StorageEntries);
-			ActorState.StorageMaxVolume = StorageComp->MaxVolume;
+			Registry->StoreCapturedState(SaveableComp, ActorState);
 		}
-
+		RecapturedActorIds.Add(ActorId);
 		SaveGameInstance->ActorStates.Add(ActorState);
 	}
 
+	UE_LOG(LogTemp, Verbose, TEXT("[SaveSystem] Saved %d actor states (%d reused from previous capture)"), 
+		SaveGameInstance->ActorStates.Num(), ReusedActorStateCount);
+
 	// === Detect Removed Actors ===
 	// Compare current actors to baseline to detect which ones were removed
 	if (SaveGameInstance->BaselineActorIds.Num() > 0)
@@ -568,7 +615,7 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		int32 RemovedCount = 0;
 		for (const FGuid& BaselineId : SaveGameInstance->BaselineActorIds)
 		{
-			if (!CurrentActorIds.Contains(BaselineId))
+			if (!CurrentActorIdSet.Contains(BaselineId))
 			{
 				// Actor was in baseline but not in current state - it was removed
 				// Try to find it in the world to get its last known location and metadata (for matching on load)
@@ -615,6 +662,7 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 				}
 				
 				SaveGameInstance->ActorStates.Add(RemovedActorState);
+				RecapturedActorIds.Add(BaselineId);
 				RemovedCount++;
 			}
 		}
@@ -635,24 +683,20 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 	// Set timestamp
 	FDateTime Now = FDateTime::Now();
 	SaveGameInstance->Timestamp = Now.ToString(TEXT("%Y.%m.%d %H:%M:%S"));
+	// Playtime is tracked on the running save; a save to another slot inherits its total
+	AccumulatePlaytime(CurrentSaveData ? CurrentSaveData : SaveGameInstance);
+	if (CurrentSaveData && SaveGameInstance != CurrentSaveData)
+	{
+		SaveGameInstance->PlaytimeSeconds = CurrentSaveData->PlaytimeSeconds;
+	}
 
-	// Check if we need to save a temp save for level transition
+	// Check if we need to hand the save over to the next level
 	if (!PendingLevelLoad.IsEmpty())
 	{
-		FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-		UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Saving temp save with inventory entries: %d, hotbar slots: %d, equipment: %d"), 
-			SaveGameInstance->InventoryData.SerializedEntries.Len() > 0 ? 1 : 0,
-			SaveGameInstance->HotbarData.AssignedItemPaths.Num(),
-			SaveGameInstance->EquipmentData.SerializedEquippedItems.Num());
-		bool bTempSaveSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, TempSlotName, 0);
-		if (bTempSaveSuccess)
-		{
-			UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Temp save created successfully"));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("[SaveSystem] Failed to create temp save!"));
-		}
+		UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Handing off save for level transition with %d player components"), 
+			SaveGameInstance->PlayerData.ComponentStates.Num());
+		// Copy, since the running save keeps being mutated while the old world tears down
+		SetPendingRestore(SaveGameInstance->CreateSnapshot(this));
 		
 			// Open the level
 			FString LevelToLoad = PendingLevelLoad;
@@ -662,9 +706,62 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		return true;
 	}
 
-	// Save to slot (SlotName was already computed above when we tried to load the save)
-	bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, SlotName, 0);
-	
+	// Write to slot in the background (SlotName was already computed above when we tried to load the save)
+	WriteSaveAsync(SaveGameInstance, SlotId, SlotName, MoveTemp(RecapturedActorIds));
+
+	return true;
+}
+
+void USaveSystemSubsystem::WriteSaveAsync(UGameSaveData* SaveData, const FString& SlotId, const FString& SlotName, TSet<FGuid> RecapturedActorIds)
+{
+	// Detach from the live save data - gameplay (e.g. dimension unloads) keeps mutating CurrentSaveData
+	// while the worker serializes, so the worker only ever sees this immutable copy
+	InFlightSaveSnapshot = SaveData->CreateSnapshot(this);
+	bSaveInFlight = true;
+
+	// The journal follows the slot being played; saving to another slot starts over with a snapshot
+	if (!SlotJournal.IsValid() || SlotJournal->SlotName != SlotName)
+	{
+		SlotJournal = MakeShared<FSaveJournalState>();
+		SlotJournal->SlotName = SlotName;
+	}
+
+	UGameSaveData* Snapshot = InFlightSaveSnapshot;
+	TSharedPtr<FSaveJournalState> Journal = SlotJournal;
+	const bool bJournaled = bJournaledSaves;
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	InFlightSaveResult = Async(EAsyncExecution::ThreadPool, [Snapshot, Journal, bJournaled, SlotId, SlotName, WeakThis,
+		RecapturedActorIds = MoveTemp(RecapturedActorIds)]()
+	{
+		bool bSuccess = false;
+		bool bCompact = false;
+		int32 JournalEntryCount = 0;
+		{
+			// Block GC while the snapshot is reflected over off the game thread
+			FGCScopeGuard GCGuard;
+			FScopeLock JournalLock(&Journal->Lock);
+			bSuccess = SaveGameFile::WriteDimensionSidecars(Snapshot, SlotName, Journal.Get())
+				&& (bJournaled && Journal->IsValidFor(SlotName)
+					? SaveGameFile::AppendJournalEntry(Snapshot, RecapturedActorIds, *Journal)
+					: SaveGameFile::WriteJournalSnapshot(Snapshot, SlotName, *Journal));
+			bCompact = bSuccess && bJournaled && SaveGameFile::ShouldCompactJournal(*Journal);
+			JournalEntryCount = Journal->EntryCount;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, SlotId, SlotName, bSuccess, bCompact, JournalEntryCount]()
+		{
+			if (USaveSystemSubsystem* SaveSystem = WeakThis.Get())
+			{
+				SaveSystem->OnSaveWriteFinished(SlotId, SlotName, bSuccess, bCompact, JournalEntryCount);
+			}
+		});
+
+		return bSuccess;
+	});
+}
+
+void USaveSystemSubsystem::OnSaveWriteFinished(const FString& SlotId, const FString& SlotName, bool bSuccess, bool bCompact, int32 JournalEntryCount)
+{
 	if (bSuccess)
 	{
 		UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Successfully saved game to slot: %s"), *SlotName);
@@ -674,7 +771,84 @@ bool USaveSystemSubsystem::SaveGame(const FString& SlotId, const FString& SaveNa
 		UE_LOG(LogTemp, Error, TEXT("[SaveSystem] Failed to save game to slot: %s"), *SlotName);
 	}
 
-	return bSuccess;
+	UGameSaveData* Snapshot = InFlightSaveSnapshot;
+	InFlightSaveSnapshot = nullptr;
+	InFlightSaveResult.Reset();
+	bSaveInFlight = false;
+
+	if (bSuccess)
+	{
+		RefreshSlotInfo(SlotId, SlotName);
+	}
+
+	OnSaveGameCompleted.Broadcast(SlotId, bSuccess);
+
+	if (bCompact && Snapshot)
+	{
+		StartJournalCompaction(Snapshot, SlotId, SlotName, JournalEntryCount);
+	}
+}
+
+void USaveSystemSubsystem::StartJournalCompaction(UGameSaveData* SaveData, const FString& SlotId, const FString& SlotName, int32 JournalEntryCount)
+{
+	// One compaction at a time; the next save that crosses the threshold tries again
+	if (CompactionSnapshot || !SlotJournal.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Compacting save journal of slot %s (%d entries)"), *SlotName, JournalEntryCount);
+
+	CompactionSnapshot = SaveData;
+	CompactionJournal = SlotJournal;
+	TSharedPtr<FSaveJournalState> Journal = SlotJournal;
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	Async(EAsyncExecution::ThreadPool, [SaveData, Journal, JournalEntryCount, SlotId, SlotName, WeakThis]()
+	{
+		bool bSuccess = false;
+		{
+			// GC is blocked before anything else, so an abandoned compaction never touches a collected snapshot
+			FGCScopeGuard GCGuard;
+			FScopeLock JournalLock(&Journal->Lock);
+
+			// A save journaled after this snapshot was taken is newer than it; compacting would lose it.
+			// An abandoned journal (slot rewritten or deleted) fails the check, or drops the snapshot at commit.
+			if (Journal->IsValidFor(SlotName) && Journal->EntryCount == JournalEntryCount)
+			{
+				bSuccess = SaveGameFile::WriteJournalSnapshot(SaveData, SlotName, *Journal);
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Journal, SlotId, SlotName, bSuccess]()
+		{
+			USaveSystemSubsystem* SaveSystem = WeakThis.Get();
+			if (!SaveSystem || SaveSystem->CompactionJournal != Journal)
+			{
+				return;
+			}
+			SaveSystem->CompactionSnapshot = nullptr;
+			SaveSystem->CompactionJournal.Reset();
+			if (bSuccess)
+			{
+				SaveSystem->RefreshSlotInfo(SlotId, SlotName);
+			}
+		});
+	});
+}
+
+void USaveSystemSubsystem::ResetSlotJournal(const FString& SlotName)
+{
+	// Anything still writing the slot drops its result instead of landing on whatever replaces it; this only ever
+	// waits for a file move in progress, never for the write itself
+	if (SlotJournal.IsValid() && SlotJournal->SlotName == SlotName)
+	{
+		SlotJournal->Abandon();
+		SlotJournal.Reset();
+	}
+	if (CompactionJournal.IsValid() && CompactionJournal->SlotName == SlotName)
+	{
+		CompactionJournal->Abandon();
+	}
 }
 
 bool USaveSystemSubsystem::LoadGame(const FString& SlotId)
@@ -685,6 +859,13 @@ bool USaveSystemSubsystem::LoadGame(const FString& SlotId)
 		return false;
 	}
 
+	// A handoff the last level transition never applied must not be picked up by a later one
+	if (HasPendingRestore())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Discarding a level transition restore that was never applied"));
+		ClearPendingRestore();
+	}
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -692,6 +873,42 @@ bool USaveSystemSubsystem::LoadGame(const FString& SlotId)
 		return false;
 	}
 
+	// Find the save file (it has the save name in the filename) via the slot cache
+	EnsureSlotInfoCache();
+	UGameSaveData* SaveGameInstance = nullptr;
+	if (const FSaveSlotInfo* SlotInfo = SlotInfoCache.Find(SlotId))
+	{
+		SaveGameInstance = SaveGameFile::LoadFromSlot(SlotInfo->SlotName);
+	}
+
+	if (!SaveGameInstance)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to load save game from slot: %s"), *SlotId);
+		return false;
+	}
+
+	// Restore starts once the fade-out has finished AND every asset the save references is in memory,
+	// so the asset I/O overlaps the fade instead of stalling inside the restore loops
+	struct FLoadGate
+	{
+		int32 Remaining = 2;
+	};
+	TSharedRef<FLoadGate> Gate = MakeShared<FLoadGate>();
+	TStrongObjectPtr<UGameSaveData> SaveDataRef(SaveGameInstance);
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	auto PassGate = [WeakThis, Gate, SlotId, SaveDataRef]()
+	{
+		if (--Gate->Remaining == 0)
+		{
+			if (USaveSystemSubsystem* StrongThis = WeakThis.Get())
+			{
+				StrongThis->LoadGameAfterFade(SlotId, SaveDataRef.Get());
+			}
+		}
+	};
+
+	PreloadSaveAssets(SaveGameInstance, PassGate);
+
 	// Fade to black before loading (hide items spawning and position changes)
 	APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
 	AFirstPersonPlayerController* FirstPersonPC = Cast<AFirstPersonPlayerController>(PC);
@@ -703,21 +920,24 @@ bool USaveSystemSubsystem::LoadGame(const FString& SlotId)
 		// We'll use a timer to delay the actual loading
 		const float FadeOutDuration = 0.3f;
 		FTimerHandle FadeOutTimer;
-		World->GetTimerManager().SetTimer(FadeOutTimer, [this, World, SlotId]()
-		{
-			LoadGameAfterFade(SlotId);
-		}, FadeOutDuration, false);
-		
-		return true; // Return early, actual load happens after fade
+		World->GetTimerManager().SetTimer(FadeOutTimer, PassGate, FadeOutDuration, false);
 	}
 	else
 	{
-		// No fade widget available, proceed with normal load
-		return LoadGameAfterFade(SlotId);
+		// No fade widget available, proceed as soon as the assets are in
+		PassGate();
 	}
+
+	return true; // Actual load happens once the gate opens
+}
+
+void USaveSystemSubsystem::PreloadSaveAssets(UGameSaveData* SaveData, TFunction<void()> OnLoaded)
+{
+	// Replacing the handle releases whatever the previous load was keeping resident
+	SaveAssetPreloadHandle = SaveAssetPreload::RequestAsyncLoad(SaveData, FStreamableDelegate::CreateLambda(MoveTemp(OnLoaded)));
 }
 
-bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
+bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId, UGameSaveData* SaveGameInstance)
 {
 	UWorld* World = GetWorld();
 	if (!World)
@@ -726,42 +946,29 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 		return false;
 	}
 
-	// Find the save file - it has the save name in the filename
-	// Search for files starting with SaveSlot_{SlotId}_
-	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-	IFileManager& FileManager = IFileManager::Get();
-	TArray<FString> SaveFiles;
-	FileManager.FindFiles(SaveFiles, *SaveDir, TEXT("*.sav"));
-	
-	FString SlotPrefix = FString::Printf(TEXT("SaveSlot_%s_"), *SlotId);
-	FString SlotName;
-	UGameSaveData* SaveGameInstance = nullptr;
-	
-	for (const FString& SaveFile : SaveFiles)
-	{
-		FString FileName = FPaths::GetBaseFilename(SaveFile);
-		if (FileName.StartsWith(SlotPrefix))
-		{
-			// Found a matching file - try to load it
-			SaveGameInstance = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(FileName, 0));
-			if (SaveGameInstance)
-			{
-				SlotName = FileName;
-				break;
-			}
-		}
-	}
-	
 	if (!SaveGameInstance)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to load save game from slot: %s"), *SlotId);
 		return false;
 	}
 	
+	// Hidden dimension instances hold the state of the save being replaced; they must not be shown again
+	if (UDimensionManagerSubsystem* DimensionManager = World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<UDimensionManagerSubsystem>() : nullptr)
+	{
+		DimensionManager->ReleaseInactiveInstances();
+	}
+
+	// Records captured for the previous save describe its state, not this one's
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World))
+	{
+		Registry->ResetCapturedStates();
+	}
+
 	// Set as current save data (the "running" save game)
 	CurrentSaveData = SaveGameInstance;
 	CurrentSlotId = SlotId;
 	CurrentSaveName = SaveGameInstance->SaveName;
+	PlaytimeAnchorSeconds = FPlatformTime::Seconds();
 	
 
 	// Check if we need to load a different level
@@ -851,12 +1058,8 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 			
 			// Store save data for restoration after level loads
 			// (We handle the level transition directly here, not through SaveGame())
-			FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-		bool bTempSaveSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, TempSlotName, 0);
-		if (!bTempSaveSuccess)
-		{
-			UE_LOG(LogTemp, Error, TEXT("[SaveSystem] Failed to create temp save!"));
-		}
+			// Copy, since CurrentSaveData keeps being mutated while the old world tears down (e.g. dimension unloads)
+			SetPendingRestore(SaveGameInstance->CreateSnapshot(this));
 			
 			// Ensure fade widget is black before opening level to prevent flash
 			// The widget should already be black from the fade-out, but ensure it stays black
@@ -879,7 +1082,7 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 			PendingLevelLoad.Empty();
 			
 			// Position restoration will be handled in FirstPersonPlayerController::BeginPlay
-			// by checking for the temp save file
+			// by checking for the pending restore
 			
 			return true;
 		}
@@ -896,10 +1099,8 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 	}
 
 	// Restore player location and rotation
-	// Check if new save data exists (check if inventory data was saved as a proxy)
-	bool bHasNewSaveData = !SaveGameInstance->InventoryData.SerializedEntries.IsEmpty() || 
-		SaveGameInstance->HotbarData.AssignedItemPaths.Num() > 0 ||
-		SaveGameInstance->EquipmentData.SerializedEquippedItems.Num() > 0;
+	// Check if new save data exists (player component state is the proxy; older saves only had a position)
+	bool bHasNewSaveData = SaveSystemHelpers::HasPlayerComponentState(SaveGameInstance);
 	
 	FVector RestoreLocation;
 	FRotator RestoreRotation;
@@ -953,148 +1154,61 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 		}
 	}
 	
-	// Restore hunger stats
-	if (UHungerComponent* HungerComp = PlayerCharacter->GetHunger())
-	{
-		float SavedHunger = SaveGameInstance->PlayerData.CurrentHunger;
-		float CurrentHunger = HungerComp->GetCurrentHunger();
-		float HungerDelta = SavedHunger - CurrentHunger;
-		
-		// Use reflection to set CurrentHunger directly since RestoreHunger adds to current value
-		FProperty* CurrentHungerProp = UHungerComponent::StaticClass()->FindPropertyByName(TEXT("CurrentHunger"));
-		if (CurrentHungerProp)
-		{
-			float* CurrentHungerPtr = CurrentHungerProp->ContainerPtrToValuePtr<float>(HungerComp);
-			if (CurrentHungerPtr)
-			{
-				*CurrentHungerPtr = SavedHunger;
-				HungerComp->OnHungerChanged.Broadcast(SavedHunger, SaveGameInstance->PlayerData.MaxHunger);
-			}
-		}
-		else
-		{
-			// Fallback: use RestoreHunger if reflection fails
-			HungerComp->RestoreHunger(HungerDelta);
-		}
-		
-	}
+	// Restore hunger, inventory, hotbar and equipment
+	SaveSystemHelpers::RestorePlayerComponents(PlayerCharacter, SaveGameInstance);
 
-	// Restore inventory
-	if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
+	// Restore all actor states, a frame-budgeted batch at a time (see StartTimeSlicedRestore).
+	// Everything that depends on the restored actors runs once the last record has been applied.
+	struct FRestoreCounts
 	{
-		TArray<FItemEntry> RestoredEntries = StorageSerialization::DeserializeStorageEntries(
-			SaveGameInstance->InventoryData.SerializedEntries);
-		
-		// Clear existing inventory and add restored entries
-		// Note: We need to remove items one by one since there's no Clear() method
-		TArray<FGuid> ItemIdsToRemove;
-		for (const FItemEntry& Entry : InventoryComp->GetEntries())
-		{
-			ItemIdsToRemove.Add(Entry.ItemId);
-		}
-		for (const FGuid& ItemId : ItemIdsToRemove)
-		{
-			InventoryComp->RemoveById(ItemId);
-		}
+		int32 Restored = 0;
+		int32 NotFound = 0;
+		int32 MetadataFallback = 0;
+		int32 Physics = 0;
+		int32 Storage = 0;
+	};
+	TSharedRef<FRestoreCounts> Counts = MakeShared<FRestoreCounts>();
+	TStrongObjectPtr<UGameSaveData> SaveDataRef(SaveGameInstance);
+	TWeakObjectPtr<AFirstPersonCharacter> WeakPlayerCharacter = PlayerCharacter;
 
-		// Add restored entries
-		for (const FItemEntry& Entry : RestoredEntries)
-		{
-			InventoryComp->TryAdd(Entry);
-		}
-	}
+	// Check if we're doing a level transition (a pending restore means level transition is happening)
+	const bool bLevelTransition = HasPendingRestore();
 
-	// Restore hotbar
-	if (UHotbarComponent* HotbarComp = PlayerCharacter->GetHotbar())
+	// Saves with deterministic IDs match level actors exactly by ID. Level actors no longer carry the IDs older
+	// saves were written with, so those fall back to metadata, like the level transition restore does.
+	const bool bMatchByMetadata = !SaveGameInstance->bDeterministicActorIds;
+	TSharedRef<FSaveableActorSpatialIndex> SpatialIndex = MakeShared<FSaveableActorSpatialIndex>();
+	TSharedRef<TSet<AActor*>> MatchedActors = MakeShared<TSet<AActor*>>();
+	if (bMatchByMetadata)
 	{
-		// Clear all slots first
-		for (int32 i = 0; i < HotbarComp->GetNumSlots(); ++i)
-		{
-			HotbarComp->ClearSlot(i);
-		}
-
-		// Restore assigned item types
-		for (int32 i = 0; i < SaveGameInstance->HotbarData.AssignedItemPaths.Num() && 
-			i < HotbarComp->GetNumSlots(); ++i)
-		{
-			const FString& ItemPath = SaveGameInstance->HotbarData.AssignedItemPaths[i];
-			if (!ItemPath.IsEmpty())
-			{
-				UItemDefinition* ItemDef = LoadObject<UItemDefinition>(nullptr, *ItemPath);
-				if (ItemDef)
-				{
-					HotbarComp->AssignSlot(i, ItemDef);
-				}
-			}
-		}
-
-		// Restore active index (this will also select the item if available)
-		if (SaveGameInstance->HotbarData.ActiveIndex != INDEX_NONE && 
-			SaveGameInstance->HotbarData.ActiveIndex >= 0 && 
-			SaveGameInstance->HotbarData.ActiveIndex < HotbarComp->GetNumSlots())
-		{
-			HotbarComp->SelectSlot(SaveGameInstance->HotbarData.ActiveIndex, PlayerCharacter->GetInventory());
-		}
+		SpatialIndex->AddWorldActors(World);
 	}
 
-	// Restore equipment (must be after inventory is restored)
-	if (UEquipmentComponent* EquipmentComp = PlayerCharacter->GetEquipment())
+	TSharedRef<FSaveRestoreScheduler> Scheduler = MakeShared<FSaveRestoreScheduler>();
+	Scheduler->AddPhase(SaveGameInstance->ActorStates.Num(), [World, SaveDataRef, bMatchByMetadata, SpatialIndex, MatchedActors, Counts](int32 Index)
 	{
-		for (const FString& SerializedEquipment : SaveGameInstance->EquipmentData.SerializedEquippedItems)
+		const FActorStateSaveData& ActorState = SaveDataRef->ActorStates[Index];
+		AActor* Actor = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
+		if (!Actor && bMatchByMetadata && !ActorState.ActorClassPath.IsEmpty())
 		{
-			EEquipmentSlot Slot;
-			FItemEntry Entry;
-			if (SaveSystemHelpers::DeserializeEquipmentSlot(SerializedEquipment, Slot, Entry))
+			// Takes the saved ID over on a match, so the next save keeps it
+			Actor = USaveableActorComponent::FindActorByGuidOrMetadata(World, ActorState.ActorId, ActorState.ActorClassPath,
+				ActorState.OriginalSpawnTransform, 10.0f, &SpatialIndex.Get(), &MatchedActors.Get());
+			if (Actor)
 			{
-				// First, ensure the item is in inventory (it should be, but check)
-				bool bItemInInventory = false;
-				if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
-				{
-					for (const FItemEntry& InvEntry : InventoryComp->GetEntries())
-					{
-						if (InvEntry.ItemId == Entry.ItemId)
-						{
-							bItemInInventory = true;
-							break;
-						}
-					}
-
-					// If not in inventory, add it
-					if (!bItemInInventory)
-					{
-						InventoryComp->TryAdd(Entry);
-					}
-
-					// Now equip it
-					FText ErrorText;
-					if (EquipmentComp->EquipFromInventory(Entry.ItemId, ErrorText))
-					{
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Failed to restore equipment in slot %d: %s"), 
-							static_cast<int32>(Slot), *ErrorText.ToString());
-					}
-				}
+				Counts->MetadataFallback++;
 			}
 		}
-	}
-
-	// Restore all actor states
-	int32 ActorRestoredCount = 0;
-	int32 ActorNotFoundCount = 0;
-	int32 PhysicsRestoredCount = 0;
-	int32 StorageRestoredCount = 0;
-	
-	for (const FActorStateSaveData& ActorState : SaveGameInstance->ActorStates)
-	{
-		AActor* Actor = USaveableActorComponent::FindActorByGuid(World, ActorState.ActorId);
 		if (!Actor)
 		{
-			ActorNotFoundCount++;
+			Counts->NotFound++;
 			UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Actor with ID %s not found in world"), 
 				*ActorState.ActorId.ToString(EGuidFormats::DigitsWithHyphensInBraces));
-			continue;
+			return;
+		}
+		if (bMatchByMetadata)
+		{
+			MatchedActors->Add(Actor);
 		}
 
 		// Restore transform
@@ -1119,49 +1233,20 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 					PrimitiveComp->SetPhysicsLinearVelocity(ActorState.LinearVelocity);
 					PrimitiveComp->SetPhysicsAngularVelocityInRadians(ActorState.AngularVelocity);
 				}
-				PhysicsRestoredCount++;
+				Counts->Physics++;
 			}
 		}
 
-		// Restore storage state if applicable
-		if (ActorState.bHasStorage)
+		// Restore component state (storage contents and any other SaveGame properties)
+		if (SaveSystemHelpers::RestoreActorComponents(Actor, ActorState))
+		{
+			Counts->Storage++;
+		}
+
+		// Restore ItemEntry data for ItemPickup actors (includes CustomData like UsesRemaining)
+		if (AItemPickup* ItemPickup = Cast<AItemPickup>(Actor))
 		{
-			UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-			if (StorageComp)
-			{
-				TArray<FItemEntry> RestoredEntries = StorageSerialization::DeserializeStorageEntries(
-					ActorState.SerializedStorageEntries);
-				
-				// Clear existing storage
-				TArray<FGuid> ItemIdsToRemove;
-				for (const FItemEntry& Entry : StorageComp->GetEntries())
-				{
-					ItemIdsToRemove.Add(Entry.ItemId);
-				}
-				for (const FGuid& ItemId : ItemIdsToRemove)
-				{
-					StorageComp->RemoveById(ItemId);
-				}
-
-				// Restore entries
-				int32 AddedCount = 0;
-				for (const FItemEntry& Entry : RestoredEntries)
-				{
-					if (StorageComp->TryAdd(Entry))
-					{
-						AddedCount++;
-					}
-				}
-
-				StorageComp->MaxVolume = ActorState.StorageMaxVolume;
-				StorageRestoredCount++;
-			}
-		}
-
-		// Restore ItemEntry data for ItemPickup actors (includes CustomData like UsesRemaining)
-		if (AItemPickup* ItemPickup = Cast<AItemPickup>(Actor))
-		{
-			if (!ActorState.SerializedItemEntry.IsEmpty())
+			if (!ActorState.SerializedItemEntry.IsEmpty())
 			{
 				FItemEntry ItemEntry;
 				if (SaveSystemHelpers::DeserializeItemEntry(ActorState.SerializedItemEntry, ItemEntry))
@@ -1176,68 +1261,73 @@ bool USaveSystemSubsystem::LoadGameAfterFade(const FString& SlotId)
 			}
 		}
 
-		ActorRestoredCount++;
-	}
-	
-	// Restore cartridge instance IDs from saved dimension data
-	// This ensures cartridges have the correct instance IDs before they trigger dimension loading
-	if (SaveGameInstance && PlayerCharacter)
+		Counts->Restored++;
+	});
+
+	StartTimeSlicedRestore(World, Scheduler, [this, World, SaveDataRef, WeakPlayerCharacter, RestoreLocation, RestoreRotation, bLevelTransition, Counts]()
 	{
-		RestoreCartridgeInstanceIds(World, SaveGameInstance, PlayerCharacter);
-	}
+		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Restored %d actors (%d not found, %d by metadata, %d with physics, %d with storage)"),
+			Counts->Restored, Counts->NotFound, Counts->MetadataFallback, Counts->Physics, Counts->Storage);
 
-	// NOTE: Dimension restoration and fade-in are handled by RestorePlayerPositionAfterLevelLoad
-	// when a level transition occurs. For same-level loads, we handle it here.
-	// But if we're doing a level transition, we skip this to avoid double fade-in.
-	// The level transition path will handle dimension restoration via RestorePlayerPositionAfterLevelLoad.
-	
-	// Check if we're doing a level transition (temp save exists means level transition is happening)
-	FString TempSlotName = TEXT("_TEMP_RESTORE_POSITION_");
-	bool bLevelTransition = UGameplayStatics::DoesSaveGameExist(TempSlotName, 0);
+		UGameSaveData* SaveGameInstance = SaveDataRef.Get();
+		AFirstPersonCharacter* PlayerCharacter = WeakPlayerCharacter.Get();
+
+		// Restore cartridge instance IDs from saved dimension data
+		// This ensures cartridges have the correct instance IDs before they trigger dimension loading
+		if (SaveGameInstance && PlayerCharacter)
+		{
+			RestoreCartridgeInstanceIds(World, SaveGameInstance, PlayerCharacter);
+		}
+
+		// NOTE: Dimension restoration and fade-in are handled by RestorePlayerPositionAfterLevelLoad
+		// when a level transition occurs. For same-level loads, we handle it here.
+		// But if we're doing a level transition, we skip this to avoid double fade-in.
+		// The level transition path will handle dimension restoration via RestorePlayerPositionAfterLevelLoad.
 	
-	if (!bLevelTransition)
-	{
-		// Same-level load - handle dimension restoration and fade-in here
-		if (SaveGameInstance && SaveGameInstance->LoadedDimensionInstanceId.IsValid())
+		if (!bLevelTransition)
 		{
-			UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Will restore loaded dimension instance: %s (same-level load)"), 
-				*SaveGameInstance->LoadedDimensionInstanceId.ToString());
-			FTimerHandle RestoreDimensionTimer;
+			// Same-level load - handle dimension restoration and fade-in here
+			if (SaveGameInstance && SaveGameInstance->LoadedDimensionInstanceId.IsValid())
+			{
+				UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Will restore loaded dimension instance: %s (same-level load)"), 
+					*SaveGameInstance->LoadedDimensionInstanceId.ToString());
+				FTimerHandle RestoreDimensionTimer;
 			
-			// Store player position/rotation for restoration after dimension loads
-			FVector SavedPlayerLocation = RestoreLocation;
-			FRotator SavedPlayerRotation = RestoreRotation;
+				// Store player position/rotation for restoration after dimension loads
+				FVector SavedPlayerLocation = RestoreLocation;
+				FRotator SavedPlayerRotation = RestoreRotation;
 			
-			// Fade in after dimension loads and player position is restored
-			TFunction<void()> FadeInCallback = [this]()
-			{
-				FadeInAfterLoad();
-			};
+				// Fade in after dimension loads and player position is restored
+				TFunction<void()> FadeInCallback = [this]()
+				{
+					FadeInAfterLoad();
+				};
 			
-			World->GetTimerManager().SetTimer(RestoreDimensionTimer, [this, World, SaveGameInstance, SavedPlayerLocation, SavedPlayerRotation, FadeInCallback]()
+				World->GetTimerManager().SetTimer(RestoreDimensionTimer, [this, World, SaveGameInstance, SavedPlayerLocation, SavedPlayerRotation, FadeInCallback]()
+				{
+					RestoreLoadedDimension(World, SaveGameInstance, SavedPlayerLocation, SavedPlayerRotation, true, FadeInCallback);
+				}, 0.2f, false); // Reduced delay: 0.2 seconds should be enough for cartridges to restore
+			}
+			else
 			{
-				RestoreLoadedDimension(World, SaveGameInstance, SavedPlayerLocation, SavedPlayerRotation, true, FadeInCallback);
-			}, 0.2f, false); // Reduced delay: 0.2 seconds should be enough for cartridges to restore
+				// No dimension to load - fade in after loading completes (for same-level loads)
+				// Add a small delay to ensure everything is visually settled before fading in
+				if (World)
+				{
+					FTimerHandle FadeInTimer;
+					World->GetTimerManager().SetTimer(FadeInTimer, [this]()
+					{
+						FadeInAfterLoad();
+					}, 0.2f, false); // 0.2 second delay before fading in
+				}
+			}
 		}
 		else
 		{
-			// No dimension to load - fade in after loading completes (for same-level loads)
-			// Add a small delay to ensure everything is visually settled before fading in
-			if (World)
-			{
-				FTimerHandle FadeInTimer;
-				World->GetTimerManager().SetTimer(FadeInTimer, [this]()
-				{
-					FadeInAfterLoad();
-				}, 0.2f, false); // 0.2 second delay before fading in
-			}
+			// Level transition - RestorePlayerPositionAfterLevelLoad will handle dimension restoration and fade-in
+			UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Level transition detected - dimension restoration will be handled by RestorePlayerPositionAfterLevelLoad"));
 		}
-	}
-	else
-	{
-		// Level transition - RestorePlayerPositionAfterLevelLoad will handle dimension restoration and fade-in
-		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Level transition detected - dimension restoration will be handled by RestorePlayerPositionAfterLevelLoad"));
-	}
+	});
 	
 	return true;
 }
@@ -1250,29 +1340,21 @@ bool USaveSystemSubsystem::DeleteSave(const FString& SlotId)
 		return false;
 	}
 
-	// Find and delete the save file - it has the save name in the filename
-	// Search for files starting with SaveSlot_{SlotId}_
-	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-	IFileManager& FileManager = IFileManager::Get();
-	TArray<FString> SaveFiles;
-	FileManager.FindFiles(SaveFiles, *SaveDir, TEXT("*.sav"));
-	
-	FString SlotPrefix = FString::Printf(TEXT("SaveSlot_%s_"), *SlotId);
+	// Find and delete the save file (it has the save name in the filename) via the slot cache
+	EnsureSlotInfoCache();
 	FString SlotName;
 	bool bSuccess = false;
 	
-	for (const FString& SaveFile : SaveFiles)
+	if (const FSaveSlotInfo* SlotInfo = SlotInfoCache.Find(SlotId))
 	{
-		FString FileName = FPaths::GetBaseFilename(SaveFile);
-		if (FileName.StartsWith(SlotPrefix))
+		SlotName = SlotInfo->SlotName;
+		ResetSlotJournal(SlotName);
+		bSuccess = UGameplayStatics::DeleteGameInSlot(SlotName, 0);
+		if (bSuccess)
 		{
-			// Found a matching file - delete it
-			bSuccess = UGameplayStatics::DeleteGameInSlot(FileName, 0);
-			if (bSuccess)
-			{
-				SlotName = FileName;
-				break;
-			}
+			SaveGameFile::DeleteSlotJournal(SlotName);
+			SaveGameFile::DeleteDimensionSidecars(SlotName);
+			SlotInfoCache.Remove(SlotId);
 		}
 	}
 	
@@ -1286,76 +1368,112 @@ bool USaveSystemSubsystem::DeleteSave(const FString& SlotId)
 
 FSaveSlotInfo USaveSystemSubsystem::GetSaveSlotInfo(const FString& SlotId) const
 {
+	EnsureSlotInfoCache();
+	
+	if (const FSaveSlotInfo* CachedInfo = SlotInfoCache.Find(SlotId))
+	{
+		return *CachedInfo;
+	}
+
 	FSaveSlotInfo Info;
 	Info.SlotId = SlotId;
+	Info.bExists = false;
+	return Info;
+}
 
-	// Find the save file - it has the save name in the filename
-	// Search for files starting with SaveSlot_{SlotId}_
-	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-	IFileManager& FileManager = IFileManager::Get();
-	TArray<FString> SaveFiles;
-	FileManager.FindFiles(SaveFiles, *SaveDir, TEXT("*.sav"));
+bool USaveSystemSubsystem::DoesSaveSlotExist(const FString& SlotId) const
+{
+	EnsureSlotInfoCache();
+	return SlotInfoCache.Contains(SlotId);
+}
+
+TArray<FSaveSlotInfo> USaveSystemSubsystem::GetAllSaveSlots() const
+{
+	EnsureSlotInfoCache();
 	
-	FString SlotPrefix = FString::Printf(TEXT("SaveSlot_%s_"), *SlotId);
-	FString SlotName;
-	UGameSaveData* SaveGameInstance = nullptr;
+	TArray<FSaveSlotInfo> SaveSlots;
+	SlotInfoCache.GenerateValueArray(SaveSlots);
+
+	// Sort by timestamp (most recent first)
+	SaveSlots.Sort([](const FSaveSlotInfo& A, const FSaveSlotInfo& B) {
+		return A.Timestamp > B.Timestamp;
+	});
+
+	return SaveSlots;
+}
+
+FSaveSlotInfo USaveSystemSubsystem::GetMostRecentSaveSlot() const
+{
+	EnsureSlotInfoCache();
 	
-	for (const FString& SaveFile : SaveFiles)
+	const FSaveSlotInfo* MostRecent = nullptr;
+	for (const TPair<FString, FSaveSlotInfo>& Pair : SlotInfoCache)
 	{
-		FString FileName = FPaths::GetBaseFilename(SaveFile);
-		if (FileName.StartsWith(SlotPrefix))
+		if (!MostRecent || Pair.Value.Timestamp > MostRecent->Timestamp)
 		{
-			// Found a matching file - try to load it
-			SaveGameInstance = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(FileName, 0));
-			if (SaveGameInstance)
-			{
-				SlotName = FileName;
-				break;
-			}
+			MostRecent = &Pair.Value;
 		}
 	}
-	
-	if (SaveGameInstance)
+
+	return MostRecent ? *MostRecent : FSaveSlotInfo();
+}
+
+FSaveSlotInfo USaveSystemSubsystem::ReadSlotInfo(const FString& SlotId, const FString& SlotName) const
+{
+	FSaveSlotInfo Info;
+	Info.SlotId = SlotId;
+	Info.SlotName = SlotName;
+	Info.bExists = false;
+	Info.FileSizeBytes = IFileManager::Get().FileSize(*SaveGameFile::GetSlotFilePath(SlotName));
+	if (Info.FileSizeBytes < 0)
+	{
+		Info.FileSizeBytes = 0;
+		return Info;
+	}
+
+	// Quicksaves since the last snapshot live in the slot's journal
+	const int64 JournalSize = IFileManager::Get().FileSize(*SaveGameFile::GetSlotJournalPath(SlotName));
+	if (JournalSize > 0)
+	{
+		Info.FileSizeBytes += JournalSize;
+	}
+
+	// Normal case: only the small header at the front of the file is read
+	FSaveFileHeader Header;
+	if (SaveGameFile::ReadSlotHeader(SlotName, Header))
 	{
 		Info.bExists = true;
-		Info.SaveName = SaveGameInstance->GetSaveName();
-		Info.Timestamp = SaveGameInstance->GetFormattedTimestamp();
+		Info.SaveName = Header.SaveName;
+		Info.Timestamp = Header.Timestamp;
+		Info.LevelPackagePath = Header.LevelPackagePath;
+		Info.PlaytimeSeconds = Header.PlaytimeSeconds;
+		Info.UncompressedSizeBytes = Header.UncompressedSize;
+		return Info;
 	}
-	else
+
+	// No readable header - only the core holds what the listing needs (legacy files are still read whole),
+	// after which the result stays cached
+	if (UGameSaveData* SaveGameInstance = SaveGameFile::ReadSections(SlotName, ESaveSectionFlags::None))
 	{
-		Info.bExists = false;
+		Info.bExists = true;
+		Info.SaveName = SaveGameInstance->GetSaveName();
+		Info.Timestamp = SaveGameInstance->GetFormattedTimestamp();
+		Info.LevelPackagePath = SaveGameInstance->LevelPackagePath;
+		Info.PlaytimeSeconds = SaveGameInstance->PlaytimeSeconds;
+		Info.UncompressedSizeBytes = Info.FileSizeBytes;
 	}
 
 	return Info;
 }
 
-bool USaveSystemSubsystem::DoesSaveSlotExist(const FString& SlotId) const
+void USaveSystemSubsystem::EnsureSlotInfoCache() const
 {
-	// Find the save file - it has the save name in the filename
-	// Search for files starting with SaveSlot_{SlotId}_
-	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-	IFileManager& FileManager = IFileManager::Get();
-	TArray<FString> SaveFiles;
-	FileManager.FindFiles(SaveFiles, *SaveDir, TEXT("*.sav"));
-	
-	FString SlotPrefix = FString::Printf(TEXT("SaveSlot_%s_"), *SlotId);
-	
-	for (const FString& SaveFile : SaveFiles)
+	if (bSlotInfoCacheValid)
 	{
-		FString FileName = FPaths::GetBaseFilename(SaveFile);
-		if (FileName.StartsWith(SlotPrefix))
-		{
-			// Found a matching file
-			return true;
-		}
+		return;
 	}
-	
-	return false;
-}
 
-TArray<FSaveSlotInfo> USaveSystemSubsystem::GetAllSaveSlots() const
-{
-	TArray<FSaveSlotInfo> SaveSlots;
+	SlotInfoCache.Reset();
 
 	// Enumerate save files from the save directory
 	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
@@ -1364,7 +1482,8 @@ TArray<FSaveSlotInfo> USaveSystemSubsystem::GetAllSaveSlots() const
 	if (!FileManager.DirectoryExists(*SaveDir))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Save directory does not exist: %s"), *SaveDir);
-		return SaveSlots;
+		bSlotInfoCacheValid = true;
+		return;
 	}
 
 	// Use IFileManager::FindFiles - this requires full file paths with wildcards
@@ -1411,52 +1530,64 @@ TArray<FSaveSlotInfo> USaveSystemSubsystem::GetAllSaveSlots() const
 		
 	}
 
-	// Process each save file
+	// Read each save slot's header (one directory scan, no full loads for current-format saves)
 	for (const FString& SaveFile : SaveFiles)
 	{
 		// Get the base filename without extension and path
 		FString FileName = FPaths::GetBaseFilename(SaveFile);
 		
-		
 		// Check if it's a save slot (starts with "SaveSlot_")
-		if (FileName.StartsWith(TEXT("SaveSlot_")))
+		if (!FileName.StartsWith(TEXT("SaveSlot_")))
 		{
-			FString SlotId = GetSlotIdFromSlotName(FileName);
-			
-			FSaveSlotInfo Info = GetSaveSlotInfo(SlotId);
-			if (Info.bExists)
-			{
-				SaveSlots.Add(Info);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Save slot file exists but failed to load: %s"), *SlotId);
-			}
+			continue;
 		}
-		else
+
+		FString SlotId = GetSlotIdFromSlotName(FileName);
+		FSaveSlotInfo Info = ReadSlotInfo(SlotId, FileName);
+		if (!Info.bExists)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] Save slot file exists but failed to load: %s"), *SlotId);
+			continue;
+		}
+
+		// If a slot was saved under several names, keep the newest file
+		const FSaveSlotInfo* Existing = SlotInfoCache.Find(SlotId);
+		if (!Existing || Info.Timestamp > Existing->Timestamp)
 		{
+			SlotInfoCache.Add(SlotId, Info);
 		}
 	}
 
+	bSlotInfoCacheValid = true;
+}
 
-	// Sort by timestamp (most recent first)
-	SaveSlots.Sort([](const FSaveSlotInfo& A, const FSaveSlotInfo& B) {
-		return A.Timestamp > B.Timestamp;
-	});
+void USaveSystemSubsystem::RefreshSlotInfo(const FString& SlotId, const FString& SlotName) const
+{
+	// Not built yet - the first query will scan everything anyway
+	if (!bSlotInfoCacheValid)
+	{
+		return;
+	}
 
-	return SaveSlots;
+	FSaveSlotInfo Info = ReadSlotInfo(SlotId, SlotName);
+	if (Info.bExists)
+	{
+		SlotInfoCache.Add(SlotId, Info);
+	}
+	else
+	{
+		SlotInfoCache.Remove(SlotId);
+	}
 }
 
-FSaveSlotInfo USaveSystemSubsystem::GetMostRecentSaveSlot() const
+void USaveSystemSubsystem::AccumulatePlaytime(UGameSaveData* SaveData)
 {
-	TArray<FSaveSlotInfo> AllSlots = GetAllSaveSlots();
-	
-	if (AllSlots.Num() > 0)
+	const double Now = FPlatformTime::Seconds();
+	if (SaveData && PlaytimeAnchorSeconds > 0.0)
 	{
-		return AllSlots[0]; // Already sorted by timestamp
+		SaveData->PlaytimeSeconds += static_cast<float>(Now - PlaytimeAnchorSeconds);
 	}
-
-	return FSaveSlotInfo();
+	PlaytimeAnchorSeconds = Now;
 }
 
 bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FString& SaveName)
@@ -1488,10 +1619,17 @@ bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FStrin
 		return false;
 	}
 
+	// A new game starts without any records captured for an earlier save
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World))
+	{
+		Registry->ResetCapturedStates();
+	}
+
 	// Set as current save data (the "running" save game)
 	CurrentSaveData = SaveGameInstance;
 	CurrentSlotId = SlotId;
 	CurrentSaveName = SaveName.IsEmpty() ? FString::Printf(TEXT("Save %s"), *SlotId) : SaveName;
+	PlaytimeAnchorSeconds = FPlatformTime::Seconds();
 
 	// Save player location and rotation (current spawn location)
 	SaveGameInstance->PlayerLocation = PlayerCharacter->GetActorLocation();
@@ -1502,13 +1640,6 @@ bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FStrin
 	SaveGameInstance->PlayerData.Location = PlayerCharacter->GetActorLocation();
 	SaveGameInstance->PlayerData.Rotation = PlayerCharacter->GetActorRotation();
 	
-	// Save hunger stats
-	if (UHungerComponent* HungerComp = PlayerCharacter->GetHunger())
-	{
-		SaveGameInstance->PlayerData.CurrentHunger = HungerComp->GetCurrentHunger();
-		SaveGameInstance->PlayerData.MaxHunger = HungerComp->GetMaxHunger();
-	}
-	
 	// Save player's dimension instance ID (which dimension the player is currently in)
 	UGameInstance* GameInstance = World->GetGameInstance();
 	if (GameInstance)
@@ -1525,45 +1656,8 @@ bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FStrin
 		}
 	}
 
-	// Save inventory
-	if (UInventoryComponent* InventoryComp = PlayerCharacter->GetInventory())
-	{
-		SaveGameInstance->InventoryData.SerializedEntries = 
-			StorageSerialization::SerializeStorageEntries(InventoryComp->GetEntries());
-	}
-
-	// Save hotbar
-	if (UHotbarComponent* HotbarComp = PlayerCharacter->GetHotbar())
-	{
-		SaveGameInstance->HotbarData.ActiveIndex = HotbarComp->GetActiveIndex();
-		SaveGameInstance->HotbarData.AssignedItemPaths.Empty();
-		
-		for (int32 i = 0; i < HotbarComp->GetNumSlots(); ++i)
-		{
-			const FHotbarSlot& Slot = HotbarComp->GetSlot(i);
-			if (Slot.AssignedType)
-			{
-				SaveGameInstance->HotbarData.AssignedItemPaths.Add(Slot.AssignedType->GetPathName());
-			}
-			else
-			{
-				SaveGameInstance->HotbarData.AssignedItemPaths.Add(FString()); // Empty string for unassigned slots
-			}
-		}
-	}
-
-	// Save equipment
-	if (UEquipmentComponent* EquipmentComp = PlayerCharacter->GetEquipment())
-	{
-		SaveGameInstance->EquipmentData.SerializedEquippedItems.Empty();
-		TMap<EEquipmentSlot, FItemEntry> EquippedItems = EquipmentComp->GetAllEquippedItems();
-		
-		for (const auto& Pair : EquippedItems)
-		{
-			FString Serialized = SaveSystemHelpers::SerializeEquipmentSlot(Pair.Key, Pair.Value);
-			SaveGameInstance->EquipmentData.SerializedEquippedItems.Add(Serialized);
-		}
-	}
+	// Save player component state (same as SaveGame)
+	ComponentSaveState::CaptureActor(PlayerCharacter, SaveGameInstance->PlayerData.ComponentStates);
 	
 	// Save current level package path (same logic as SaveGame)
 	FString LevelPackagePath;
@@ -1696,32 +1790,31 @@ bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FStrin
 			}
 		}
 
-		// Check for storage component
-		UStorageComponent* StorageComp = Actor->FindComponentByClass<UStorageComponent>();
-		if (StorageComp)
-		{
-			ActorState.bHasStorage = true;
-			TArray<FItemEntry> StorageEntries = StorageComp->GetEntries();
-			ActorState.SerializedStorageEntries = StorageSerialization::SerializeStorageEntries(StorageEntries);
-			ActorState.StorageMaxVolume = StorageComp->MaxVolume;
-		}
+		// Capture component state (storage contents and any other SaveGame properties)
+		SaveSystemHelpers::CaptureActorComponents(Actor, ActorState);
 
 		SaveGameInstance->ActorStates.Add(ActorState);
 	}
 	
 	// Establish baseline (all current actors are part of the baseline for a new game)
 	SaveGameInstance->BaselineActorIds = CurrentActorIds;
+	SaveGameInstance->bDeterministicActorIds = true;
+
+	// Each new game gets its own scan sequence
+	SaveGameInstance->DimensionScanSeed = FMath::RandRange(1, MAX_int32);
 	UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Established new baseline with %d actors"), SaveGameInstance->BaselineActorIds.Num());
 	
 	// Set timestamp
 	FDateTime Now = FDateTime::Now();
 	SaveGameInstance->Timestamp = Now.ToString(TEXT("%Y.%m.%d %H:%M:%S"));
 
-	// Save to slot (SlotName was already computed above)
-	bool bSuccess = UGameplayStatics::SaveGameToSlot(SaveGameInstance, SlotName, 0);
+	// Save to slot (SlotName was already computed above); this replaces any journal the slot had
+	ResetSlotJournal(SlotName);
+	bool bSuccess = SaveGameFile::SaveToSlot(SaveGameInstance, SlotName);
 	
 	if (bSuccess)
 	{
+		RefreshSlotInfo(SlotId, SlotName);
 		UE_LOG(LogTemp, Display, TEXT("[SaveSystem] Successfully created new game save to slot: %s (Level: %s)"), *SlotName, *NormalizedPath);
 	}
 	else
@@ -1732,6 +1825,102 @@ bool USaveSystemSubsystem::CreateNewGameSave(const FString& SlotId, const FStrin
 	return bSuccess;
 }
 
+void USaveSystemSubsystem::StartTimeSlicedRestore(UWorld* World, TSharedRef<FSaveRestoreScheduler> Scheduler, TFunction<void()> OnComplete)
+{
+	if (ActiveRestore.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] New restore started while another was in progress - finishing the previous one now"));
+		ActiveRestore->Tick(TNumericLimits<double>::Max());
+		FinishTimeSlicedRestore();
+	}
+
+	ActiveRestore = Scheduler;
+	ActiveRestoreWorld = World;
+	ActiveRestoreOnComplete = MoveTemp(OnComplete);
+
+	UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Starting time-sliced restore of %d records (%.1f ms per frame)"),
+		Scheduler->GetNumItems(), RestoreFrameBudgetMs);
+
+	if (!World)
+	{
+		// Nothing to tick on - apply everything now
+		Scheduler->Tick(TNumericLimits<double>::Max());
+		FinishTimeSlicedRestore();
+		return;
+	}
+
+	// First slice runs immediately so small saves finish in the frame they were loaded
+	TickTimeSlicedRestore();
+}
+
+float USaveSystemSubsystem::GetRestoreProgress() const
+{
+	return ActiveRestore.IsValid() ? ActiveRestore->GetProgress() : 1.0f;
+}
+
+void USaveSystemSubsystem::TickTimeSlicedRestore()
+{
+	if (!ActiveRestore.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = ActiveRestoreWorld.Get();
+	if (!World)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SaveSystem] World went away during time-sliced restore - abandoning it"));
+		ActiveRestore.Reset();
+		ActiveRestoreOnComplete = nullptr;
+		return;
+	}
+
+	const bool bComplete = ActiveRestore->Tick(FMath::Max(RestoreFrameBudgetMs, 0.5f) / 1000.0);
+	const float Progress = ActiveRestore->GetProgress();
+
+	if (AFirstPersonPlayerController* FirstPersonPC = Cast<AFirstPersonPlayerController>(UGameplayStatics::GetPlayerController(World, 0)))
+	{
+		if (FirstPersonPC->LoadingFadeWidget)
+		{
+			FirstPersonPC->LoadingFadeWidget->SetLoadProgress(Progress);
+		}
+	}
+	OnWorldRestoreProgress.Broadcast(Progress);
+
+	if (bComplete)
+	{
+		FinishTimeSlicedRestore();
+		return;
+	}
+
+	RestoreTickHandle = World->GetTimerManager().SetTimerForNextTick(this, &USaveSystemSubsystem::TickTimeSlicedRestore);
+}
+
+void USaveSystemSubsystem::FinishTimeSlicedRestore()
+{
+	if (!ActiveRestore.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Time-sliced restore finished (%d records)"), ActiveRestore->GetNumProcessed());
+
+	// Clear state first: the completion may start another restore or a fade that checks IsRestoreInProgress
+	ActiveRestore.Reset();
+	TFunction<void()> OnComplete = MoveTemp(ActiveRestoreOnComplete);
+	ActiveRestoreOnComplete = nullptr;
+
+	if (UWorld* World = ActiveRestoreWorld.Get())
+	{
+		World->GetTimerManager().ClearTimer(RestoreTickHandle);
+	}
+
+	if (OnComplete)
+	{
+		OnComplete();
+	}
+	OnWorldRestoreCompleted.Broadcast();
+}
+
 void USaveSystemSubsystem::FadeInAfterLoad()
 {
 	UWorld* World = GetWorld();
@@ -1740,6 +1929,15 @@ void USaveSystemSubsystem::FadeInAfterLoad()
 		return;
 	}
 
+	// Don't reveal a half-restored world: fade in once the time-sliced restore completes
+	if (IsRestoreInProgress())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[SaveSystem] FadeInAfterLoad waiting for world restore to complete"));
+		OnWorldRestoreCompleted.AddUniqueDynamic(this, &USaveSystemSubsystem::FadeInAfterLoad);
+		return;
+	}
+	OnWorldRestoreCompleted.RemoveDynamic(this, &USaveSystemSubsystem::FadeInAfterLoad);
+
 	// Fade in after loading completes (for same-level loads)
 	APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
 	AFirstPersonPlayerController* FirstPersonPC = Cast<AFirstPersonPlayerController>(PC);
@@ -1766,58 +1964,60 @@ void USaveSystemSubsystem::CheckAndCreatePendingNewGameSave()
 		return;
 	}
 
-	// Check for any pending new game saves (stored with prefix "_NEWGAME_")
-	FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
-	IFileManager& FileManager = IFileManager::Get();
-	
-	if (!FileManager.DirectoryExists(*SaveDir))
+	// Check for a pending new game (set by the main menu before opening MainMap)
+	if (!HasPendingNewGame())
 	{
 		return;
 	}
 
-	// Find all pending new game saves
-	TArray<FString> SaveFiles;
-	FString SearchPattern = SaveDir / TEXT("*.sav");
-	FileManager.FindFiles(SaveFiles, *SearchPattern, true, false);
-	
-	for (const FString& SaveFile : SaveFiles)
+	const FString SlotId = PendingNewGameSlotId;
+	const FString SaveName = PendingNewGameSaveName;
+
+	// Wait for player to spawn, then create the actual save
+	// Use a timer to ensure player is fully loaded
+	FTimerHandle TimerHandle;
+	World->GetTimerManager().SetTimer(TimerHandle, [this, World, SlotId, SaveName]()
 	{
-		FString FileName = FPaths::GetBaseFilename(SaveFile);
+		// Get player character
+		APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+		AFirstPersonCharacter* PlayerCharacter = Cast<AFirstPersonCharacter>(PlayerPawn);
 		
-		// Check if it's a pending new game save
-		if (FileName.StartsWith(TEXT("_NEWGAME_")))
+		if (PlayerCharacter)
 		{
-			// Load the pending save info
-			if (UGameSaveData* PendingSave = Cast<UGameSaveData>(UGameplayStatics::LoadGameFromSlot(FileName, 0)))
-			{
-				// Extract slot ID from filename (remove "_NEWGAME_" prefix)
-				FString SlotId = FileName.RightChop(9); // Length of "_NEWGAME_"
-				
-				// Wait for player to spawn, then create the actual save
-				// Use a timer to ensure player is fully loaded
-				FTimerHandle TimerHandle;
-				World->GetTimerManager().SetTimer(TimerHandle, [this, World, SlotId, PendingSave]()
-				{
-					// Get player character
-					APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
-					AFirstPersonCharacter* PlayerCharacter = Cast<AFirstPersonCharacter>(PlayerPawn);
-					
-					if (PlayerCharacter)
-					{
-						// Create the actual save with current player position
-						CreateNewGameSave(SlotId, PendingSave->SaveName);
-						
-						// Clean up pending save
-						FString PendingSlotName = FString::Printf(TEXT("_NEWGAME_%s"), *SlotId);
-						UGameplayStatics::DeleteGameInSlot(PendingSlotName, 0);
-						
-					}
-				}, 0.5f, false); // 0.5 second delay to ensure player is spawned
-				
-				break; // Only handle one pending save at a time
-			}
+			// Create the actual save with current player position
+			CreateNewGameSave(SlotId, SaveName);
+			
+			// Clear the pending new game
+			PendingNewGameSlotId.Empty();
+			PendingNewGameSaveName.Empty();
 		}
-	}
+	}, 0.5f, false); // 0.5 second delay to ensure player is spawned
+}
+
+void USaveSystemSubsystem::SetPendingNewGame(const FString& SlotId, const FString& SaveName)
+{
+	PendingNewGameSlotId = SlotId;
+	PendingNewGameSaveName = SaveName;
+}
+
+void USaveSystemSubsystem::SetPendingRestore(UGameSaveData* SaveData)
+{
+	PendingRestoreData = SaveData;
+}
+
+UGameSaveData* USaveSystemSubsystem::GetPendingRestore() const
+{
+	return PendingRestoreData;
+}
+
+bool USaveSystemSubsystem::HasPendingRestore() const
+{
+	return PendingRestoreData != nullptr;
+}
+
+void USaveSystemSubsystem::ClearPendingRestore()
+{
+	PendingRestoreData = nullptr;
 }
 
 bool USaveSystemSubsystem::SaveDimensionInstance(FGuid InstanceId)
@@ -1917,6 +2117,60 @@ bool USaveSystemSubsystem::LoadDimensionInstance(FGuid InstanceId)
 	return SaveSystemDimensionHelpers::LoadDimensionInstance(World, CurrentSaveData, DimensionManager, InstanceId);
 }
 
+void USaveSystemSubsystem::PrefetchDimensionState(FGuid InstanceId)
+{
+	if (!InstanceId.IsValid() || !CurrentSaveData || DimensionStatePrefetches.Contains(InstanceId))
+	{
+		return;
+	}
+
+	const FDimensionInstanceSaveData* Dimension = CurrentSaveData->DimensionInstances.FindByPredicate(
+		[&InstanceId](const FDimensionInstanceSaveData& DimData) { return DimData.InstanceId == InstanceId; });
+	if (!Dimension || Dimension->bActorStatesResident)
+	{
+		return;
+	}
+
+	DimensionStatePrefetches.Add(InstanceId);
+	const FString SidecarSlotName = CurrentSaveData->SidecarSlotName;
+	TWeakObjectPtr<USaveSystemSubsystem> WeakThis(this);
+	TWeakObjectPtr<UGameSaveData> WeakSaveData(CurrentSaveData);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, WeakSaveData, SidecarSlotName, InstanceId]()
+	{
+		TSharedRef<FDimensionInstanceSaveData> Loaded = MakeShared<FDimensionInstanceSaveData>();
+		const bool bRead = SaveGameFile::ReadDimensionSidecar(SidecarSlotName, InstanceId, *Loaded);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakSaveData, SidecarSlotName, InstanceId, Loaded, bRead]()
+		{
+			USaveSystemSubsystem* SaveSystem = WeakThis.Get();
+			if (!SaveSystem)
+			{
+				return;
+			}
+			SaveSystem->DimensionStatePrefetches.Remove(InstanceId);
+
+			// Only adopt the states if they still belong to the save being played; otherwise (or if the read
+			// failed) LoadDimensionInstance reads the sidecar itself and reports the problem there
+			UGameSaveData* SaveData = WeakSaveData.Get();
+			if (!bRead || !SaveData || SaveData != SaveSystem->CurrentSaveData || SaveData->SidecarSlotName != SidecarSlotName)
+			{
+				return;
+			}
+
+			FDimensionInstanceSaveData* Dimension = SaveData->DimensionInstances.FindByPredicate(
+				[&InstanceId](const FDimensionInstanceSaveData& DimData) { return DimData.InstanceId == InstanceId; });
+			if (Dimension && !Dimension->bActorStatesResident)
+			{
+				Dimension->ActorStates = MoveTemp(Loaded->ActorStates);
+				Dimension->BaselineActorIds = MoveTemp(Loaded->BaselineActorIds);
+				Dimension->bActorStatesResident = true;
+				UE_LOG(LogTemp, Log, TEXT("[SaveSystem] Prefetched sidecar for dimension %s: %d actor states"),
+					*InstanceId.ToString(), Dimension->ActorStates.Num());
+			}
+		});
+	});
+}
+
 TArray<AActor*> USaveSystemSubsystem::GetActorsForDimension(UWorld* World, FGuid InstanceId) const
 {
 	TArray<AActor*> DimensionActors;
@@ -1926,19 +2180,9 @@ TArray<AActor*> USaveSystemSubsystem::GetActorsForDimension(UWorld* World, FGuid
 		return DimensionActors;
 	}
 
-	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	if (USaveableActorRegistry* Registry = USaveableActorRegistry::Get(World))
 	{
-		AActor* Actor = *ActorIterator;
-		if (!Actor)
-		{
-			continue;
-		}
-
-		USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
-		if (SaveableComp && SaveableComp->GetDimensionInstanceId() == InstanceId)
-		{
-			DimensionActors.Add(Actor);
-		}
+		DimensionActors = Registry->GetActorsForDimension(InstanceId);
 	}
 
 	return DimensionActors;
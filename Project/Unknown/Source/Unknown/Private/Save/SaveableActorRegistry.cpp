@@ -0,0 +1,203 @@
+#include "Save/SaveableActorRegistry.h"
+#include "Components/SaveableActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+USaveableActorRegistry* USaveableActorRegistry::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<USaveableActorRegistry>() : nullptr;
+}
+
+void USaveableActorRegistry::Deinitialize()
+{
+	ComponentsById.Empty();
+	ComponentsByDimension.Empty();
+	CapturedStates.Empty();
+	Super::Deinitialize();
+}
+
+void USaveableActorRegistry::Register(USaveableActorComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	const FGuid PersistentId = Component->GetPersistentId();
+	if (PersistentId.IsValid())
+	{
+		const TWeakObjectPtr<USaveableActorComponent>* Existing = ComponentsById.Find(PersistentId);
+		if (Existing && Existing->IsValid() && Existing->Get() != Component)
+		{
+			// Two live actors claiming one ID usually means a GUID restore is still in progress; last one wins
+			UE_LOG(LogTemp, Verbose, TEXT("[SaveableActorRegistry] Duplicate persistent ID %s (%s replaces %s)"),
+				*PersistentId.ToString(EGuidFormats::DigitsWithHyphensInBraces),
+				Component->GetOwner() ? *Component->GetOwner()->GetName() : TEXT("Unknown"),
+				Existing->Get()->GetOwner() ? *Existing->Get()->GetOwner()->GetName() : TEXT("Unknown"));
+		}
+		ComponentsById.Add(PersistentId, Component);
+	}
+
+	AddToDimension(Component, Component->GetDimensionInstanceId());
+}
+
+void USaveableActorRegistry::Unregister(USaveableActorComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	// Only drop the ID entry if it still points at this component (a duplicate may have replaced it)
+	const FGuid PersistentId = Component->GetPersistentId();
+	if (const TWeakObjectPtr<USaveableActorComponent>* Existing = ComponentsById.Find(PersistentId))
+	{
+		if (!Existing->IsValid() || Existing->Get() == Component)
+		{
+			ComponentsById.Remove(PersistentId);
+			CapturedStates.Remove(PersistentId);
+		}
+	}
+
+	RemoveFromDimension(Component, Component->GetDimensionInstanceId());
+}
+
+void USaveableActorRegistry::UpdatePersistentId(USaveableActorComponent* Component, const FGuid& OldId)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	if (const TWeakObjectPtr<USaveableActorComponent>* Existing = ComponentsById.Find(OldId))
+	{
+		if (Existing->Get() == Component)
+		{
+			ComponentsById.Remove(OldId);
+			CapturedStates.Remove(OldId);
+		}
+	}
+
+	const FGuid NewId = Component->GetPersistentId();
+	if (NewId.IsValid())
+	{
+		ComponentsById.Add(NewId, Component);
+	}
+}
+
+void USaveableActorRegistry::UpdateDimensionInstanceId(USaveableActorComponent* Component, const FGuid& OldInstanceId)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	RemoveFromDimension(Component, OldInstanceId);
+	AddToDimension(Component, Component->GetDimensionInstanceId());
+}
+
+USaveableActorComponent* USaveableActorRegistry::FindComponent(const FGuid& PersistentId) const
+{
+	if (!PersistentId.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TWeakObjectPtr<USaveableActorComponent>* Found = ComponentsById.Find(PersistentId);
+	USaveableActorComponent* Component = Found ? Found->Get() : nullptr;
+
+	// Guard against stale entries (e.g. the ID changed without going through SetPersistentId)
+	return (Component && Component->GetPersistentId() == PersistentId) ? Component : nullptr;
+}
+
+AActor* USaveableActorRegistry::FindActor(const FGuid& PersistentId) const
+{
+	USaveableActorComponent* Component = FindComponent(PersistentId);
+	return Component ? Component->GetOwner() : nullptr;
+}
+
+TArray<AActor*> USaveableActorRegistry::GetActorsForDimension(const FGuid& InstanceId) const
+{
+	TArray<AActor*> DimensionActors;
+	if (!InstanceId.IsValid())
+	{
+		return DimensionActors;
+	}
+
+	if (const TSet<TWeakObjectPtr<USaveableActorComponent>>* Bucket = ComponentsByDimension.Find(InstanceId))
+	{
+		DimensionActors.Reserve(Bucket->Num());
+		for (const TWeakObjectPtr<USaveableActorComponent>& WeakComponent : *Bucket)
+		{
+			USaveableActorComponent* Component = WeakComponent.Get();
+			if (Component && Component->GetDimensionInstanceId() == InstanceId)
+			{
+				if (AActor* Owner = Component->GetOwner())
+				{
+					DimensionActors.Add(Owner);
+				}
+			}
+		}
+	}
+
+	return DimensionActors;
+}
+
+TArray<USaveableActorComponent*> USaveableActorRegistry::GetComponents() const
+{
+	TArray<USaveableActorComponent*> Components;
+	Components.Reserve(ComponentsById.Num());
+	for (const TPair<FGuid, TWeakObjectPtr<USaveableActorComponent>>& Pair : ComponentsById)
+	{
+		USaveableActorComponent* Component = Pair.Value.Get();
+		if (Component && Component->GetPersistentId() == Pair.Key)
+		{
+			Components.Add(Component);
+		}
+	}
+	return Components;
+}
+
+const FActorStateSaveData* USaveableActorRegistry::FindCapturedState(const USaveableActorComponent* Component) const
+{
+	if (!Component || Component->IsSaveStateDirty())
+	{
+		return nullptr;
+	}
+	return CapturedStates.Find(Component->GetPersistentId());
+}
+
+void USaveableActorRegistry::StoreCapturedState(USaveableActorComponent* Component, const FActorStateSaveData& State)
+{
+	if (!Component || !State.ActorId.IsValid())
+	{
+		return;
+	}
+	CapturedStates.Add(State.ActorId, State);
+	Component->MarkSaveStateCaptured();
+}
+
+void USaveableActorRegistry::AddToDimension(USaveableActorComponent* Component, const FGuid& InstanceId)
+{
+	if (InstanceId.IsValid())
+	{
+		ComponentsByDimension.FindOrAdd(InstanceId).Add(Component);
+	}
+}
+
+void USaveableActorRegistry::RemoveFromDimension(USaveableActorComponent* Component, const FGuid& InstanceId)
+{
+	if (!InstanceId.IsValid())
+	{
+		return;
+	}
+
+	if (TSet<TWeakObjectPtr<USaveableActorComponent>>* Bucket = ComponentsByDimension.Find(InstanceId))
+	{
+		Bucket->Remove(Component);
+		if (Bucket->Num() == 0)
+		{
+			ComponentsByDimension.Remove(InstanceId);
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#include "Save/SaveableActorSpatialIndex.h"
+#include "Components/SaveableActorComponent.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+
+FSaveableActorSpatialIndex::FSaveableActorSpatialIndex(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FSaveableActorSpatialIndex::Add(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	USaveableActorComponent* SaveableComp = Actor->FindComponentByClass<USaveableActorComponent>();
+	if (!SaveableComp)
+	{
+		return;
+	}
+
+	const FName ClassPath = GetClassPathName(Actor->GetClass());
+	const FVector CurrentLocation = Actor->GetActorLocation();
+	const FVector OriginalLocation = SaveableComp->OriginalTransform.GetLocation();
+
+	// Matchers compare against OriginalTransform when it is set and the live transform otherwise,
+	// so index both positions when they differ
+	AddEntry(ClassPath, Actor, CurrentLocation);
+	if (!OriginalLocation.IsNearlyZero() && ToCell(OriginalLocation) != ToCell(CurrentLocation))
+	{
+		AddEntry(ClassPath, Actor, OriginalLocation);
+	}
+	NumActors++;
+}
+
+void FSaveableActorSpatialIndex::AddWorldActors(UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> ActorIterator(World); ActorIterator; ++ActorIterator)
+	{
+		Add(*ActorIterator);
+	}
+}
+
+void FSaveableActorSpatialIndex::AddLevelActors(ULevel* Level)
+{
+	if (!Level)
+	{
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		Add(Actor);
+	}
+}
+
+void FSaveableActorSpatialIndex::Query(FName ClassPath, const FVector& Center, float Radius, TArray<AActor*>& OutCandidates) const
+{
+	const FIntVector MinCell = ToCell(Center - FVector(Radius));
+	const FIntVector MaxCell = ToCell(Center + FVector(Radius));
+	const float RadiusSquared = Radius * Radius;
+
+	// Gather matches from the neighbourhood, then restore insertion order
+	TArray<TPair<int32, AActor*>> Found;
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<FEntry>* Bucket = Buckets.Find(FCellKey{ ClassPath, FIntVector(X, Y, Z) });
+				if (!Bucket)
+				{
+					continue;
+				}
+
+				for (const FEntry& Entry : *Bucket)
+				{
+					AActor* Actor = Entry.Actor.Get();
+					if (IsValid(Actor) && FVector::DistSquared(Entry.Location, Center) <= RadiusSquared)
+					{
+						Found.Emplace(Entry.Order, Actor);
+					}
+				}
+			}
+		}
+	}
+
+	Found.Sort([](const TPair<int32, AActor*>& A, const TPair<int32, AActor*>& B) { return A.Key < B.Key; });
+	for (const TPair<int32, AActor*>& Pair : Found)
+	{
+		OutCandidates.AddUnique(Pair.Value);
+	}
+}
+
+FIntVector FSaveableActorSpatialIndex::ToCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+FName FSaveableActorSpatialIndex::GetClassPathName(const UClass* Class)
+{
+	if (const FName* Cached = ClassPathNames.Find(Class))
+	{
+		return *Cached;
+	}
+	return ClassPathNames.Add(Class, InternClassPath(Class->GetPathName()));
+}
+
+void FSaveableActorSpatialIndex::AddEntry(FName ClassPath, AActor* Actor, const FVector& Location)
+{
+	Buckets.FindOrAdd(FCellKey{ ClassPath, ToCell(Location) }).Add(FEntry{ Actor, Location, NumActors });
+}
@@ -0,0 +1,236 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/ActorStateTable.h"
+
+namespace
+{
+    FActorStateSaveData MakePickupState(const FString& Name)
+    {
+        FActorStateSaveData State;
+        State.ActorId = FGuid::NewGuid();
+        State.ActorName = Name;
+        State.ActorClassPath = TEXT("/Game/Blueprints/BP_ItemPickup.BP_ItemPickup_C");
+        State.OriginalSpawnTransform = FTransform(FVector(1.0, 2.0, 3.0));
+        State.Location = FVector(10.0, 20.0, 30.0);
+        State.Rotation = FRotator(0.0, 90.0, 0.0);
+        State.Scale = FVector::OneVector;
+        State.bIsNewObject = true;
+        State.SpawnActorClassPath = State.ActorClassPath;
+        State.ItemDefinitionPath = TEXT("/Game/Items/DA_Wrench.DA_Wrench");
+        State.SerializedItemEntry = Name + TEXT("|Entry");
+        return State;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorStateTable_RoundTrip,
+    "Project.Save.ActorStateTable.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FActorStateTable_RoundTrip::RunTest(const FString& Parameters)
+{
+    TArray<FActorStateSaveData> States;
+    States.Add(MakePickupState(TEXT("Pickup_1")));
+    States.Add(MakePickupState(TEXT("Pickup_2")));
+
+    FActorStateSaveData& Crate = States.AddDefaulted_GetRef();
+    Crate.ActorId = FGuid::NewGuid();
+    Crate.ActorName = TEXT("Crate_1");
+    Crate.ActorClassPath = TEXT("/Game/Blueprints/BP_Crate.BP_Crate_C");
+    Crate.Location = FVector(5.0, 5.0, 5.0);
+    Crate.Rotation = FRotator::ZeroRotator;
+    Crate.Scale = FVector(2.0);
+    Crate.bHasPhysics = true;
+    Crate.bSimulatePhysics = true;
+    Crate.LinearVelocity = FVector(0.0, 0.0, -10.0);
+    Crate.AngularVelocity = FVector::ZeroVector;
+    Crate.bHasStorage = true;
+    Crate.SerializedStorageEntries = TEXT("Storage");
+    Crate.StorageMaxVolume = 120.0f;
+
+    FPackedActorStateSaveData Packed;
+    ActorStateTable::Pack(States, Packed);
+
+    // Three actor names plus the shared pickup class, crate class and item definition
+    TestEqual(TEXT("Shared paths are stored once"), Packed.Strings.Num(), 6);
+
+    TArray<FActorStateSaveData> Unpacked;
+    TestTrue(TEXT("Unpacks"), ActorStateTable::Unpack(Packed, Unpacked));
+    if (!TestEqual(TEXT("Record count"), Unpacked.Num(), States.Num()))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        const FActorStateSaveData& Expected = States[Index];
+        const FActorStateSaveData& Actual = Unpacked[Index];
+        TestEqual(TEXT("ActorId"), Actual.ActorId, Expected.ActorId);
+        TestEqual(TEXT("ActorName"), Actual.ActorName, Expected.ActorName);
+        TestEqual(TEXT("ActorClassPath"), Actual.ActorClassPath, Expected.ActorClassPath);
+        TestEqual(TEXT("Location"), Actual.Location, Expected.Location);
+        TestEqual(TEXT("Scale"), Actual.Scale, Expected.Scale);
+        TestEqual(TEXT("bIsNewObject"), Actual.bIsNewObject, Expected.bIsNewObject);
+        TestEqual(TEXT("SpawnActorClassPath"), Actual.SpawnActorClassPath, Expected.SpawnActorClassPath);
+        TestEqual(TEXT("ItemDefinitionPath"), Actual.ItemDefinitionPath, Expected.ItemDefinitionPath);
+        TestEqual(TEXT("SerializedItemEntry"), Actual.SerializedItemEntry, Expected.SerializedItemEntry);
+        TestEqual(TEXT("bHasPhysics"), Actual.bHasPhysics, Expected.bHasPhysics);
+        TestEqual(TEXT("bHasStorage"), Actual.bHasStorage, Expected.bHasStorage);
+    }
+
+    TestEqual(TEXT("Crate velocity"), Unpacked[2].LinearVelocity, Crate.LinearVelocity);
+    TestEqual(TEXT("Crate storage"), Unpacked[2].SerializedStorageEntries, Crate.SerializedStorageEntries);
+    TestEqual(TEXT("Crate volume"), Unpacked[2].StorageMaxVolume, Crate.StorageMaxVolume);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorStateTable_RejectsCorruptTable,
+    "Project.Save.ActorStateTable.RejectsCorruptTable",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FActorStateTable_RejectsCorruptTable::RunTest(const FString& Parameters)
+{
+    TArray<FActorStateSaveData> States;
+    States.Add(MakePickupState(TEXT("Pickup_1")));
+
+    FPackedActorStateSaveData Packed;
+    ActorStateTable::Pack(States, Packed);
+
+    // Dropping the string table leaves every index dangling
+    Packed.Strings.Reset();
+
+    TArray<FActorStateSaveData> Unpacked;
+    AddExpectedError(TEXT("Corrupt actor state record"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestFalse(TEXT("Dangling string index is rejected"), ActorStateTable::Unpack(Packed, Unpacked));
+    TestEqual(TEXT("Nothing is returned"), Unpacked.Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorStateTable_QuantizedTransforms,
+    "Project.Save.ActorStateTable.QuantizedTransforms",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FActorStateTable_QuantizedTransforms::RunTest(const FString& Parameters)
+{
+    TArray<FActorStateSaveData> States;
+
+    // A physics body knocked away from where it spawned and still moving
+    FActorStateSaveData& Moved = States.AddDefaulted_GetRef();
+    Moved.ActorId = FGuid::NewGuid();
+    Moved.OriginalSpawnTransform = FTransform(FRotator(10.0, 20.0, 30.0), FVector(1234.567, -890.123, 45.678), FVector(1.5));
+    Moved.Location = FVector(15234.5678, -1890.1234, 145.6789);
+    Moved.Rotation = FRotator(-35.25, 171.5, 88.125);
+    Moved.Scale = FVector(1.5);
+    Moved.bHasPhysics = true;
+    Moved.bSimulatePhysics = true;
+    Moved.LinearVelocity = FVector(123.456, -7.891, -980.0);
+    Moved.AngularVelocity = FVector(0.12345, -3.14159, 0.5);
+
+    // A body resting exactly where it spawned
+    FActorStateSaveData& Resting = States.AddDefaulted_GetRef();
+    Resting.ActorId = FGuid::NewGuid();
+    Resting.OriginalSpawnTransform = FTransform(FRotator(0.0, 45.0, 0.0), FVector(100.0, 200.0, 300.0));
+    Resting.Location = Resting.OriginalSpawnTransform.GetLocation();
+    Resting.Rotation = Resting.OriginalSpawnTransform.Rotator();
+    Resting.Scale = FVector::OneVector;
+    Resting.bHasPhysics = true;
+    Resting.bSimulatePhysics = true;
+    Resting.LinearVelocity = FVector(0.001, 0.0, 0.0);
+    Resting.AngularVelocity = FVector::ZeroVector;
+
+    FPackedActorStateSaveData Packed;
+    ActorStateTable::Pack(States, Packed);
+
+    TArray<FActorStateSaveData> Unpacked;
+    if (!TestTrue(TEXT("Unpacks"), ActorStateTable::Unpack(Packed, Unpacked)) || !TestEqual(TEXT("Record count"), Unpacked.Num(), 2))
+    {
+        return false;
+    }
+
+    const double RotationTolerance = FMath::DegreesToRadians(ActorStateTable::RotationToleranceDegrees);
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        const FActorStateSaveData& Expected = States[Index];
+        const FActorStateSaveData& Actual = Unpacked[Index];
+        TestTrue(TEXT("Original location is exact"), Actual.OriginalSpawnTransform.GetLocation() == Expected.OriginalSpawnTransform.GetLocation());
+        TestTrue(TEXT("Original rotation within tolerance"),
+            Actual.OriginalSpawnTransform.GetRotation().AngularDistance(Expected.OriginalSpawnTransform.GetRotation()) <= RotationTolerance);
+        TestEqual(TEXT("Original scale"), Actual.OriginalSpawnTransform.GetScale3D(), Expected.OriginalSpawnTransform.GetScale3D());
+        TestEqual(TEXT("Location within tolerance"), Actual.Location, Expected.Location, ActorStateTable::LocationTolerance);
+        TestTrue(TEXT("Rotation within tolerance"),
+            Actual.Rotation.Quaternion().AngularDistance(Expected.Rotation.Quaternion()) <= RotationTolerance);
+        TestEqual(TEXT("Scale"), Actual.Scale, Expected.Scale);
+        TestEqual(TEXT("Linear velocity within one step"), Actual.LinearVelocity, Expected.LinearVelocity, ActorStateTable::LinearVelocityStep);
+        TestEqual(TEXT("Angular velocity within one step"), Actual.AngularVelocity, Expected.AngularVelocity, ActorStateTable::AngularVelocityStep);
+    }
+
+    TestTrue(TEXT("Resting body restores at rest"), Unpacked[1].LinearVelocity.IsZero() && Unpacked[1].AngularVelocity.IsZero());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorStateTable_UnchangedRecordIsSmall,
+    "Project.Save.ActorStateTable.UnchangedRecordIsSmall",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FActorStateTable_UnchangedRecordIsSmall::RunTest(const FString& Parameters)
+{
+    TArray<FActorStateSaveData> States;
+    FActorStateSaveData& Crate = States.AddDefaulted_GetRef();
+    Crate.ActorId = FGuid::NewGuid();
+    Crate.OriginalSpawnTransform = FTransform(FVector(100.0, 200.0, 300.0));
+    Crate.Location = Crate.OriginalSpawnTransform.GetLocation();
+    Crate.Rotation = FRotator::ZeroRotator;
+    Crate.Scale = FVector::OneVector;
+
+    FPackedActorStateSaveData Packed;
+    ActorStateTable::Pack(States, Packed);
+
+    // Table header (8) + flags (1) + ID (16) + two string indices (8) + transform flags (1)
+    // + original location (24) + original rotation (7); the current transform adds nothing
+    TestEqual(TEXT("Only the original transform is stored"), Packed.Records.Num(), 65);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorStateTable_ComponentStates,
+    "Project.Save.ActorStateTable.ComponentStates",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FActorStateTable_ComponentStates::RunTest(const FString& Parameters)
+{
+    const FSoftObjectPath WrenchPath(TEXT("/Game/Items/DA_Wrench.DA_Wrench"));
+
+    TArray<FActorStateSaveData> States;
+    for (int32 Index = 0; Index < 2; ++Index)
+    {
+        FActorStateSaveData& Crate = States.AddDefaulted_GetRef();
+        Crate.ActorId = FGuid::NewGuid();
+        FComponentSaveRecord& Record = Crate.ComponentStates.AddDefaulted_GetRef();
+        Record.ComponentName = TEXT("Storage");
+        Record.Data = { 1, 0, 0, 0, static_cast<uint8>(Index) };
+        Record.AssetReferences.Add(WrenchPath);
+    }
+
+    FPackedActorStateSaveData Packed;
+    ActorStateTable::Pack(States, Packed);
+    TestEqual(TEXT("Component name and asset path are interned"), Packed.Strings.Num(), 3);
+
+    TArray<FActorStateSaveData> Unpacked;
+    if (!TestTrue(TEXT("Unpacks"), ActorStateTable::Unpack(Packed, Unpacked)) || !TestEqual(TEXT("Record count"), Unpacked.Num(), 2))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < States.Num(); ++Index)
+    {
+        if (!TestEqual(TEXT("Component count"), Unpacked[Index].ComponentStates.Num(), 1))
+        {
+            return false;
+        }
+        const FComponentSaveRecord& Record = Unpacked[Index].ComponentStates[0];
+        TestEqual(TEXT("ComponentName"), Record.ComponentName, FName(TEXT("Storage")));
+        TestEqual(TEXT("Data"), Record.Data, States[Index].ComponentStates[0].Data);
+        TestTrue(TEXT("AssetReferences"), Record.AssetReferences.Num() == 1 && Record.AssetReferences[0] == WrenchPath);
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,327 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/ComponentSaveState.h"
+#include "Inventory/StorageComponent.h"
+#include "Inventory/ItemDefinition.h"
+#include "Inventory/InventoryComponent.h"
+#include "Inventory/HotbarComponent.h"
+#include "Inventory/EquipmentComponent.h"
+#include "Inventory/Effects/EquipEffect_Backpack.h"
+#include "Inventory/StorageSerialization.h"
+#include "Player/HungerComponent.h"
+#include "Save/GameSaveData.h"
+#include "Save/SaveSystemHelpers.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/MemoryReader.h"
+
+static FItemEntry MakeEntry_ComponentSaveState(UItemDefinition* Def)
+{
+    FItemEntry Entry;
+    Entry.Def = Def;
+    Entry.ItemId = FGuid::NewGuid();
+    return Entry;
+}
+
+// An actor carrying an inventory and a hotbar, as the player does
+static AActor* MakeCarrier_ComponentSaveState(UInventoryComponent*& OutInventory, UHotbarComponent*& OutHotbar)
+{
+    AActor* Actor = NewObject<AActor>();
+    OutInventory = NewObject<UInventoryComponent>(Actor, TEXT("Inventory"));
+    OutHotbar = NewObject<UHotbarComponent>(Actor, TEXT("Hotbar"));
+    return Actor;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_StorageRoundTrip,
+    "Project.Save.ComponentSaveState.StorageRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_StorageRoundTrip::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = NewObject<UItemDefinition>(GetTransientPackage());
+    Def->VolumePerUnit = 2.f;
+
+    UStorageComponent* Source = NewObject<UStorageComponent>();
+    Source->MaxVolume = 30.f;
+    FItemEntry Entry;
+    Entry.Def = Def;
+    Entry.ItemId = FGuid::NewGuid();
+    Entry.CustomData.Add(TEXT("UsesRemaining"), TEXT("3"));
+    TestTrue(TEXT("Add entry"), Source->TryAdd(Entry));
+
+    TArray<uint8> Data;
+    ComponentSaveState::WriteComponent(Source, Data);
+    TestTrue(TEXT("Storage is captured"), ComponentSaveState::IsCaptured(Source));
+
+    // Restoring replaces whatever the target held
+    UStorageComponent* Target = NewObject<UStorageComponent>();
+    FItemEntry Stale;
+    Stale.Def = Def;
+    Stale.ItemId = FGuid::NewGuid();
+    Target->TryAdd(Stale);
+    TestTrue(TEXT("Reads"), ComponentSaveState::ReadComponent(Target, Data));
+
+    if (!TestEqual(TEXT("Entry count"), Target->GetEntries().Num(), 1))
+    {
+        return false;
+    }
+    const FItemEntry& Restored = Target->GetEntries()[0];
+    TestEqual(TEXT("ItemId"), Restored.ItemId, Entry.ItemId);
+    TestTrue(TEXT("Def"), Restored.Def == Def);
+    TestEqual(TEXT("CustomData"), Restored.CustomData.FindRef(TEXT("UsesRemaining")), FString(TEXT("3")));
+    TestEqual(TEXT("MaxVolume"), Target->MaxVolume, 30.f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_RejectsTruncatedData,
+    "Project.Save.ComponentSaveState.RejectsTruncatedData",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_RejectsTruncatedData::RunTest(const FString& Parameters)
+{
+    UStorageComponent* Source = NewObject<UStorageComponent>();
+    TArray<uint8> Data;
+    ComponentSaveState::WriteComponent(Source, Data);
+
+    // Keep the version but cut off the property stream
+    Data.SetNum(sizeof(int32) + 1);
+
+    UStorageComponent* Target = NewObject<UStorageComponent>();
+    AddExpectedError(TEXT("Corrupt saved state"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestFalse(TEXT("Truncated data is rejected"), ComponentSaveState::ReadComponent(Target, Data));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_CleanActorRecapture,
+    "Project.Save.ComponentSaveState.CleanActorRecapture",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_CleanActorRecapture::RunTest(const FString& Parameters)
+{
+    AActor* Actor = NewObject<AActor>();
+    UHungerComponent* Hunger = NewObject<UHungerComponent>(Actor, TEXT("Hunger"));
+
+    FActorStateSaveData Captured;
+    Captured.ActorId = FGuid::NewGuid();
+    SaveSystemHelpers::CaptureActorComponents(Actor, Captured);
+    TestEqual(TEXT("Hunger is captured"), Captured.ComponentStates.Num(), 1);
+
+    // A clean actor's record is reused as-is unless its component state moved on
+    FActorStateSaveData Reused = Captured;
+    TestFalse(TEXT("Unchanged state keeps the record"), SaveSystemHelpers::RecaptureActorComponents(Actor, Reused));
+    TestTrue(TEXT("Record is untouched"), Reused.ComponentStates[0].Data == Captured.ComponentStates[0].Data);
+
+    // Hunger changes don't mark the actor dirty, so the next save has to notice them itself
+    Hunger->RestoreHunger(15.f);
+    const float SavedHunger = Hunger->GetCurrentHunger();
+    TestTrue(TEXT("Changed state is recaptured"), SaveSystemHelpers::RecaptureActorComponents(Actor, Reused));
+
+    AActor* Loaded = NewObject<AActor>();
+    UHungerComponent* LoadedHunger = NewObject<UHungerComponent>(Loaded, TEXT("Hunger"));
+    TestTrue(TEXT("Restores"), SaveSystemHelpers::RestoreActorComponents(Loaded, Reused));
+    TestEqual(TEXT("Saved hunger carries the change"), LoadedHunger->GetCurrentHunger(), SavedHunger);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_InventoryRoundTrip,
+    "Project.Save.ComponentSaveState.InventoryRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_InventoryRoundTrip::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = NewObject<UItemDefinition>(GetTransientPackage());
+    UInventoryComponent* Source = NewObject<UInventoryComponent>();
+    const FItemEntry A = MakeEntry_ComponentSaveState(Def);
+    const FItemEntry B = MakeEntry_ComponentSaveState(Def);
+    Source->TryAdd(A);
+    Source->TryAdd(B);
+
+    TArray<uint8> Data;
+    ComponentSaveState::WriteComponent(Source, Data);
+
+    // The stale entry goes away through RemoveById before the saved ones are added
+    UInventoryComponent* Target = NewObject<UInventoryComponent>();
+    Target->TryAdd(MakeEntry_ComponentSaveState(Def));
+    TestTrue(TEXT("Reads"), ComponentSaveState::ReadComponent(Target, Data));
+
+    if (!TestEqual(TEXT("Entry count"), Target->GetEntries().Num(), 2))
+    {
+        return false;
+    }
+    TestEqual(TEXT("First ItemId"), Target->GetEntries()[0].ItemId, A.ItemId);
+    TestEqual(TEXT("Second ItemId"), Target->GetEntries()[1].ItemId, B.ItemId);
+    TestTrue(TEXT("Def"), Target->GetEntries()[0].Def == Def);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_EquipmentRoundTrip,
+    "Project.Save.ComponentSaveState.EquipmentRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_EquipmentRoundTrip::RunTest(const FString& Parameters)
+{
+    UItemDefinition* BackpackDef = NewObject<UItemDefinition>(GetTransientPackage());
+    BackpackDef->bEquippable = true;
+    UEquipEffect_Backpack* Effect = NewObject<UEquipEffect_Backpack>(BackpackDef);
+    Effect->VolumeBonus = 20.f;
+    BackpackDef->EquipEffects.Add(Effect);
+
+    UInventoryComponent* SourceInventory = NewObject<UInventoryComponent>();
+    UEquipmentComponent* Source = NewObject<UEquipmentComponent>();
+    Source->Inventory = SourceInventory;
+    const FItemEntry Backpack = MakeEntry_ComponentSaveState(BackpackDef);
+    SourceInventory->TryAdd(Backpack);
+    FText Error;
+    TestTrue(TEXT("Equips"), Source->EquipFromInventory(Backpack.ItemId, Error));
+
+    TArray<uint8> Data;
+    ComponentSaveState::WriteComponent(Source, Data);
+    int32 WrittenVersion = INDEX_NONE;
+    FMemoryReader VersionReader(Data);
+    VersionReader << WrittenVersion;
+    TestEqual(TEXT("Equipped map is written at version 1"), WrittenVersion, 1);
+
+    UInventoryComponent* TargetInventory = NewObject<UInventoryComponent>();
+    UEquipmentComponent* Target = NewObject<UEquipmentComponent>();
+    Target->Inventory = TargetInventory;
+    const float BaseVolume = TargetInventory->MaxVolume;
+    TestTrue(TEXT("Reads"), ComponentSaveState::ReadComponent(Target, Data));
+
+    FItemEntry Equipped;
+    TestTrue(TEXT("Back slot is restored"), Target->GetEquipped(EEquipmentSlot::Back, Equipped));
+    TestEqual(TEXT("Equipped ItemId"), Equipped.ItemId, Backpack.ItemId);
+    TestEqual(TEXT("Equip effect is applied"), TargetInventory->MaxVolume, BaseVolume + 20.f);
+    TestEqual(TEXT("Restored item is not put in the inventory"), TargetInventory->GetEntries().Num(), 0);
+
+    // Restoring over equipped items removes their effects first rather than stacking them
+    TestTrue(TEXT("Reads again"), ComponentSaveState::ReadComponent(Target, Data));
+    TestEqual(TEXT("Effect is applied once"), TargetInventory->MaxVolume, BaseVolume + 20.f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_HotbarReselectsAfterRestore,
+    "Project.Save.ComponentSaveState.HotbarReselectsAfterRestore",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_HotbarReselectsAfterRestore::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Apple = NewObject<UItemDefinition>(GetTransientPackage());
+    UInventoryComponent* SourceInventory = nullptr;
+    UHotbarComponent* SourceHotbar = nullptr;
+    MakeCarrier_ComponentSaveState(SourceInventory, SourceHotbar);
+    const FItemEntry SavedApple = MakeEntry_ComponentSaveState(Apple);
+    SourceInventory->TryAdd(SavedApple);
+    SourceHotbar->AssignSlot(2, Apple);
+    TestTrue(TEXT("Selects"), SourceHotbar->SelectSlot(2, SourceInventory));
+
+    TArray<uint8> Data;
+    ComponentSaveState::WriteComponent(SourceHotbar, Data);
+
+    // The saved held unit isn't in this inventory; the restore holds the apple that is
+    UInventoryComponent* TargetInventory = nullptr;
+    UHotbarComponent* TargetHotbar = nullptr;
+    MakeCarrier_ComponentSaveState(TargetInventory, TargetHotbar);
+    const FItemEntry OtherApple = MakeEntry_ComponentSaveState(Apple);
+    TargetInventory->TryAdd(OtherApple);
+    TestTrue(TEXT("Reads"), ComponentSaveState::ReadComponent(TargetHotbar, Data));
+
+    TestTrue(TEXT("Slot assignment"), TargetHotbar->GetSlot(2).AssignedType == Apple);
+    TestEqual(TEXT("Active index"), TargetHotbar->GetActiveIndex(), 2);
+    TestEqual(TEXT("Held unit is re-picked from the inventory"), TargetHotbar->GetActiveItemId(), OtherApple.ItemId);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_PostHooksRunAfterEveryRead,
+    "Project.Save.ComponentSaveState.PostHooksRunAfterEveryRead",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_PostHooksRunAfterEveryRead::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Apple = NewObject<UItemDefinition>(GetTransientPackage());
+    UInventoryComponent* SourceInventory = nullptr;
+    UHotbarComponent* SourceHotbar = nullptr;
+    AActor* Source = MakeCarrier_ComponentSaveState(SourceInventory, SourceHotbar);
+    const FItemEntry SavedApple = MakeEntry_ComponentSaveState(Apple);
+    SourceInventory->TryAdd(SavedApple);
+    SourceHotbar->AssignSlot(0, Apple);
+    SourceHotbar->SelectSlot(0, SourceInventory);
+
+    TArray<FComponentSaveRecord> Records;
+    ComponentSaveState::CaptureActor(Source, Records);
+    TestEqual(TEXT("Inventory and hotbar are captured"), Records.Num(), 2);
+
+    // Hotbar first: if its Post hook ran before the inventory's Pre hook and read, it would hold the stale apple
+    Records.Sort([](const FComponentSaveRecord& A, const FComponentSaveRecord& B) { return A.ComponentName == TEXT("Hotbar") && B.ComponentName != TEXT("Hotbar"); });
+
+    UInventoryComponent* TargetInventory = nullptr;
+    UHotbarComponent* TargetHotbar = nullptr;
+    AActor* Target = MakeCarrier_ComponentSaveState(TargetInventory, TargetHotbar);
+    TargetInventory->TryAdd(MakeEntry_ComponentSaveState(Apple));
+    TestEqual(TEXT("Both components restore"), ComponentSaveState::RestoreActor(Target, Records), 2);
+
+    TestEqual(TEXT("Inventory holds only the saved apple"), TargetInventory->GetEntries().Num(), 1);
+    TestEqual(TEXT("Hotbar holds the restored apple"), TargetHotbar->GetActiveItemId(), SavedApple.ItemId);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_RestoreMatchesByName,
+    "Project.Save.ComponentSaveState.RestoreMatchesByName",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_RestoreMatchesByName::RunTest(const FString& Parameters)
+{
+    AActor* Source = NewObject<AActor>();
+    NewObject<UStorageComponent>(Source, TEXT("Drawer"))->MaxVolume = 10.f;
+    NewObject<UStorageComponent>(Source, TEXT("Chest"))->MaxVolume = 40.f;
+
+    TArray<FComponentSaveRecord> Records;
+    ComponentSaveState::CaptureActor(Source, Records);
+    FComponentSaveRecord Unknown = Records[0];
+    Unknown.ComponentName = TEXT("Removed");
+    Records.Add(Unknown);
+
+    // Same classes created in the other order, plus a component the save doesn't know
+    AActor* Target = NewObject<AActor>();
+    UStorageComponent* Chest = NewObject<UStorageComponent>(Target, TEXT("Chest"));
+    UStorageComponent* Drawer = NewObject<UStorageComponent>(Target, TEXT("Drawer"));
+    UStorageComponent* Crate = NewObject<UStorageComponent>(Target, TEXT("Crate"));
+    Crate->MaxVolume = 5.f;
+
+    TestEqual(TEXT("Only named matches restore"), ComponentSaveState::RestoreActor(Target, Records), 2);
+    TestEqual(TEXT("Chest"), Chest->MaxVolume, 40.f);
+    TestEqual(TEXT("Drawer"), Drawer->MaxVolume, 10.f);
+    TestEqual(TEXT("Unsaved component is left alone"), Crate->MaxVolume, 5.f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FComponentSaveState_LegacyPlayerSections,
+    "Project.Save.ComponentSaveState.LegacyPlayerSections",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FComponentSaveState_LegacyPlayerSections::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = NewObject<UItemDefinition>(GetTransientPackage());
+    const FItemEntry Saved = MakeEntry_ComponentSaveState(Def);
+
+    // A save from before ComponentStates: hunger and inventory in their own sections
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->PlayerData.CurrentHunger = 42.f;
+    SaveData->InventoryData.SerializedEntries = StorageSerialization::SerializeStorageEntries({ Saved });
+    TestTrue(TEXT("Counts as player state"), SaveSystemHelpers::HasPlayerComponentState(SaveData));
+
+    UInventoryComponent* Inventory = nullptr;
+    UHotbarComponent* Hotbar = nullptr;
+    AActor* Player = MakeCarrier_ComponentSaveState(Inventory, Hotbar);
+    UHungerComponent* Hunger = NewObject<UHungerComponent>(Player, TEXT("Hunger"));
+    Inventory->TryAdd(MakeEntry_ComponentSaveState(Def));
+
+    SaveSystemHelpers::RestorePlayerComponents(Player, SaveData);
+    TestEqual(TEXT("Hunger from the player section"), Hunger->GetCurrentHunger(), 42.f);
+    if (!TestEqual(TEXT("Inventory from its section"), Inventory->GetEntries().Num(), 1))
+    {
+        return false;
+    }
+    TestEqual(TEXT("ItemId"), Inventory->GetEntries()[0].ItemId, Saved.ItemId);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,45 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "AssetRegistry/AssetData.h"
+#include "Dimensions/DimensionScanningSubsystem.h"
+#include "Dimensions/DimensionDefinition.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionCatalogue_EntryFromRegistryTags,
+    "Project.Dimensions.Catalogue.EntryFromRegistryTags",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionCatalogue_EntryFromRegistryTags::RunTest(const FString& Parameters)
+{
+    UDimensionDefinition* Definition = NewObject<UDimensionDefinition>();
+    Definition->Type = EDimensionType::Rare;
+    Definition->RarityWeight = 0.25f;
+
+    // Tags are gathered from the object the same way they are when the asset is saved
+    const FAssetData AssetData(Definition);
+
+    FDimensionCatalogueEntry Entry;
+    TestTrue(TEXT("Entry is read from the tags"), UDimensionScanningSubsystem::MakeCatalogueEntry(AssetData, Entry));
+    TestEqual(TEXT("Guid"), Entry.Guid, Definition->Guid);
+    TestEqual(TEXT("Type"), Entry.Type, EDimensionType::Rare);
+    TestEqual(TEXT("Rarity weight"), Entry.RarityWeight, 0.25f);
+    TestTrue(TEXT("No required tags"), Entry.RequiredTags.IsEmpty());
+    TestEqual(TEXT("Entry points at the definition"), Entry.Definition.ToSoftObjectPath(), FSoftObjectPath(Definition));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionCatalogue_UntaggedAssetIsRejected,
+    "Project.Dimensions.Catalogue.UntaggedAssetIsRejected",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionCatalogue_UntaggedAssetIsRejected::RunTest(const FString& Parameters)
+{
+    // An asset saved before the tags existed has none
+    const FAssetData AssetData(FName(TEXT("/Game/Dimensions/DA_Old")), FName(TEXT("/Game/Dimensions")), FName(TEXT("DA_Old")),
+        UDimensionDefinition::StaticClass()->GetClassPathName());
+
+    FDimensionCatalogueEntry Entry;
+    TestFalse(TEXT("Entry needs the tags"), UDimensionScanningSubsystem::MakeCatalogueEntry(AssetData, Entry));
+    return true;
+}
+
+#endif
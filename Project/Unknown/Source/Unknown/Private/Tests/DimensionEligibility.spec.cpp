@@ -0,0 +1,122 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "GameplayTagContainer.h"
+#include "Dimensions/DimensionScanningSubsystem.h"
+#include "Player/FirstPersonCharacter.h"
+
+static FDimensionCatalogueEntry MakeEntry_DimensionEligibility(const TArray<FGameplayTag>& RequiredTags)
+{
+    FDimensionCatalogueEntry Entry;
+    Entry.Guid = FGuid::NewGuid();
+    Entry.RequiredTags = FGameplayTagContainer::CreateFromArray(RequiredTags);
+    return Entry;
+}
+
+// PlayerTags is normally recomputed from the inventory and equipment once the character has begun play
+static void SetPlayerTags_DimensionEligibility(AFirstPersonCharacter* Char, const FGameplayTagContainer& Tags)
+{
+    FStructProperty* Property = FindFProperty<FStructProperty>(AFirstPersonCharacter::StaticClass(), TEXT("PlayerTags"));
+    *Property->ContainerPtrToValuePtr<FGameplayTagContainer>(Char) = Tags;
+}
+
+static TSet<FGuid> GetEligibleGuids_DimensionEligibility(UDimensionScanningSubsystem* Scanning, APawn* Player)
+{
+    TSet<FGuid> Guids;
+    for (const FDimensionCatalogueEntry& Entry : Scanning->GetEligibleDimensionsFor(Player))
+    {
+        Guids.Add(Entry.Guid);
+    }
+    return Guids;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionEligibility_MatchesTagCheck,
+    "Project.Dimensions.Eligibility.MatchesTagCheck",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionEligibility_MatchesTagCheck::RunTest(const FString& Parameters)
+{
+    const FGameplayTag Cartridge = FGameplayTag::RequestGameplayTag(FName(TEXT("Item.Type.Cartridge")), false);
+    const FGameplayTag ItemType = Cartridge.RequestDirectParent();
+    const FGameplayTag Item = ItemType.RequestDirectParent();
+    TestTrue(TEXT("Config tags are registered"), Cartridge.IsValid() && ItemType.IsValid() && Item.IsValid());
+    if (!Item.IsValid()) return false;
+
+    TArray<FDimensionCatalogueEntry> Entries;
+    Entries.Add(MakeEntry_DimensionEligibility({}));
+    Entries.Add(MakeEntry_DimensionEligibility({ Item }));
+    Entries.Add(MakeEntry_DimensionEligibility({ ItemType }));
+    Entries.Add(MakeEntry_DimensionEligibility({ Cartridge }));
+    Entries.Add(MakeEntry_DimensionEligibility({ Item, Cartridge }));
+
+    UDimensionScanningSubsystem* Scanning = NewObject<UDimensionScanningSubsystem>();
+    Scanning->SetCatalogue(Entries);
+
+    // Players holding a parent tag, its child, or nothing; a child satisfies a required parent
+    TArray<FGameplayTagContainer> PlayerTagSets;
+    PlayerTagSets.AddDefaulted();
+    PlayerTagSets.Add(FGameplayTagContainer(ItemType));
+    PlayerTagSets.Add(FGameplayTagContainer(Cartridge));
+
+    for (const FGameplayTagContainer& PlayerTags : PlayerTagSets)
+    {
+        AFirstPersonCharacter* Char = NewObject<AFirstPersonCharacter>();
+        SetPlayerTags_DimensionEligibility(Char, PlayerTags);
+
+        TSet<FGuid> Expected;
+        for (const FDimensionCatalogueEntry& Entry : Entries)
+        {
+            if (Char->GetPlayerTags().HasAll(Entry.RequiredTags))
+            {
+                Expected.Add(Entry.Guid);
+            }
+        }
+
+        const TSet<FGuid> Eligible = GetEligibleGuids_DimensionEligibility(Scanning, Char);
+        TestEqual(FString::Printf(TEXT("Eligible count with [%s]"), *PlayerTags.ToStringSimple()), Eligible.Num(), Expected.Num());
+        TestTrue(FString::Printf(TEXT("Eligible set with [%s] matches HasAll"), *PlayerTags.ToStringSimple()),
+            Eligible.Num() == Expected.Num() && Eligible.Includes(Expected));
+    }
+
+    TestEqual(TEXT("No player only gets unrestricted dimensions"), GetEligibleGuids_DimensionEligibility(Scanning, nullptr).Num(), 1);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionEligibility_TagChangeRebuildsSelection,
+    "Project.Dimensions.Eligibility.TagChangeRebuildsSelection",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionEligibility_TagChangeRebuildsSelection::RunTest(const FString& Parameters)
+{
+    const FGameplayTag Cartridge = FGameplayTag::RequestGameplayTag(FName(TEXT("Item.Type.Cartridge")), false);
+    TestTrue(TEXT("Config tag is registered"), Cartridge.IsValid());
+    if (!Cartridge.IsValid()) return false;
+
+    const FDimensionCatalogueEntry Open = MakeEntry_DimensionEligibility({});
+    const FDimensionCatalogueEntry Gated = MakeEntry_DimensionEligibility({ Cartridge });
+
+    UDimensionScanningSubsystem* Scanning = NewObject<UDimensionScanningSubsystem>();
+    Scanning->SetCatalogue({ Open, Gated });
+
+    AFirstPersonCharacter* Char = NewObject<AFirstPersonCharacter>();
+    TSet<FGuid> Eligible = GetEligibleGuids_DimensionEligibility(Scanning, Char);
+    TestTrue(TEXT("Open dimension is eligible"), Eligible.Contains(Open.Guid));
+    TestFalse(TEXT("Gated dimension starts ineligible"), Eligible.Contains(Gated.Guid));
+
+    // The selection is cached until the player says its tags changed
+    SetPlayerTags_DimensionEligibility(Char, FGameplayTagContainer(Cartridge));
+    TestFalse(TEXT("Selection is kept without a change notification"),
+        GetEligibleGuids_DimensionEligibility(Scanning, Char).Contains(Gated.Guid));
+
+    Char->OnPlayerTagsChanged.Broadcast();
+    Eligible = GetEligibleGuids_DimensionEligibility(Scanning, Char);
+    TestTrue(TEXT("Gated dimension is eligible after the tags change"), Eligible.Contains(Gated.Guid));
+    TestTrue(TEXT("Open dimension stays eligible"), Eligible.Contains(Open.Guid));
+
+    SetPlayerTags_DimensionEligibility(Char, FGameplayTagContainer());
+    Char->OnPlayerTagsChanged.Broadcast();
+    TestFalse(TEXT("Gated dimension is dropped when the tag is lost"),
+        GetEligibleGuids_DimensionEligibility(Scanning, Char).Contains(Gated.Guid));
+    return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Dimensions/DimensionManagerSubsystem.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionInstanceBudget_EvictsLeastRecentlyUsed,
+    "Project.Dimensions.InstanceBudget.EvictsLeastRecentlyUsed",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionInstanceBudget_EvictsLeastRecentlyUsed::RunTest(const FString& Parameters)
+{
+    // Least to most recently active; the active one never counts against the budget
+    const FGuid Oldest = FGuid::NewGuid();
+    const FGuid Older = FGuid::NewGuid();
+    const FGuid Active = FGuid::NewGuid();
+    const FGuid Recent = FGuid::NewGuid();
+    const TArray<FGuid> RecentInstances = { Oldest, Older, Active, Recent };
+
+    TestEqual(TEXT("Within budget"), UDimensionManagerSubsystem::SelectEvictions(RecentInstances, Active, 3, false).Num(), 0);
+
+    const TArray<FGuid> OverCount = UDimensionManagerSubsystem::SelectEvictions(RecentInstances, Active, 1, false);
+    if (TestEqual(TEXT("Two over the count budget"), OverCount.Num(), 2))
+    {
+        TestEqual(TEXT("Oldest goes first"), OverCount[0], Oldest);
+        TestEqual(TEXT("Then the next oldest"), OverCount[1], Older);
+    }
+
+    const TArray<FGuid> NoneKept = UDimensionManagerSubsystem::SelectEvictions(RecentInstances, Active, 0, false);
+    TestEqual(TEXT("Every hidden instance goes at a zero budget"), NoneKept.Num(), 3);
+    TestFalse(TEXT("The active instance is never evicted"), NoneKept.Contains(Active));
+
+    // Memory releases one extra instance per check, and never the active one
+    const TArray<FGuid> OverMemory = UDimensionManagerSubsystem::SelectEvictions(RecentInstances, Active, 3, true);
+    if (TestEqual(TEXT("One for memory"), OverMemory.Num(), 1))
+    {
+        TestEqual(TEXT("Least recent for memory"), OverMemory[0], Oldest);
+    }
+    TestEqual(TEXT("Both budgets"), UDimensionManagerSubsystem::SelectEvictions(RecentInstances, Active, 1, true).Num(), 3);
+    TestEqual(TEXT("Nothing hidden to release for memory"), UDimensionManagerSubsystem::SelectEvictions({ Active }, Active, 2, true).Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDimensionInstanceBudget_WorldPositionReuse,
+    "Project.Dimensions.InstanceBudget.WorldPositionReuse",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FDimensionInstanceBudget_WorldPositionReuse::RunTest(const FString& Parameters)
+{
+    const FVector Base(0.0, 0.0, -100000.0);
+    const FVector Spacing(0.0, 100000.0, 0.0);
+    const FVector Saved(0.0, 500000.0, -100000.0);
+
+    TestEqual(TEXT("First instance takes the base"),
+        UDimensionManagerSubsystem::FindFreeWorldPosition({}, FVector::ZeroVector, Base, Spacing), Base);
+    TestEqual(TEXT("Saved position is reused when free"),
+        UDimensionManagerSubsystem::FindFreeWorldPosition({ Base }, Saved, Base, Spacing), Saved);
+    TestEqual(TEXT("Taken slots are skipped"),
+        UDimensionManagerSubsystem::FindFreeWorldPosition({ Base, Base + Spacing }, FVector::ZeroVector, Base, Spacing), Base + Spacing * 2);
+    TestEqual(TEXT("A freed slot is reused"),
+        UDimensionManagerSubsystem::FindFreeWorldPosition({ Base + Spacing }, FVector::ZeroVector, Base, Spacing), Base);
+    TestEqual(TEXT("Taken saved position falls back to a free slot"),
+        UDimensionManagerSubsystem::FindFreeWorldPosition({ Saved, Base }, Saved, Base, Spacing), Base + Spacing);
+    return true;
+}
+
+#endif
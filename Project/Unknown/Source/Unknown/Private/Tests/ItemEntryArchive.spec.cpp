@@ -0,0 +1,151 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/ItemEntryArchive.h"
+#include "Save/SaveSystemHelpers.h"
+#include "Inventory/StorageSerialization.h"
+#include "Inventory/ItemDefinition.h"
+
+static UItemDefinition* MakeItemDef_Archive()
+{
+    return NewObject<UItemDefinition>(GetTransientPackage());
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemEntryArchive_RoundTrip_PreservesEntries,
+    "Project.Save.ItemEntryArchive.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FItemEntryArchive_RoundTrip_PreservesEntries::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = MakeItemDef_Archive();
+
+    FItemEntry A; A.Def = Def; A.ItemId = FGuid::NewGuid();
+    A.SetCustomDataValue(TEXT("Name"), TEXT("Rusty|Key=1"));
+    A.SetCustomDataValue(TEXT("Uses"), TEXT("42"));
+    A.SetCustomDataValue(TEXT("Charge"), TEXT("0.5"));
+    A.SetCustomDataValue(TEXT("Padded"), TEXT("007"));
+    A.SetCustomDataValue(TEXT("Lit"), TEXT("true"));
+    FItemEntry B; B.Def = Def; B.ItemId = FGuid::NewGuid();
+
+    const FString Encoded = ItemEntryArchive::EncodeEntries({ A, B });
+    TestTrue(TEXT("Encoded string is an archive"), ItemEntryArchive::IsArchiveString(Encoded));
+
+    TArray<FItemEntry> Decoded;
+    TestTrue(TEXT("Decode succeeds"), ItemEntryArchive::DecodeEntries(Encoded, Decoded));
+    TestEqual(TEXT("Two entries"), Decoded.Num(), 2);
+    if (Decoded.Num() != 2)
+    {
+        return false;
+    }
+
+    TestTrue(TEXT("Def resolved"), Decoded[0].Def == Def);
+    TestEqual(TEXT("ItemId preserved"), Decoded[0].ItemId, A.ItemId);
+    TestEqual(TEXT("Second ItemId preserved"), Decoded[1].ItemId, B.ItemId);
+    TestTrue(TEXT("CustomData preserved exactly"), Decoded[0].CustomData.OrderIndependentCompareEqual(A.CustomData));
+    TestEqual(TEXT("Second entry has no CustomData"), Decoded[1].CustomData.Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemEntryArchive_NestedStorage_RoundTrip,
+    "Project.Save.ItemEntryArchive.NestedStorage",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FItemEntryArchive_NestedStorage_RoundTrip::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = MakeItemDef_Archive();
+
+    FItemEntry Inner; Inner.Def = Def; Inner.ItemId = FGuid::NewGuid();
+    FItemEntry Backpack; Backpack.Def = Def; Backpack.ItemId = FGuid::NewGuid();
+    Backpack.SetCustomDataValue(TEXT("StorageData"), StorageSerialization::SerializeStorageEntries({ Inner }));
+
+    const FString Serialized = SaveSystemHelpers::SerializeItemEntry(Backpack);
+    FItemEntry Restored;
+    TestTrue(TEXT("Deserialize backpack"), SaveSystemHelpers::DeserializeItemEntry(Serialized, Restored));
+
+    const TArray<FItemEntry> RestoredInner = StorageSerialization::DeserializeStorageEntries(Restored.GetCustomDataValue(TEXT("StorageData")));
+    TestEqual(TEXT("Nested entry count"), RestoredInner.Num(), 1);
+    if (RestoredInner.Num() == 1)
+    {
+        TestEqual(TEXT("Nested ItemId preserved"), RestoredInner[0].ItemId, Inner.ItemId);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemEntryArchive_LegacyStrings_Migrate,
+    "Project.Save.ItemEntryArchive.LegacyMigration",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FItemEntryArchive_LegacyStrings_Migrate::RunTest(const FString& Parameters)
+{
+    UItemDefinition* Def = MakeItemDef_Archive();
+    const FGuid ItemId = FGuid::NewGuid();
+    const FString DefPath = Def->GetPathName();
+    const FString IdString = ItemId.ToString(EGuidFormats::DigitsWithHyphensInBraces);
+
+    // Legacy storage string: "Count|DefPath|ItemId|CDCount|K=V"
+    const FString LegacyStorage = FString::Printf(TEXT("1|%s|%s|1|Uses=3"), *DefPath, *IdString);
+    const TArray<FItemEntry> Entries = StorageSerialization::DeserializeStorageEntries(LegacyStorage);
+    TestEqual(TEXT("Legacy storage parsed"), Entries.Num(), 1);
+
+    // Legacy equipment string: "SlotIdx|DefPath|ItemId|K=V"
+    EEquipmentSlot Slot;
+    FItemEntry Equipped;
+    const FString LegacyEquipment = FString::Printf(TEXT("1|%s|%s|Uses=3"), *DefPath, *IdString);
+    TestTrue(TEXT("Legacy equipment parsed"), SaveSystemHelpers::DeserializeEquipmentSlot(LegacyEquipment, Slot, Equipped));
+    TestEqual(TEXT("Legacy equipment ItemId"), Equipped.ItemId, ItemId);
+
+    // Re-serializing always produces the archive format
+    TestTrue(TEXT("Storage re-saved as archive"), ItemEntryArchive::IsArchiveString(StorageSerialization::SerializeStorageEntries(Entries)));
+    const FString Resaved = SaveSystemHelpers::SerializeEquipmentSlot(Slot, Equipped);
+    FItemEntry RoundTrip;
+    TestTrue(TEXT("Re-saved equipment parses"), SaveSystemHelpers::DeserializeEquipmentSlot(Resaved, Slot, RoundTrip));
+    TestEqual(TEXT("Re-saved CustomData"), RoundTrip.GetCustomDataValue(TEXT("Uses")), FString(TEXT("3")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemEntryArchive_Corrupt_Rejected,
+    "Project.Save.ItemEntryArchive.CorruptRejected",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FItemEntryArchive_Corrupt_Rejected::RunTest(const FString& Parameters)
+{
+    FItemEntry A; A.Def = MakeItemDef_Archive(); A.ItemId = FGuid::NewGuid();
+    TArray<uint8> Bytes;
+    ItemEntryArchive::WriteEntries({ A }, Bytes);
+    Bytes.SetNum(Bytes.Num() - 4);
+
+    TArray<FItemEntry> Out;
+    TestFalse(TEXT("Truncated archive rejected"), ItemEntryArchive::ReadEntries(Bytes, Out));
+    TestEqual(TEXT("No partial entries"), Out.Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemEntryArchive_CollectDefinitionPaths,
+    "Project.Save.ItemEntryArchive.CollectDefinitionPaths",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FItemEntryArchive_CollectDefinitionPaths::RunTest(const FString& Parameters)
+{
+    UItemDefinition* OuterDef = MakeItemDef_Archive();
+    UItemDefinition* InnerDef = MakeItemDef_Archive();
+
+    FItemEntry Inner; Inner.Def = InnerDef; Inner.ItemId = FGuid::NewGuid();
+    FItemEntry Backpack; Backpack.Def = OuterDef; Backpack.ItemId = FGuid::NewGuid();
+    Backpack.SetCustomDataValue(TEXT("StorageData"), StorageSerialization::SerializeStorageEntries({ Inner }));
+    FItemEntry Duplicate; Duplicate.Def = OuterDef; Duplicate.ItemId = FGuid::NewGuid();
+
+    TArray<FString> Paths;
+    ItemEntryArchive::CollectDefinitionPaths(StorageSerialization::SerializeStorageEntries({ Backpack, Duplicate }), Paths);
+    TestEqual(TEXT("Outer and nested definitions, no duplicates"), Paths.Num(), 2);
+    TestTrue(TEXT("Outer definition collected"), Paths.Contains(OuterDef->GetPathName()));
+    TestTrue(TEXT("Nested definition collected"), Paths.Contains(InnerDef->GetPathName()));
+
+    // Legacy storage string: "Count|DefPath|ItemId|CDCount|K=V"
+    TArray<FString> LegacyPaths;
+    const FString LegacyStorage = FString::Printf(TEXT("1|%s|%s|1|Uses=3"),
+        *OuterDef->GetPathName(), *FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensInBraces));
+    ItemEntryArchive::CollectDefinitionPaths(LegacyStorage, LegacyPaths);
+    TestEqual(TEXT("Legacy string yields its definition path only"), LegacyPaths.Num(), 1);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,336 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/SaveGameFile.h"
+#include "Save/GameSaveData.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_DimensionSidecarRoundTrip,
+    "Project.Save.SaveGameFile.DimensionSidecarRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_DimensionSidecarRoundTrip::RunTest(const FString& Parameters)
+{
+    const FString SlotName = TEXT("AutomationTest_DimensionSidecar");
+
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    FDimensionInstanceSaveData& Dimension = SaveData->DimensionInstances.AddDefaulted_GetRef();
+    Dimension.InstanceId = FGuid::NewGuid();
+    Dimension.CartridgeId = FGuid::NewGuid();
+    FActorStateSaveData& State = Dimension.ActorStates.AddDefaulted_GetRef();
+    State.ActorId = FGuid::NewGuid();
+    Dimension.BaselineActorIds.Add(State.ActorId);
+
+    TestTrue(TEXT("Save writes"), SaveGameFile::SaveToSlot(SaveData, SlotName));
+    TestEqual(TEXT("Caller's data keeps its actor states"), SaveData->DimensionInstances[0].ActorStates.Num(), 1);
+    TestTrue(TEXT("Sidecar exists"), IFileManager::Get().FileExists(*SaveGameFile::GetDimensionSidecarPath(SlotName, Dimension.InstanceId)));
+
+    UGameSaveData* Loaded = SaveGameFile::LoadFromSlot(SlotName);
+    if (TestNotNull(TEXT("Save loads"), Loaded) && TestEqual(TEXT("Dimension index loads"), Loaded->DimensionInstances.Num(), 1))
+    {
+        FDimensionInstanceSaveData& LoadedDimension = Loaded->DimensionInstances[0];
+        TestEqual(TEXT("Index keeps the cartridge"), LoadedDimension.CartridgeId, Dimension.CartridgeId);
+        TestFalse(TEXT("Actor states are not read with the main save"), LoadedDimension.bActorStatesResident);
+        TestEqual(TEXT("Main save carries no actor states"), LoadedDimension.ActorStates.Num(), 0);
+
+        TestTrue(TEXT("Sidecar reads on demand"), SaveGameFile::EnsureDimensionResident(Loaded, LoadedDimension));
+        TestEqual(TEXT("Actor states come back"), LoadedDimension.ActorStates.Num(), 1);
+        TestEqual(TEXT("Baseline comes back"), LoadedDimension.BaselineActorIds.Num(), 1);
+        if (LoadedDimension.ActorStates.Num() == 1)
+        {
+            TestEqual(TEXT("Actor ID survives"), LoadedDimension.ActorStates[0].ActorId, State.ActorId);
+        }
+    }
+
+    IFileManager::Get().Delete(*SaveGameFile::GetSlotFilePath(SlotName), false, false, true);
+    SaveGameFile::DeleteDimensionSidecars(SlotName);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_UnchangedSidecarsAreKept,
+    "Project.Save.SaveGameFile.UnchangedSidecarsAreKept",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_UnchangedSidecarsAreKept::RunTest(const FString& Parameters)
+{
+    const FString SlotName = TEXT("AutomationTest_UnchangedSidecars");
+    const FGuid StillId = FGuid::NewGuid();
+    const FGuid ChangedId = FGuid::NewGuid();
+    const FGuid ActorId = FGuid::NewGuid();
+
+    // Writing strips the records, so every save starts from a fresh snapshot like WriteSaveAsync's
+    auto MakeSnapshot = [&](const FVector& ChangedLocation)
+    {
+        UGameSaveData* SaveData = NewObject<UGameSaveData>();
+        for (const FGuid& InstanceId : { StillId, ChangedId })
+        {
+            FDimensionInstanceSaveData& Dimension = SaveData->DimensionInstances.AddDefaulted_GetRef();
+            Dimension.InstanceId = InstanceId;
+            FActorStateSaveData& State = Dimension.ActorStates.AddDefaulted_GetRef();
+            State.ActorId = ActorId;
+            State.bExists = true;
+            State.Location = InstanceId == ChangedId ? ChangedLocation : FVector::ZeroVector;
+        }
+        return SaveData;
+    };
+
+    FSaveJournalState Journal;
+    Journal.SlotName = SlotName;
+    TestTrue(TEXT("First save writes"), SaveGameFile::WriteDimensionSidecars(MakeSnapshot(FVector::ZeroVector), SlotName, &Journal));
+
+    // Mark both files on disk: a rewrite replaces the marker
+    const TArray<uint8> Marker = { 'k', 'e', 'p', 't' };
+    for (const FGuid& InstanceId : { StillId, ChangedId })
+    {
+        FFileHelper::SaveArrayToFile(Marker, *SaveGameFile::GetDimensionSidecarPath(SlotName, InstanceId));
+    }
+
+    TestTrue(TEXT("Second save writes"), SaveGameFile::WriteDimensionSidecars(MakeSnapshot(FVector(10.0, 0.0, 0.0)), SlotName, &Journal));
+
+    TArray<uint8> StillBytes;
+    FFileHelper::LoadFileToArray(StillBytes, *SaveGameFile::GetDimensionSidecarPath(SlotName, StillId));
+    TestTrue(TEXT("Unchanged dimension's sidecar is not rewritten"), StillBytes == Marker);
+
+    FDimensionInstanceSaveData Changed;
+    TestTrue(TEXT("Changed dimension's sidecar is rewritten"), SaveGameFile::ReadDimensionSidecar(SlotName, ChangedId, Changed));
+    if (TestEqual(TEXT("Changed record"), Changed.ActorStates.Num(), 1))
+    {
+        TestEqual(TEXT("Changed location"), Changed.ActorStates[0].Location, FVector(10.0, 0.0, 0.0));
+    }
+
+    // Without the slot's state nothing is known about the files, so everything is written
+    TestTrue(TEXT("Stateless save writes"), SaveGameFile::WriteDimensionSidecars(MakeSnapshot(FVector(10.0, 0.0, 0.0)), SlotName));
+    FDimensionInstanceSaveData Still;
+    TestTrue(TEXT("Stateless save rewrites every sidecar"), SaveGameFile::ReadDimensionSidecar(SlotName, StillId, Still));
+
+    SaveGameFile::DeleteDimensionSidecars(SlotName);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_SectionRoundTrip,
+    "Project.Save.SaveGameFile.SectionRoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_SectionRoundTrip::RunTest(const FString& Parameters)
+{
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->SaveName = TEXT("Sections");
+    SaveData->PlayerData.Location = FVector(10.0, 20.0, 30.0);
+    SaveData->InventoryData.SerializedEntries = TEXT("Legacy");
+    FComponentSaveRecord& Component = SaveData->PlayerData.ComponentStates.AddDefaulted_GetRef();
+    Component.ComponentName = TEXT("Inventory");
+    Component.Data = { 1, 2, 3 };
+
+    FActorStateSaveData& State = SaveData->ActorStates.AddDefaulted_GetRef();
+    State.ActorId = FGuid::NewGuid();
+    State.ActorClassPath = TEXT("/Game/Test/BP_Crate.BP_Crate_C");
+    State.Scale = FVector::OneVector;
+
+    FDimensionInstanceSaveData& Dimension = SaveData->DimensionInstances.AddDefaulted_GetRef();
+    Dimension.InstanceId = FGuid::NewGuid();
+    Dimension.ActorStates.Add(State);
+
+    TArray<uint8> Bytes;
+    TestTrue(TEXT("Container writes"), SaveGameFile::SerializeSaveData(SaveData, Bytes));
+    TestEqual(TEXT("Caller's component states are put back"), SaveData->PlayerData.ComponentStates.Num(), 1);
+    TestEqual(TEXT("Caller's actor states are put back"), SaveData->ActorStates.Num(), 1);
+    TestEqual(TEXT("Caller's dimensions are put back"), SaveData->DimensionInstances.Num(), 1);
+
+    UGameSaveData* Loaded = SaveGameFile::DeserializeSaveData(Bytes);
+    if (TestNotNull(TEXT("Container reads"), Loaded))
+    {
+        TestEqual(TEXT("Core section"), Loaded->SaveName, FString(TEXT("Sections")));
+        TestTrue(TEXT("Player section"), Loaded->PlayerData.Location.Equals(FVector(10.0, 20.0, 30.0)));
+        TestEqual(TEXT("Inventory section"), Loaded->InventoryData.SerializedEntries, FString(TEXT("Legacy")));
+        if (TestEqual(TEXT("Component states"), Loaded->PlayerData.ComponentStates.Num(), 1))
+        {
+            TestEqual(TEXT("Component data"), Loaded->PlayerData.ComponentStates[0].Data, Component.Data);
+        }
+        if (TestEqual(TEXT("World actor section"), Loaded->ActorStates.Num(), 1))
+        {
+            TestEqual(TEXT("Actor ID survives"), Loaded->ActorStates[0].ActorId, State.ActorId);
+        }
+        if (TestEqual(TEXT("Dimension section"), Loaded->DimensionInstances.Num(), 1))
+        {
+            TestEqual(TEXT("Dimension ID"), Loaded->DimensionInstances[0].InstanceId, Dimension.InstanceId);
+            TestEqual(TEXT("Dimension records"), Loaded->DimensionInstances[0].ActorStates.Num(), 1);
+        }
+    }
+
+    // Damage to the last (dimension) section is caught by its checksum
+    Bytes.Last() ^= 0xFF;
+    AddExpectedError(TEXT("Checksum mismatch in dimension section"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestNull(TEXT("Corrupt container is rejected"), SaveGameFile::DeserializeSaveData(Bytes));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_ReadSelectedSections,
+    "Project.Save.SaveGameFile.ReadSelectedSections",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_ReadSelectedSections::RunTest(const FString& Parameters)
+{
+    const FString SlotName = TEXT("AutomationTest_ReadSections");
+
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->SaveName = TEXT("Partial");
+    SaveData->PlayerData.Location = FVector(10.0, 20.0, 30.0);
+    FActorStateSaveData& State = SaveData->ActorStates.AddDefaulted_GetRef();
+    State.ActorId = FGuid::NewGuid();
+    State.Scale = FVector::OneVector;
+    SaveData->DimensionInstances.AddDefaulted_GetRef().InstanceId = FGuid::NewGuid();
+
+    TArray<uint8> Bytes;
+    TestTrue(TEXT("Container writes"), SaveGameFile::SerializeSaveData(SaveData, Bytes));
+
+    // Damage the last (dimension) section: a read that skips it never sees the damage
+    Bytes.Last() ^= 0xFF;
+    TestTrue(TEXT("Slot writes"), SaveGameFile::WriteSlotFileAtomic(SlotName, Bytes));
+
+    UGameSaveData* Player = SaveGameFile::ReadSections(SlotName, ESaveSectionFlags::Player);
+    if (TestNotNull(TEXT("Player-only read succeeds"), Player))
+    {
+        TestEqual(TEXT("Core is always read"), Player->SaveName, FString(TEXT("Partial")));
+        TestTrue(TEXT("Player section read"), Player->PlayerData.Location.Equals(FVector(10.0, 20.0, 30.0)));
+        TestEqual(TEXT("World actors not read"), Player->ActorStates.Num(), 0);
+        TestEqual(TEXT("Dimensions not read"), Player->DimensionInstances.Num(), 0);
+    }
+
+    AddExpectedError(TEXT("Checksum mismatch in dimension section"), EAutomationExpectedErrorFlags::Contains, 1);
+    TestNull(TEXT("A read that needs the damaged section fails"), SaveGameFile::ReadSections(SlotName, ESaveSectionFlags::Dimensions));
+
+    IFileManager::Get().Delete(*SaveGameFile::GetSlotFilePath(SlotName), false, false, true);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_JournalReplay,
+    "Project.Save.SaveGameFile.JournalReplay",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_JournalReplay::RunTest(const FString& Parameters)
+{
+    const FString SlotName = TEXT("AutomationTest_Journal");
+
+    auto AddState = [](UGameSaveData* SaveData, const FVector& Location)
+    {
+        FActorStateSaveData& State = SaveData->ActorStates.AddDefaulted_GetRef();
+        State.ActorId = FGuid::NewGuid();
+        State.ActorClassPath = TEXT("/Game/Test/BP_Crate.BP_Crate_C");
+        State.Location = Location;
+        State.Scale = FVector::OneVector;
+        State.OriginalSpawnTransform = FTransform(Location);
+        return State.ActorId;
+    };
+
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->SaveName = TEXT("Before");
+    const FGuid MovedId = AddState(SaveData, FVector(0.0, 0.0, 0.0));
+    const FGuid RemovedId = AddState(SaveData, FVector(100.0, 0.0, 0.0));
+    const FGuid StaticId = AddState(SaveData, FVector(200.0, 0.0, 0.0));
+    SaveData->BaselineActorIds = { MovedId, RemovedId, StaticId };
+
+    SaveData->PlayerData.CurrentHunger = 80.0f;
+    SaveData->HotbarData.ActiveIndex = 2;
+    FSaveJournalState Journal;
+    TestTrue(TEXT("Snapshot writes"), SaveGameFile::WriteJournalSnapshot(SaveData, SlotName, Journal));
+    TestTrue(TEXT("Journal is valid for the slot"), Journal.IsValidFor(SlotName));
+
+    // First quicksave: one record moves, one is removed, one is added, the core and player blocks change
+    SaveData->SaveName = TEXT("After");
+    SaveData->PlayerData.CurrentHunger = 60.0f;
+    SaveData->ActorStates[0].Location = FVector(0.0, 50.0, 0.0);
+    SaveData->ActorStates.RemoveAt(1);
+    const FGuid AddedId = AddState(SaveData, FVector(300.0, 0.0, 0.0));
+    TestTrue(TEXT("Entry appends"), SaveGameFile::AppendJournalEntry(SaveData, { MovedId, AddedId }, Journal));
+    TestEqual(TEXT("Entry counted"), Journal.EntryCount, 1);
+
+    // Second quicksave with nothing recaptured still records the core block
+    TestTrue(TEXT("Empty entry appends"), SaveGameFile::AppendJournalEntry(SaveData, {}, Journal));
+    TestEqual(TEXT("Both entries counted"), Journal.EntryCount, 2);
+
+    FSaveFileHeader Header;
+    if (TestTrue(TEXT("Header reads"), SaveGameFile::ReadSlotHeader(SlotName, Header)))
+    {
+        TestEqual(TEXT("Header describes the latest entry"), Header.SaveName, FString(TEXT("After")));
+    }
+
+    auto FindState = [](const UGameSaveData* Data, const FGuid& Id)
+    {
+        return Data->ActorStates.FindByPredicate([&Id](const FActorStateSaveData& State) { return State.ActorId == Id; });
+    };
+
+    UGameSaveData* Loaded = SaveGameFile::LoadFromSlot(SlotName);
+    if (TestNotNull(TEXT("Save loads"), Loaded))
+    {
+        TestEqual(TEXT("Core block comes from the journal"), Loaded->SaveName, FString(TEXT("After")));
+        TestEqual(TEXT("Player block comes from the journal"), Loaded->PlayerData.CurrentHunger, 60.0f);
+        TestEqual(TEXT("Unchanged inventory block kept from the snapshot"), Loaded->HotbarData.ActiveIndex, 2);
+        TestEqual(TEXT("Record count after replay"), Loaded->ActorStates.Num(), 3);
+        TestNull(TEXT("Removed record is gone"), FindState(Loaded, RemovedId));
+        TestNotNull(TEXT("Unchanged record kept"), FindState(Loaded, StaticId));
+        TestNotNull(TEXT("Added record present"), FindState(Loaded, AddedId));
+        if (const FActorStateSaveData* Moved = FindState(Loaded, MovedId))
+        {
+            TestTrue(TEXT("Moved record updated"), Moved->Location.Equals(FVector(0.0, 50.0, 0.0), 0.1));
+        }
+        TestEqual(TEXT("Baseline kept"), Loaded->BaselineActorIds.Num(), 3);
+    }
+
+    // A torn tail (crash mid-append) is dropped; everything before it still replays
+    TArray<uint8> JournalBytes;
+    FFileHelper::LoadFileToArray(JournalBytes, *SaveGameFile::GetSlotJournalPath(SlotName));
+    JournalBytes.Append({ 0xFF, 0xFF, 0x00, 0x00, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00 });
+    FFileHelper::SaveArrayToFile(JournalBytes, *SaveGameFile::GetSlotJournalPath(SlotName));
+    AddExpectedError(TEXT("torn journal entry"), EAutomationExpectedErrorFlags::Contains, 1);
+
+    UGameSaveData* Torn = SaveGameFile::LoadFromSlot(SlotName);
+    if (TestNotNull(TEXT("Save with torn journal loads"), Torn))
+    {
+        TestEqual(TEXT("Complete entries replay"), Torn->SaveName, FString(TEXT("After")));
+        TestNull(TEXT("Removal survives"), FindState(Torn, RemovedId));
+    }
+
+    // A plain snapshot save drops the journal
+    TestTrue(TEXT("Snapshot save writes"), SaveGameFile::SaveToSlot(SaveData, SlotName));
+    TestFalse(TEXT("Journal deleted"), IFileManager::Get().FileExists(*SaveGameFile::GetSlotJournalPath(SlotName)));
+
+    IFileManager::Get().Delete(*SaveGameFile::GetSlotFilePath(SlotName), false, false, true);
+    SaveGameFile::DeleteSlotJournal(SlotName);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveGameFile_AbandonedJournalDropsWrites,
+    "Project.Save.SaveGameFile.AbandonedJournalDropsWrites",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveGameFile_AbandonedJournalDropsWrites::RunTest(const FString& Parameters)
+{
+    const FString SlotName = TEXT("AutomationTest_AbandonedJournal");
+
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->SaveName = TEXT("Journaled");
+    FSaveJournalState Journal;
+    TestTrue(TEXT("Snapshot writes"), SaveGameFile::WriteJournalSnapshot(SaveData, SlotName, Journal));
+
+    // The slot is rewritten elsewhere (e.g. a new game) while the journal state is still held by a writer
+    UGameSaveData* Replacement = NewObject<UGameSaveData>();
+    Replacement->SaveName = TEXT("Replacement");
+    Journal.Abandon();
+    TestTrue(TEXT("Replacement writes"), SaveGameFile::SaveToSlot(Replacement, SlotName));
+
+    TestFalse(TEXT("Abandoned journal is not valid"), Journal.IsValidFor(SlotName));
+    TestFalse(TEXT("Append is dropped"), SaveGameFile::AppendJournalEntry(SaveData, {}, Journal));
+    TestFalse(TEXT("Compaction is dropped"), SaveGameFile::WriteJournalSnapshot(SaveData, SlotName, Journal));
+
+    UGameSaveData* Loaded = SaveGameFile::LoadFromSlot(SlotName);
+    if (TestNotNull(TEXT("Save loads"), Loaded))
+    {
+        TestEqual(TEXT("Replacement survives"), Loaded->SaveName, FString(TEXT("Replacement")));
+    }
+
+    IFileManager::Get().Delete(*SaveGameFile::GetSlotFilePath(SlotName), false, false, true);
+    SaveGameFile::DeleteSlotJournal(SlotName);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
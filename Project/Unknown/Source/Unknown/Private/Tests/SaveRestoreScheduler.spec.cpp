@@ -0,0 +1,64 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/SaveRestoreScheduler.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveRestoreScheduler_RunsPhasesInOrder,
+    "Project.Save.RestoreScheduler.RunsPhasesInOrder",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveRestoreScheduler_RunsPhasesInOrder::RunTest(const FString& Parameters)
+{
+    FSaveRestoreScheduler Scheduler;
+    TArray<int32> Order;
+    Scheduler.AddPhase(3, [&Order](int32 Index) { Order.Add(Index); });
+    Scheduler.AddStep([&Order]() { Order.Add(100); });
+    Scheduler.AddPhase(2, [&Order](int32 Index) { Order.Add(200 + Index); });
+
+    TestEqual(TEXT("Items queued"), Scheduler.GetNumItems(), 6);
+    TestTrue(TEXT("Completes with an unlimited budget"), Scheduler.Tick(TNumericLimits<double>::Max()));
+
+    const TArray<int32> Expected = { 0, 1, 2, 100, 200, 201 };
+    TestTrue(TEXT("Items ran in phase and index order"), Order == Expected);
+    TestEqual(TEXT("Progress is full"), Scheduler.GetProgress(), 1.0f);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveRestoreScheduler_RespectsBudget,
+    "Project.Save.RestoreScheduler.RespectsBudget",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveRestoreScheduler_RespectsBudget::RunTest(const FString& Parameters)
+{
+    FSaveRestoreScheduler Scheduler;
+    int32 Runs = 0;
+    Scheduler.AddPhase(4, [&Runs](int32) { Runs++; });
+
+    // A zero budget still makes progress, one item per tick
+    TestFalse(TEXT("First tick does not finish"), Scheduler.Tick(0.0));
+    TestEqual(TEXT("One item ran"), Runs, 1);
+    TestEqual(TEXT("Progress after one of four"), Scheduler.GetProgress(), 0.25f);
+
+    Scheduler.Tick(0.0);
+    Scheduler.Tick(0.0);
+    TestTrue(TEXT("Fourth tick finishes"), Scheduler.Tick(0.0));
+    TestEqual(TEXT("Every item ran once"), Runs, 4);
+    TestTrue(TEXT("Reports complete"), Scheduler.IsComplete());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveRestoreScheduler_EmptyIsComplete,
+    "Project.Save.RestoreScheduler.EmptyIsComplete",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FSaveRestoreScheduler_EmptyIsComplete::RunTest(const FString& Parameters)
+{
+    FSaveRestoreScheduler Scheduler;
+    Scheduler.AddPhase(0, [](int32) {});
+
+    TestTrue(TEXT("Nothing queued is complete"), Scheduler.IsComplete());
+    TestTrue(TEXT("Tick reports complete"), Scheduler.Tick(0.0));
+    TestEqual(TEXT("Progress is full"), Scheduler.GetProgress(), 1.0f);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
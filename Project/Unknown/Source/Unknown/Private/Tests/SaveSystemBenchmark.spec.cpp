@@ -0,0 +1,311 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Save/SaveGameFile.h"
+#include "Save/GameSaveData.h"
+#include "Save/SaveSystemHelpers.h"
+#include "Inventory/StorageComponent.h"
+#include "Inventory/ItemDefinition.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/**
+ * Save system benchmark. Builds a synthetic world (loose pickups, storage containers full of items, dimension
+ * instances with their own records), then times each stage of the save pipeline and writes a JSON report.
+ * Needs no map, player or rendering, so it runs headless:
+ *   UnrealEditor-Cmd <project> -nullrhi -unattended -ExecCmds="Automation RunTests Project.Save.Benchmark; Quit"
+ * Sizes are read from the command line: -SaveBenchPickups= -SaveBenchContainers= -SaveBenchItemsPerContainer=
+ * -SaveBenchDimensions= -SaveBenchRecordsPerDimension= -SaveBenchReport=<path>
+ */
+namespace SaveSystemBenchmark
+{
+    struct FConfig
+    {
+        int32 Pickups = 2000;
+        int32 Containers = 200;
+        int32 ItemsPerContainer = 20;
+        int32 Dimensions = 8;
+        int32 RecordsPerDimension = 500;
+        FString ReportPath = FPaths::AutomationDir() / TEXT("SaveSystemBenchmark.json");
+
+        static FConfig FromCommandLine()
+        {
+            FConfig Config;
+            const TCHAR* CommandLine = FCommandLine::Get();
+            FParse::Value(CommandLine, TEXT("SaveBenchPickups="), Config.Pickups);
+            FParse::Value(CommandLine, TEXT("SaveBenchContainers="), Config.Containers);
+            FParse::Value(CommandLine, TEXT("SaveBenchItemsPerContainer="), Config.ItemsPerContainer);
+            FParse::Value(CommandLine, TEXT("SaveBenchDimensions="), Config.Dimensions);
+            FParse::Value(CommandLine, TEXT("SaveBenchRecordsPerDimension="), Config.RecordsPerDimension);
+            FParse::Value(CommandLine, TEXT("SaveBenchReport="), Config.ReportPath);
+            return Config;
+        }
+    };
+
+    // Wall time and memory growth of one stage. Peak growth is how far the process peak rose during the stage,
+    // so it only registers stages that allocate past every earlier high-water mark.
+    struct FStageResult
+    {
+        FString Name;
+        double Milliseconds = 0.0;
+        int64 UsedMemoryDelta = 0;
+        int64 PeakMemoryDelta = 0;
+    };
+
+    template <typename FunctorType>
+    FStageResult TimeStage(const TCHAR* Name, FunctorType&& Stage)
+    {
+        const FPlatformMemoryStats Before = FPlatformMemory::GetStats();
+        const double StartSeconds = FPlatformTime::Seconds();
+        Stage();
+        const double EndSeconds = FPlatformTime::Seconds();
+        const FPlatformMemoryStats After = FPlatformMemory::GetStats();
+
+        FStageResult Result;
+        Result.Name = Name;
+        Result.Milliseconds = (EndSeconds - StartSeconds) * 1000.0;
+        Result.UsedMemoryDelta = static_cast<int64>(After.UsedPhysical) - static_cast<int64>(Before.UsedPhysical);
+        Result.PeakMemoryDelta = static_cast<int64>(After.PeakUsedPhysical) - static_cast<int64>(Before.PeakUsedPhysical);
+        return Result;
+    }
+
+    FActorStateSaveData MakeRecord(const FRandomStream& Random, const FString& ClassPath, const FVector& Origin)
+    {
+        FActorStateSaveData State;
+        State.ActorId = FGuid::NewGuid();
+        State.ActorName = FString::Printf(TEXT("Actor_%08x"), Random.GetUnsignedInt());
+        State.ActorClassPath = ClassPath;
+        State.OriginalSpawnTransform = FTransform(Random.GetUnitVector() * 5000.0 + Origin);
+        State.Location = State.OriginalSpawnTransform.GetLocation() + Random.GetUnitVector() * Random.FRandRange(0.0, 300.0);
+        State.Rotation = FRotator(0.0, Random.FRandRange(-180.0, 180.0), 0.0);
+        State.Scale = FVector::OneVector;
+        State.bHasPhysics = true;
+        State.bSimulatePhysics = true;
+        return State;
+    }
+
+    // A container actor with a storage component holding ItemsPerContainer items (each with its own custom data)
+    AActor* MakeContainer(UItemDefinition* Def, int32 ItemCount)
+    {
+        AActor* Container = NewObject<AActor>(GetTransientPackage());
+        UStorageComponent* Storage = NewObject<UStorageComponent>(Container, TEXT("Storage"));
+        Storage->MaxVolume = (ItemCount + 1) * Def->VolumePerUnit;
+        for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+        {
+            FItemEntry Entry;
+            Entry.Def = Def;
+            Entry.ItemId = FGuid::NewGuid();
+            Entry.CustomData.Add(TEXT("UsesRemaining"), FString::FromInt(ItemIndex % 5));
+            Storage->TryAdd(Entry);
+        }
+        return Container;
+    }
+
+    int64 GetDirectorySize(const FString& Directory)
+    {
+        int64 TotalSize = 0;
+        IFileManager::Get().IterateDirectoryStat(*Directory, [&TotalSize](const TCHAR*, const FFileStatData& StatData)
+        {
+            if (!StatData.bIsDirectory)
+            {
+                TotalSize += StatData.FileSize;
+            }
+            return true;
+        });
+        return TotalSize;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSaveSystemBenchmark_SaveLoad,
+    "Project.Save.Benchmark.SaveLoad",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+
+bool FSaveSystemBenchmark_SaveLoad::RunTest(const FString& Parameters)
+{
+    using namespace SaveSystemBenchmark;
+
+    const FConfig Config = FConfig::FromCommandLine();
+    const FString SlotName = TEXT("AutomationBenchmark_SaveSystem");
+    const FRandomStream Random(0x5A7E);
+    TArray<FStageResult> Stages;
+
+    UItemDefinition* Def = NewObject<UItemDefinition>(GetTransientPackage());
+    Def->VolumePerUnit = 1.f;
+
+    // === Synthetic world ===
+    UGameSaveData* SaveData = NewObject<UGameSaveData>();
+    SaveData->SaveName = TEXT("Benchmark");
+    SaveData->LevelPackagePath = TEXT("/Game/Benchmark/BenchmarkMap");
+    SaveData->bDeterministicActorIds = true;
+
+    TArray<AActor*> Containers;
+    Stages.Add(TimeStage(TEXT("GenerateWorld"), [&]()
+    {
+        for (int32 Index = 0; Index < Config.Pickups; ++Index)
+        {
+            FActorStateSaveData State = MakeRecord(Random, TEXT("/Game/Items/BP_ItemPickup.BP_ItemPickup_C"), FVector::ZeroVector);
+            State.bIsNewObject = true;
+            State.SpawnActorClassPath = State.ActorClassPath;
+            State.ItemDefinitionPath = FSoftObjectPath(Def).ToString();
+            FItemEntry Entry;
+            Entry.Def = Def;
+            Entry.ItemId = FGuid::NewGuid();
+            State.SerializedItemEntry = SaveSystemHelpers::SerializeItemEntry(Entry);
+            SaveData->ActorStates.Add(MoveTemp(State));
+        }
+
+        for (int32 Index = 0; Index < Config.Containers; ++Index)
+        {
+            Containers.Add(MakeContainer(Def, Config.ItemsPerContainer));
+        }
+
+        for (int32 DimensionIndex = 0; DimensionIndex < Config.Dimensions; ++DimensionIndex)
+        {
+            FDimensionInstanceSaveData& Dimension = SaveData->DimensionInstances.AddDefaulted_GetRef();
+            Dimension.InstanceId = FGuid::NewGuid();
+            Dimension.CartridgeId = FGuid::NewGuid();
+            Dimension.DimensionDefinitionPath = TEXT("/Game/Dimensions/DA_BenchmarkDimension.DA_BenchmarkDimension");
+            Dimension.WorldPosition = FVector(0.0, 0.0, -100000.0 * (DimensionIndex + 1));
+            for (int32 Index = 0; Index < Config.RecordsPerDimension; ++Index)
+            {
+                const FActorStateSaveData& State = Dimension.ActorStates.Add_GetRef(
+                    MakeRecord(Random, TEXT("/Game/Props/BP_Crate.BP_Crate_C"), FVector::ZeroVector));
+                Dimension.BaselineActorIds.Add(State.ActorId);
+            }
+        }
+    }));
+
+    // === Save: capture container state, write the slot, then the dimension sidecars and journal as a save does ===
+    Stages.Add(TimeStage(TEXT("CaptureContainers"), [&]()
+    {
+        for (AActor* Container : Containers)
+        {
+            FActorStateSaveData State = MakeRecord(Random, TEXT("/Game/Props/BP_Chest.BP_Chest_C"), FVector::ZeroVector);
+            SaveSystemHelpers::CaptureActorComponents(Container, State);
+            SaveData->BaselineActorIds.Add(State.ActorId);
+            SaveData->ActorStates.Add(MoveTemp(State));
+        }
+    }));
+
+    bool bSaved = false;
+    Stages.Add(TimeStage(TEXT("SaveGame"), [&]() { bSaved = SaveGameFile::SaveToSlot(SaveData, SlotName); }));
+    TestTrue(TEXT("Slot writes"), bSaved);
+
+    // Sidecars first: they take the dimension records out of the save data, so the journal doesn't inline them
+    bool bDimensionsSaved = false;
+    Stages.Add(TimeStage(TEXT("SaveDimensionInstance"), [&]() { bDimensionsSaved = SaveGameFile::WriteDimensionSidecars(SaveData, SlotName); }));
+    TestTrue(TEXT("Dimension sidecars write"), bDimensionsSaved);
+
+    FSaveJournalState Journal;
+    bool bJournaled = false;
+    Stages.Add(TimeStage(TEXT("SaveGameJournalSnapshot"), [&]() { bJournaled = SaveGameFile::WriteJournalSnapshot(SaveData, SlotName, Journal); }));
+
+    // A quicksave after a few things moved (1% of the main-world records)
+    TSet<FGuid> MovedActorIds;
+    for (int32 Index = 0; Index < SaveData->ActorStates.Num(); Index += 100)
+    {
+        SaveData->ActorStates[Index].Location += FVector(25.0, 0.0, 0.0);
+        MovedActorIds.Add(SaveData->ActorStates[Index].ActorId);
+    }
+    Stages.Add(TimeStage(TEXT("SaveGameJournalAppend"), [&]() { bJournaled = bJournaled && SaveGameFile::AppendJournalEntry(SaveData, MovedActorIds, Journal); }));
+    TestTrue(TEXT("Journal writes"), bJournaled);
+
+    const int64 SlotFileSize = IFileManager::Get().FileSize(*SaveGameFile::GetSlotFilePath(SlotName));
+    const int64 JournalFileSize = IFileManager::Get().FileSize(*SaveGameFile::GetSlotJournalPath(SlotName));
+    const int64 SidecarBytes = GetDirectorySize(SaveGameFile::GetDimensionSidecarDir(SlotName));
+
+    // === Load: slot header, full load with journal replay, dimension sidecars, container restore ===
+    FSaveFileHeader Header;
+    Stages.Add(TimeStage(TEXT("ReadSlotHeader"), [&]() { SaveGameFile::ReadSlotHeader(SlotName, Header); }));
+
+    UGameSaveData* Loaded = nullptr;
+    Stages.Add(TimeStage(TEXT("LoadGame"), [&]() { Loaded = SaveGameFile::LoadFromSlot(SlotName); }));
+    if (!TestNotNull(TEXT("Slot loads"), Loaded))
+    {
+        return false;
+    }
+    TestEqual(TEXT("Every record loads"), Loaded->ActorStates.Num(), SaveData->ActorStates.Num());
+
+    for (const FDimensionInstanceSaveData& Dimension : Loaded->DimensionInstances)
+    {
+        TestFalse(TEXT("Dimension records are left in their sidecar"), Dimension.bActorStatesResident);
+    }
+
+    int32 DimensionRecords = 0;
+    Stages.Add(TimeStage(TEXT("LoadDimensionInstance"), [&]()
+    {
+        for (FDimensionInstanceSaveData& Dimension : Loaded->DimensionInstances)
+        {
+            SaveGameFile::EnsureDimensionResident(Loaded, Dimension);
+            DimensionRecords += Dimension.ActorStates.Num();
+        }
+    }));
+    TestEqual(TEXT("Every dimension record loads"), DimensionRecords, Config.Dimensions * Config.RecordsPerDimension);
+
+    int32 RestoredContainers = 0;
+    Stages.Add(TimeStage(TEXT("RestoreContainers"), [&]()
+    {
+        for (const FActorStateSaveData& State : Loaded->ActorStates)
+        {
+            if (State.ComponentStates.Num() > 0)
+            {
+                AActor* Container = MakeContainer(Def, 0);
+                RestoredContainers += SaveSystemHelpers::RestoreActorComponents(Container, State) ? 1 : 0;
+            }
+        }
+    }));
+    TestEqual(TEXT("Every container restores"), RestoredContainers, Config.Containers);
+
+    // === Report ===
+    TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> ConfigJson = MakeShared<FJsonObject>();
+    ConfigJson->SetNumberField(TEXT("pickups"), Config.Pickups);
+    ConfigJson->SetNumberField(TEXT("containers"), Config.Containers);
+    ConfigJson->SetNumberField(TEXT("itemsPerContainer"), Config.ItemsPerContainer);
+    ConfigJson->SetNumberField(TEXT("dimensions"), Config.Dimensions);
+    ConfigJson->SetNumberField(TEXT("recordsPerDimension"), Config.RecordsPerDimension);
+    Report->SetObjectField(TEXT("config"), ConfigJson);
+
+    TSharedRef<FJsonObject> FilesJson = MakeShared<FJsonObject>();
+    FilesJson->SetNumberField(TEXT("slotBytes"), static_cast<double>(SlotFileSize));
+    FilesJson->SetNumberField(TEXT("journalBytes"), static_cast<double>(FMath::Max<int64>(JournalFileSize, 0)));
+    FilesJson->SetNumberField(TEXT("sidecarBytes"), static_cast<double>(SidecarBytes));
+    FilesJson->SetNumberField(TEXT("uncompressedBytes"), static_cast<double>(Header.UncompressedSize));
+    Report->SetObjectField(TEXT("files"), FilesJson);
+
+    TArray<TSharedPtr<FJsonValue>> StagesJson;
+    for (const FStageResult& Stage : Stages)
+    {
+        TSharedRef<FJsonObject> StageJson = MakeShared<FJsonObject>();
+        StageJson->SetStringField(TEXT("name"), Stage.Name);
+        StageJson->SetNumberField(TEXT("ms"), Stage.Milliseconds);
+        StageJson->SetNumberField(TEXT("usedMemoryDelta"), static_cast<double>(Stage.UsedMemoryDelta));
+        StageJson->SetNumberField(TEXT("peakMemoryDelta"), static_cast<double>(Stage.PeakMemoryDelta));
+        StagesJson.Add(MakeShared<FJsonValueObject>(StageJson));
+
+        AddInfo(FString::Printf(TEXT("%s: %.2f ms (used %+lld KiB, peak %+lld KiB)"),
+            *Stage.Name, Stage.Milliseconds, Stage.UsedMemoryDelta / 1024, Stage.PeakMemoryDelta / 1024));
+    }
+    Report->SetArrayField(TEXT("stages"), StagesJson);
+
+    FString ReportText;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportText);
+    FJsonSerializer::Serialize(Report, Writer);
+    TestTrue(TEXT("Report writes"), FFileHelper::SaveStringToFile(ReportText, *Config.ReportPath));
+    AddInfo(FString::Printf(TEXT("Slot %lld bytes, journal %lld bytes, sidecars %lld bytes. Report: %s"),
+        SlotFileSize, JournalFileSize, SidecarBytes, *Config.ReportPath));
+
+    IFileManager::Get().Delete(*SaveGameFile::GetSlotFilePath(SlotName), false, false, true);
+    SaveGameFile::DeleteSlotJournal(SlotName);
+    SaveGameFile::DeleteDimensionSidecars(SlotName);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -68,4 +68,24 @@ bool FStorage_NullDef_Rejected::RunTest(const FString& Parameters)
     return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStorage_UpdateItem_ReplacesEntry,
+    "Project.Storage.Core.UpdateItem",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FStorage_UpdateItem_ReplacesEntry::RunTest(const FString& Parameters)
+{
+    UStorageComponent* Box = NewObject<UStorageComponent>();
+    FItemEntry A; A.Def = MakeItemDef_Storage(1.f); A.ItemId = FGuid::NewGuid();
+    TestTrue(TEXT("Add A"), Box->TryAdd(A));
+
+    A.SetCustomDataValue(TEXT("UsesRemaining"), TEXT("2"));
+    TestTrue(TEXT("Update A"), Box->UpdateItem(A));
+    const FString* Uses = Box->GetEntries()[0].CustomData.Find(TEXT("UsesRemaining"));
+    TestTrue(TEXT("CustomData was replaced"), Uses && *Uses == TEXT("2"));
+
+    FItemEntry Unknown; Unknown.Def = A.Def; Unknown.ItemId = FGuid::NewGuid();
+    TestFalse(TEXT("Update unknown fails"), Box->UpdateItem(Unknown));
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,82 @@
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Dimensions/WeightedAliasTable.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeightedAliasTable_MatchesWeights,
+    "Project.Dimensions.WeightedAliasTable.MatchesWeights",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FWeightedAliasTable_MatchesWeights::RunTest(const FString& Parameters)
+{
+    const TArray<float> Weights = { 1.0f, 0.0f, 3.0f, 6.0f, -2.0f };
+    FWeightedAliasTable Table;
+    Table.Build(Weights);
+    TestEqual(TEXT("One slot per weight"), Table.Num(), Weights.Num());
+
+    FRandomStream Stream(1234);
+    const int32 Draws = 100000;
+    TArray<int32> Counts;
+    Counts.SetNumZeroed(Weights.Num());
+    for (int32 Draw = 0; Draw < Draws; ++Draw)
+    {
+        Counts[Table.Sample(Stream)]++;
+    }
+
+    TestEqual(TEXT("Zero weight is never picked"), Counts[1], 0);
+    TestEqual(TEXT("Negative weight is never picked"), Counts[4], 0);
+    TestTrue(TEXT("10% weight picked about 10% of the time"), FMath::IsNearlyEqual(Counts[0] / float(Draws), 0.1f, 0.01f));
+    TestTrue(TEXT("30% weight picked about 30% of the time"), FMath::IsNearlyEqual(Counts[2] / float(Draws), 0.3f, 0.01f));
+    TestTrue(TEXT("60% weight picked about 60% of the time"), FMath::IsNearlyEqual(Counts[3] / float(Draws), 0.6f, 0.01f));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeightedAliasTable_SameSeedSameSequence,
+    "Project.Dimensions.WeightedAliasTable.SameSeedSameSequence",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FWeightedAliasTable_SameSeedSameSequence::RunTest(const FString& Parameters)
+{
+    FWeightedAliasTable Table;
+    Table.Build(TArray<float>{ 2.0f, 1.0f, 1.0f, 4.0f });
+
+    // Resuming from a stored stream state continues the same sequence
+    FRandomStream First(42);
+    TArray<int32> Expected;
+    for (int32 Draw = 0; Draw < 8; ++Draw)
+    {
+        Expected.Add(Table.Sample(First));
+    }
+
+    FRandomStream Second(42);
+    TArray<int32> Replayed;
+    for (int32 Draw = 0; Draw < 4; ++Draw)
+    {
+        Replayed.Add(Table.Sample(Second));
+    }
+    FRandomStream Resumed(Second.GetCurrentSeed());
+    for (int32 Draw = 0; Draw < 4; ++Draw)
+    {
+        Replayed.Add(Table.Sample(Resumed));
+    }
+
+    TestTrue(TEXT("Same seed yields the same picks"), Expected == Replayed);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeightedAliasTable_NoPositiveWeightIsEmpty,
+    "Project.Dimensions.WeightedAliasTable.NoPositiveWeightIsEmpty",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+bool FWeightedAliasTable_NoPositiveWeightIsEmpty::RunTest(const FString& Parameters)
+{
+    FWeightedAliasTable Table;
+    Table.Build(TArray<float>{ 0.0f, -1.0f });
+
+    FRandomStream Stream(7);
+    TestTrue(TEXT("Table is empty"), Table.IsEmpty());
+    TestEqual(TEXT("Sample returns none"), Table.Sample(Stream), INDEX_NONE);
+    return true;
+}
+
+#endif
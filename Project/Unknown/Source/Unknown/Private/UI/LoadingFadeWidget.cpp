@@ -1,5 +1,6 @@
 #include "UI/LoadingFadeWidget.h"
 #include "Widgets/Layout/SBorder.h"
+#include "Widgets/Notifications/SProgressBar.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Styling/CoreStyle.h"
@@ -23,8 +24,14 @@ TSharedRef<SWidget> ULoadingFadeWidget::RebuildWidget()
 		.BorderBackgroundColor(FLinearColor::Black)
 		.ColorAndOpacity(FLinearColor::White)
 		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
-		.Visibility(EVisibility::HitTestInvisible); // Don't block input
+		.VAlign(VAlign_Bottom)
+		.Padding(FMargin(64.0f, 0.0f, 64.0f, 48.0f))
+		.Visibility(EVisibility::HitTestInvisible) // Don't block input
+		[
+			SAssignNew(LoadProgressBar, SProgressBar)
+			.Percent(LoadProgress)
+			.Visibility(LoadProgress < 1.0f ? EVisibility::HitTestInvisible : EVisibility::Collapsed)
+		];
 	
 	// Set initial opacity to transparent
 	FadeOverlay->SetRenderOpacity(0.0f);
@@ -95,6 +102,16 @@ void ULoadingFadeWidget::SetOpacity(float Opacity)
 	}
 }
 
+void ULoadingFadeWidget::SetLoadProgress(float Progress)
+{
+	LoadProgress = FMath::Clamp(Progress, 0.0f, 1.0f);
+	if (LoadProgressBar.IsValid())
+	{
+		LoadProgressBar->SetPercent(LoadProgress);
+		LoadProgressBar->SetVisibility(LoadProgress < 1.0f ? EVisibility::HitTestInvisible : EVisibility::Collapsed);
+	}
+}
+
 void ULoadingFadeWidget::TickFade()
 {
 	if (!bIsFading || !FadeOverlay.IsValid())
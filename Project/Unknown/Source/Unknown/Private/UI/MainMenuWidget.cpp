@@ -496,49 +496,40 @@ void UMainMenuWidget::OnSaveNameEntered(const FString& SaveName)
 			// For New Game, we need to start in MainMap first, then save there
 			if (PendingOperation == EPendingOperation::NewGame)
 			{
-				// Store save info in GameInstance to create save after level loads
-				// We'll use a GameMode callback or timer after level loads
-				// Create a temp save that we'll restore after level loads
-				UGameSaveData* TempSave = Cast<UGameSaveData>(UGameplayStatics::CreateSaveGameObject(UGameSaveData::StaticClass()));
-				if (TempSave)
+				// Hand the slot over to the save subsystem; it creates the save once MainMap has loaded
+				SaveSystem->SetPendingNewGame(SlotId, SaveName);
+
+				// Start the game in MainMap
+				UWorld* World = GetWorld();
+				if (World)
 				{
-					TempSave->SaveName = SaveName;
-					TempSave->LevelPackagePath = TEXT("/Game/Levels/MainMap");
-					FString TempSlotName = FString::Printf(TEXT("_NEWGAME_%s"), *SlotId);
-					UGameplayStatics::SaveGameToSlot(TempSave, TempSlotName, 0);
+					// Fade to black before opening MainMap for new game
+					APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
+					AMainMenuPlayerController* MainMenuPC = Cast<AMainMenuPlayerController>(PC);
 					
-					// Start the game in MainMap
-					UWorld* World = GetWorld();
-					if (World)
+					if (MainMenuPC && MainMenuPC->LoadingFadeWidget)
 					{
-						// Fade to black before opening MainMap for new game
-						APlayerController* PC = UGameplayStatics::GetPlayerController(World, 0);
-						AMainMenuPlayerController* MainMenuPC = Cast<AMainMenuPlayerController>(PC);
+						// Fade out quickly (0.3 seconds) to hide the transition
+						MainMenuPC->LoadingFadeWidget->FadeOut(0.3f);
 						
-						if (MainMenuPC && MainMenuPC->LoadingFadeWidget)
+						// Wait for fade to complete before opening level
+						// Use a weak pointer to the world to avoid issues
+						TWeakObjectPtr<UWorld> WeakWorld = World;
+						const float FadeOutDuration = 0.3f;
+						FTimerHandle FadeOutTimer;
+						World->GetTimerManager().SetTimer(FadeOutTimer, FTimerDelegate::CreateLambda([WeakWorld]()
 						{
-							// Fade out quickly (0.3 seconds) to hide the transition
-							MainMenuPC->LoadingFadeWidget->FadeOut(0.3f);
-							
-							// Wait for fade to complete before opening level
-							// Use a weak pointer to the world to avoid issues
-							TWeakObjectPtr<UWorld> WeakWorld = World;
-							const float FadeOutDuration = 0.3f;
-							FTimerHandle FadeOutTimer;
-							World->GetTimerManager().SetTimer(FadeOutTimer, FTimerDelegate::CreateLambda([WeakWorld]()
+							if (UWorld* WorldPtr = WeakWorld.Get())
 							{
-								if (UWorld* WorldPtr = WeakWorld.Get())
-								{
-									// Open MainMap level - save will be created after level loads
-									UGameplayStatics::OpenLevel(WorldPtr, TEXT("MainMap"));
-								}
-							}), FadeOutDuration, false);
-						}
-						else
-						{
-							// No fade widget available, open level immediately
-							UGameplayStatics::OpenLevel(World, TEXT("MainMap"));
-						}
+								// Open MainMap level - save will be created after level loads
+								UGameplayStatics::OpenLevel(WorldPtr, TEXT("MainMap"));
+							}
+						}), FadeOutDuration, false);
+					}
+					else
+					{
+						// No fade widget available, open level immediately
+						UGameplayStatics::OpenLevel(World, TEXT("MainMap"));
 					}
 				}
 			}
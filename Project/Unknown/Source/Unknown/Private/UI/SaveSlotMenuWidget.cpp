@@ -185,6 +185,15 @@ void USaveSlotMenuWidget::NativeConstruct()
 	
 	Super::NativeConstruct();
 
+	// Saves are written in the background - refresh once the file is actually on disk
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (USaveSystemSubsystem* SaveSystem = GameInstance->GetSubsystem<USaveSystemSubsystem>())
+		{
+			SaveSystem->OnSaveGameCompleted.AddUniqueDynamic(this, &USaveSlotMenuWidget::OnSaveGameCompleted);
+		}
+	}
+
 	// Set button text
 	if (BackButton)
 	{
@@ -283,6 +292,24 @@ void USaveSlotMenuWidget::RefreshSaveList()
 	}
 }
 
+void USaveSlotMenuWidget::NativeDestruct()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		if (USaveSystemSubsystem* SaveSystem = GameInstance->GetSubsystem<USaveSystemSubsystem>())
+		{
+			SaveSystem->OnSaveGameCompleted.RemoveDynamic(this, &USaveSlotMenuWidget::OnSaveGameCompleted);
+		}
+	}
+
+	Super::NativeDestruct();
+}
+
+void USaveSlotMenuWidget::OnSaveGameCompleted(const FString& SlotId, bool bSuccess)
+{
+	RefreshSaveList();
+}
+
 void USaveSlotMenuWidget::OnBackButtonClicked()
 {
 	OnBackClicked.Broadcast();
@@ -2,8 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Inventory/ItemTypes.h"
 #include "SaveableActorComponent.generated.h"
 
+class FSaveableActorSpatialIndex;
+class UPrimitiveComponent;
+
 /**
  * Component that provides persistent GUID for actor identification in save system.
  * Stores original spawn transform for physics objects to detect modifications.
@@ -17,6 +21,9 @@ public:
 	USaveableActorComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void PostInitProperties() override;
+	virtual void InitializeComponent() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	virtual void BeginPlay() override;
 
 	// Persistent unique identifier for this actor
@@ -36,6 +43,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Save")
 	bool bSavePhysicsState = true;
 
+	// Movement (cm) since the last save capture before this actor's saved state is considered stale
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Save|Dirty")
+	float DirtyLocationThreshold = 1.0f;
+
+	// Rotation (degrees) since the last save capture before this actor's saved state is considered stale
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Save|Dirty")
+	float DirtyRotationThreshold = 1.0f;
+
 	// Dimension instance ID this actor belongs to (empty for main world actors)
 	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Save|Dimension")
 	FGuid DimensionInstanceId;
@@ -44,13 +59,13 @@ public:
 	UFUNCTION(BlueprintPure, Category="Save")
 	FGuid GetPersistentId() const { return PersistentId; }
 
-	// Set the persistent ID (used when restoring from save)
+	// Set the persistent ID (used when restoring from save; keeps the world's SaveableActorRegistry in sync)
 	UFUNCTION(BlueprintCallable, Category="Save")
-	void SetPersistentId(const FGuid& NewId) { PersistentId = NewId; }
+	void SetPersistentId(const FGuid& NewId);
 
-	// Set dimension instance ID (used to tag actors in dimensions)
+	// Set dimension instance ID (used to tag actors in dimensions; keeps the world's SaveableActorRegistry in sync)
 	UFUNCTION(BlueprintCallable, Category="Save|Dimension")
-	void SetDimensionInstanceId(const FGuid& InstanceId) { DimensionInstanceId = InstanceId; }
+	void SetDimensionInstanceId(const FGuid& InstanceId);
 
 	// Get dimension instance ID
 	UFUNCTION(BlueprintPure, Category="Save|Dimension")
@@ -60,18 +75,57 @@ public:
 	UFUNCTION(BlueprintPure, Category="Save|Dimension")
 	bool BelongsToDimension() const { return DimensionInstanceId.IsValid(); }
 
-	// Static helper to find an actor by GUID in the world
+	// Force the next save to recapture this actor instead of reusing its previous record
+	UFUNCTION(BlueprintCallable, Category="Save|Dirty")
+	void MarkSaveStateDirty() { bSaveStateDirty = true; }
+
+	// True if the last captured save record is stale: explicitly dirtied, moved past the thresholds,
+	// or a simulated body is awake (its velocity keeps changing)
+	bool IsSaveStateDirty() const;
+
+	// Called by the save system after capturing this actor; later saves reuse the record until it is dirtied again
+	void MarkSaveStateCaptured();
+
+	// Deterministic ID of an actor placed in a level: a hash of the level package and the actor's path in it, or,
+	// for an actor of a streamed dimension instance, of DimensionInstanceId and its path in the source level.
+	// The same placement yields the same ID on every load (PIE prefixes are ignored).
+	static FGuid MakeLevelActorId(const AActor* Actor, const FGuid& DimensionInstanceId = FGuid());
+
+	// Static helper to find an actor by GUID in the world (O(1) via USaveableActorRegistry)
 	UFUNCTION(BlueprintCallable, Category="Save")
 	static AActor* FindActorByGuid(UWorld* World, const FGuid& ActorId);
 	
-	// Find actor by GUID with metadata fallback (for when GUIDs are regenerated)
-	// First tries GUID match, then falls back to matching by class path and original transform
+	// Find actor by GUID with metadata fallback (for saves written before deterministic IDs)
+	// First tries GUID match, then falls back to matching by class path and original transform.
+	// Pass the restore's SpatialIndex to avoid rebuilding one over the whole world per call.
+	// Without MatchedActors, candidates that already have another valid ID are skipped; with it, only the actors in
+	// it are (level actors all carry a deterministic ID, so that is the only way to match them against old saves).
 	static AActor* FindActorByGuidOrMetadata(
 		UWorld* World, 
 		const FGuid& ActorId,
 		const FString& ActorClassPath,
 		const FTransform& OriginalTransform,
-		float TransformTolerance = 10.0f
+		float TransformTolerance = 10.0f,
+		const FSaveableActorSpatialIndex* SpatialIndex = nullptr,
+		const TSet<AActor*>* MatchedActors = nullptr
 	);
-};
 
+private:
+	// Starts dirty so every actor is captured at least once
+	bool bSaveStateDirty = true;
+
+	// Owner transform at the last capture (compared against the dirty thresholds)
+	FTransform LastCapturedTransform;
+
+	UFUNCTION()
+	void HandleComponentWake(UPrimitiveComponent* WakingComponent, FName BoneName);
+
+	UFUNCTION()
+	void HandleStorageItemAdded(const FItemEntry& Item);
+
+	UFUNCTION()
+	void HandleStorageItemRemoved(const FGuid& ItemId);
+
+	UFUNCTION()
+	void HandleStorageItemChanged(const FItemEntry& Item);
+};
@@ -82,6 +82,7 @@ protected:
 	void HandleScannerMove(const FVector2D& Input);
 	void HandleScannerScroll(float ScrollDelta);
 	void PerformScan();
+	void OnDimensionScanned(class UDimensionDefinition* DimensionDef);
 	bool CheckCartridgeInserted() const;
 	bool IsCartridgeEmpty() const;
 	void UpdateNiagaraParameter(float LocalX);
@@ -11,6 +11,7 @@ class UWorld;
 /**
  * Immutable metadata for a dimension type.
  * Defines the properties of a dimension that can be scanned and loaded.
+ * The fields scanning selects on are asset registry tags, so the scan catalogue is built without loading the asset.
  */
 UCLASS(BlueprintType)
 class UNKNOWN_API UDimensionDefinition : public UDataAsset
@@ -21,7 +22,7 @@ public:
 	UDimensionDefinition();
 
 	// Stable Guid for this definition
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Dimension")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category="Dimension")
 	FGuid Guid;
 
 	// Display name for UI
@@ -37,7 +38,7 @@ public:
 	TSoftObjectPtr<UWorld> DimensionLevel;
 
 	// Type of dimension (affects rarity and behavior)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Dimension")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category="Dimension")
 	EDimensionType Type = EDimensionType::Standard;
 
 	// Dimension size (constant, immutable)
@@ -49,14 +50,14 @@ public:
 	float DefaultStability = 100.0f;
 
 	// Weight for random selection (higher = more likely to be scanned)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Dimension|Scanning", meta=(ClampMin="0.0"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category="Dimension|Scanning", meta=(ClampMin="0.0"))
 	float RarityWeight = 1.0f;
 
 	// Player requirements that must be met to scan this dimension
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Dimension|Scanning")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category="Dimension|Scanning")
 	FGameplayTagContainer RequiredTags;
 
 	// Tags that describe this dimension's characteristics
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Dimension")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AssetRegistrySearchable, Category="Dimension")
 	FGameplayTagContainer DimensionTags;
 };
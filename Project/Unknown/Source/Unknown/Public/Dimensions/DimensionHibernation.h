@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class ULevel;
+class UActorComponent;
+class UPrimitiveComponent;
+
+// What Hibernate took away from one actor, so Resume can put exactly that back
+struct FHibernatedActorState
+{
+	TWeakObjectPtr<AActor> Actor;
+	bool bWasHidden = false;
+	bool bHadCollision = true;
+	bool bWasTicking = false;
+
+	// Components whose tick was enabled
+	TArray<TWeakObjectPtr<UActorComponent>> TickingComponents;
+
+	// Bodies that were simulating, with the velocities they had
+	struct FSimulatedBody
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		FVector LinearVelocity = FVector::ZeroVector;
+		FVector AngularVelocityDegrees = FVector::ZeroVector;
+	};
+	TArray<FSimulatedBody> SimulatedBodies;
+};
+
+/**
+ * Suspends a dimension level in place: its actors are hidden, stop ticking, lose collision and stop simulating,
+ * but stay in the world, so bringing the level back is a flag flip instead of a stream-in and restore.
+ */
+namespace DimensionHibernation
+{
+	// Suspend every actor of Level, recording what was changed (replaces OutStates)
+	UNKNOWN_API void Hibernate(ULevel* Level, TArray<FHibernatedActorState>& OutStates);
+
+	// Undo Hibernate (actors destroyed meanwhile are skipped) and empty States
+	UNKNOWN_API void Resume(TArray<FHibernatedActorState>& States);
+}
@@ -4,7 +4,9 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Dimensions/DimensionDefinition.h"
 #include "Dimensions/DimensionInstanceData.h"
+#include "Dimensions/DimensionHibernation.h"
 #include "Engine/LevelStreamingDynamic.h"
+#include "Engine/TimerHandle.h"
 #include "DimensionManagerSubsystem.generated.h"
 
 class ULevel;
@@ -12,10 +14,14 @@ class ULevelStreaming;
 class UDimensionDefinition;
 class UDimensionInstanceData;
 class ADimensionSpawnMarker;
+struct FStreamableHandle;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDimensionLoaded, FGuid, InstanceId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDimensionUnloaded, FGuid, InstanceId);
 
+// Broadcast once a released instance's actors are destroyed and its level has been handed back to streaming
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDimensionReleased, FGuid, InstanceId);
+
 /**
  * Information about a loaded dimension instance
  */
@@ -44,14 +50,29 @@ struct FDimensionInstanceInfo
 	UPROPERTY()
 	TObjectPtr<ULevelStreaming> StreamingLevel;
 
-	// Whether dimension is currently loaded
+	// Whether the level has been shown once and its saved state restored
 	UPROPERTY(BlueprintReadOnly)
 	bool bIsLoaded = false;
+
+	// Whether the level is currently shown (inactive instances stay loaded but hidden)
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsVisible = false;
+
+	// Hidden by suspending its actors in place rather than by streaming the level out (see bHibernateLastInstance)
+	UPROPERTY(BlueprintReadOnly)
+	bool bHibernated = false;
+
+	// What hibernation changed on the level's actors; put back when the instance is shown again
+	TArray<FHibernatedActorState> HibernatedActors;
 };
 
 /**
  * Subsystem for managing dimension instances and level loading.
- * Handles loading/unloading dimensions at fixed positions in the open world.
+ * Several instances can be streamed in at once, each at its own world position. Only the active one is shown;
+ * the others stay loaded but hidden, so switching back to a recent dimension skips the load and restore. The
+ * most recently left instance is hibernated (its actors suspended in place) so re-entering it only flips flags;
+ * older ones are streamed out of view. Hidden instances are released least-recently-used once
+ * MaxInactiveInstances or InactiveMemoryBudgetMB is exceeded.
  */
 UCLASS()
 class UNKNOWN_API UDimensionManagerSubsystem : public UGameInstanceSubsystem
@@ -61,34 +82,78 @@ class UNKNOWN_API UDimensionManagerSubsystem : public UGameInstanceSubsystem
 public:
 	// USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
-	// Load a dimension instance at the specified position
-	// If InstanceId is valid, uses that instance ID (for restoring existing dimension)
-	// If InstanceId is invalid, generates a new instance ID (for new dimension)
+	// Start loading a dimension's level package (and the instance's saved state, if InstanceId is set) ahead of
+	// LoadDimensionInstance, so opening it only has to instance an already-loaded package. The package stays
+	// resident until another dimension is prefetched; repeat calls for the same level are free.
+	UFUNCTION(BlueprintCallable, Category="Dimension Manager")
+	void PrefetchDimension(UDimensionDefinition* DimensionDef, FGuid InstanceId);
+
+	// Make a dimension instance the active one, hiding the previously active instance.
+	// If InstanceId is valid, uses that instance ID (for restoring existing dimension); an instance that is still
+	// loaded is simply shown again. If InstanceId is invalid, generates a new instance ID (for new dimension).
+	// New instances are placed at SpawnPosition, or at the next free position along InstanceSpacing if it is taken.
 	UFUNCTION(BlueprintCallable, Category="Dimension Manager")
 	bool LoadDimensionInstance(FGuid CartridgeId, UDimensionDefinition* DimensionDef, const FVector& SpawnPosition, FGuid InstanceId = FGuid());
 
-	// Unload the current dimension instance
+	// Save and hide the active dimension instance; it stays loaded (within the budget) for a quick return
+	UFUNCTION(BlueprintCallable, Category="Dimension Manager")
+	void DeactivateDimensionInstance();
+
+	// Save and fully unload the active dimension instance
 	UFUNCTION(BlueprintCallable, Category="Dimension Manager")
 	void UnloadDimensionInstance();
 
+	// Unload every hidden instance without saving it (their state belongs to a save that is being replaced)
+	void ReleaseInactiveInstances();
+
+	// Hidden instances kept loaded for a quick return; the least recently used beyond this are unloaded
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dimension Manager", meta=(ClampMin="0"))
+	int32 MaxInactiveInstances = 2;
+
+	// Process memory (MB) above which hidden instances are unloaded least-recently-used first; 0 = no limit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dimension Manager", meta=(ClampMin="0"))
+	int32 InactiveMemoryBudgetMB = 0;
+
+	// Keep the most recently left instance in the world with its actors hidden and their tick, collision and
+	// physics suspended, instead of streaming its level out of view
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dimension Manager")
+	bool bHibernateLastInstance = true;
+
+	// Time spent destroying a released instance's actors per frame (milliseconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dimension Manager", meta=(ClampMin="0.1"))
+	float TeardownFrameBudgetMs = 2.0f;
+
+	// True while released instances are still being torn down
+	UFUNCTION(BlueprintPure, Category="Dimension Manager")
+	bool IsTeardownInProgress() const { return Teardowns.Num() > 0; }
+
+	// Offset between the world positions of instances that are loaded at the same time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Dimension Manager")
+	FVector InstanceSpacing = FVector(0.0, 100000.0, 0.0);
+
 	// Get the current streaming level
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	ULevelStreaming* GetStreamingLevel() const;
 
-	// Check if a dimension is currently loaded
+	// Check if the active dimension is loaded and shown
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	bool IsDimensionLoaded() const;
 
+	// Check if an instance is loaded, whether active or hidden
+	UFUNCTION(BlueprintPure, Category="Dimension Manager")
+	bool IsDimensionInstanceResident(FGuid InstanceId) const;
+
 	// Get current dimension instance ID
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	FGuid GetCurrentInstanceId() const;
 
-	// Get the level for a dimension instance
+	// Get the level for a dimension instance (active or hidden)
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	ULevel* GetDimensionLevel(FGuid InstanceId) const;
 
-	// Tag all actors in a dimension level with the instance ID
+	// Tag all actors in a dimension level with the instance ID and their deterministic persistent IDs
 	UFUNCTION(BlueprintCallable, Category="Dimension Manager")
 	void TagActorsInDimension(ULevel* DimensionLevel, FGuid InstanceId);
 
@@ -96,6 +161,10 @@ public:
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	FDimensionInstanceInfo GetCurrentInstanceInfo() const;
 
+	// Get the info of any loaded instance (default info if it isn't loaded)
+	UFUNCTION(BlueprintPure, Category="Dimension Manager")
+	FDimensionInstanceInfo GetInstanceInfo(FGuid InstanceId) const;
+
 	// Get the dimension instance ID the player is currently in (empty if in main world)
 	UFUNCTION(BlueprintPure, Category="Dimension Manager")
 	FGuid GetPlayerDimensionInstanceId() const { return PlayerDimensionInstanceId; }
@@ -115,20 +184,86 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Dimension Manager")
 	FOnDimensionUnloaded OnDimensionUnloaded;
 
+	UPROPERTY(BlueprintAssignable, Category="Dimension Manager")
+	FOnDimensionReleased OnDimensionReleased;
+
+	// Instances to release, least recently used first: those beyond MaxInactive hidden ones (every entry of
+	// RecentInstances but the active one), plus one more if the memory budget is exceeded
+	static TArray<FGuid> SelectEvictions(const TArray<FGuid>& RecentInstances, const FGuid& ActiveInstanceId, int32 MaxInactive, bool bOverMemoryBudget);
+
+	// SavedPosition if it is set and free, else the first free BasePosition + Spacing * N
+	static FVector FindFreeWorldPosition(const TArray<FVector>& TakenPositions, const FVector& SavedPosition, const FVector& BasePosition, const FVector& Spacing);
+
 private:
-	// Currently loaded dimension instance (only one at a time)
-	TOptional<FDimensionInstanceInfo> CurrentInstance;
+	// Every loaded (or loading) dimension instance, active or hidden
+	UPROPERTY()
+	TMap<FGuid, FDimensionInstanceInfo> Instances;
+
+	// Instance the portal currently leads to (invalid if none)
+	FGuid ActiveInstanceId;
+
+	// Loaded instances from least to most recently active
+	TArray<FGuid> RecentInstances;
 
 	// Dimension instance ID the player is currently in (empty if in main world)
 	UPROPERTY()
 	FGuid PlayerDimensionInstanceId;
 
-	// Callback when level finishes loading
+	// Level package requested by the last PrefetchDimension; the handle keeps it resident
+	FSoftObjectPath PrefetchedLevelPath;
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+
+	// Callback when a streaming level becomes visible (its actors are placed at the instance transform)
 	UFUNCTION()
-	void OnLevelLoaded();
+	void OnLevelShown();
+
+	// Tag the level's actors and restore saved state the first time an instance is shown
+	void OnDimensionLevelReady(FGuid InstanceId, ULevel* LoadedLevel);
+
+	// Save (if it was ever restored) and hide the active instance; bRelease unloads it as well
+	void DeactivateActiveInstance(bool bRelease);
+
+	// Forget an instance (no save) and queue its level for a time-sliced teardown
+	void ReleaseInstance(FGuid InstanceId);
+
+	// A released instance being torn down: its actors are destroyed a budgeted batch per frame, then the level
+	// is unloaded
+	struct FDimensionTeardown
+	{
+		FGuid InstanceId;
+		TWeakObjectPtr<ULevelStreaming> StreamingLevel;
+		TArray<TWeakObjectPtr<AActor>> Actors;
+		int32 NextActor = 0;
+	};
+	TArray<FDimensionTeardown> Teardowns;
+	FTimerHandle TeardownTickHandle;
+
+	// Destroy one budgeted batch of actors and reschedule for the next frame until every teardown is done
+	void TickTeardown();
+
+	// Destroy actors until EndTime (seconds, FPlatformTime), unloading the level once none are left.
+	// Returns true when the teardown is complete.
+	bool AdvanceTeardown(FDimensionTeardown& Teardown, double EndTime);
+
+	// Finish a pending teardown within this frame (the instance is being streamed in again)
+	void FlushTeardown(FGuid InstanceId);
+
+	// Appended to level instance names: a released level is only unloaded once it has been collected, so a new
+	// copy of the same instance must not reuse its package name
+	int32 LevelInstanceSerial = 0;
+
+	// Release hidden instances least-recently-used first while over the count or memory budget
+	void EnforceInactiveBudget();
+
+	// Mark an instance as the most recently active
+	void TouchInstance(FGuid InstanceId);
+
+	// Where to place a new instance: its saved position if free, else the first free slot from BasePosition
+	FVector AllocateWorldPosition(FGuid InstanceId, const FVector& BasePosition) const;
 
-	// Delayed callback after actors are positioned
-	void OnLevelLoadedDelayed(UWorld* World, ULevel* LoadedLevel);
+	// Forget instances of a world being torn down (their levels go with it)
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	FDelegateHandle WorldCleanupHandle;
 
 	// Helper to get the save system subsystem
 	class USaveSystemSubsystem* GetSaveSystemSubsystem() const;
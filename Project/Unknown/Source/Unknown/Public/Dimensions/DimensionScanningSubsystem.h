@@ -1,15 +1,53 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Dimensions/DimensionDefinition.h"
+#include "Dimensions/WeightedAliasTable.h"
+#include "Math/RandomStream.h"
 #include "DimensionScanningSubsystem.generated.h"
 
+class APawn;
 class UDimensionDefinition;
+struct FAssetData;
+
+// Called with the scanned definition once it is loaded (null if nothing could be scanned)
+DECLARE_DELEGATE_OneParam(FOnDimensionScanned, UDimensionDefinition* /*DimensionDef*/);
+
+// What scanning needs to know about a dimension definition, read from its asset registry tags
+USTRUCT(BlueprintType)
+struct FDimensionCatalogueEntry
+{
+	GENERATED_BODY()
+
+	// The definition asset (not loaded until it is scanned)
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	TSoftObjectPtr<UDimensionDefinition> Definition;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	FGuid Guid;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	EDimensionType Type = EDimensionType::Standard;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	float RarityWeight = 1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	FGameplayTagContainer RequiredTags;
+
+	UPROPERTY(BlueprintReadOnly, Category="Dimension Scanning")
+	FGameplayTagContainer DimensionTags;
+};
 
 /**
  * Subsystem for managing dimension scanning logic.
  * Handles dimension discovery, requirement checking, and weighted random selection.
+ * The catalogue is built from asset registry data alone; only the scanned definition is loaded.
+ * Picks come from an alias table over the eligible dimensions, drawn from the running save's random stream.
+ * Each dimension's RequiredTags are compiled to a bitset over a dense index of every required tag, and the
+ * eligible set is cached as a bitmask that is recomputed only when the player's tags change.
  */
 UCLASS()
 class UNKNOWN_API UDimensionScanningSubsystem : public UGameInstanceSubsystem
@@ -20,31 +58,76 @@ public:
 	// USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 
-	// Scan for a dimension based on rarity weights and player requirements
-	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
-	UDimensionDefinition* ScanForDimension();
+	// Pick a dimension based on rarity weights and player requirements and load its definition.
+	// OnScanned runs on the game thread, immediately if the definition is already loaded.
+	void ScanForDimension(FOnDimensionScanned OnScanned);
 
-	// Get all available dimension definitions
+	// Get all catalogued dimensions
 	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
-	TArray<UDimensionDefinition*> GetAvailableDimensions() const;
+	TArray<FDimensionCatalogueEntry> GetAvailableDimensions() const;
 
 	// Get dimensions that the player is eligible to scan (meets requirements)
 	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
-	TArray<UDimensionDefinition*> GetEligibleDimensions() const;
+	TArray<FDimensionCatalogueEntry> GetEligibleDimensions();
+
+	// Dimensions the given player is eligible to scan; follows that player's tag changes until another is asked for
+	TArray<FDimensionCatalogueEntry> GetEligibleDimensionsFor(APawn* PlayerPawn);
 
-	// Check if player meets requirements for a dimension
+	// Rebuild the eligible selection on the next scan (done automatically when the player's tags change)
 	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
-	bool CheckPlayerRequirements(UDimensionDefinition* DimensionDef) const;
+	void InvalidateEligibleDimensions() { bEligibleDirty = true; }
 
-	// Load all dimension definitions from data assets
+	// Check if player meets requirements for a dimension (has every RequiredTags tag or a child of it)
 	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
-	void LoadDimensionDefinitions();
+	bool CheckPlayerRequirements(const FDimensionCatalogueEntry& Entry) const;
+
+	// Rebuild the catalogue from the asset registry
+	UFUNCTION(BlueprintCallable, Category="Dimension Scanning")
+	void BuildDimensionCatalogue();
+
+	// Replace the catalogue with the given entries and recompile their requirements
+	void SetCatalogue(TArray<FDimensionCatalogueEntry> Entries);
+
+	// Read a catalogue entry from a definition's registry tags. Returns false if the asset predates the tags
+	// (it needs resaving) or they can't be parsed.
+	static bool MakeCatalogueEntry(const FAssetData& AssetData, FDimensionCatalogueEntry& OutEntry);
 
 private:
-	// All available dimension definitions
-	UPROPERTY()
-	TArray<TObjectPtr<UDimensionDefinition>> AvailableDimensions;
+	// All catalogued dimension definitions
+	TArray<FDimensionCatalogueEntry> Catalogue;
+
+	// Every tag some dimension requires, in dense index order
+	TArray<FGameplayTag> RequirementTags;
+
+	// Each catalogue entry's RequiredTags as bits over RequirementTags, RequirementWords words per entry
+	TArray<uint64> RequirementMasks;
+	int32 RequirementWords = 0;
+
+	// Which catalogue entries the player was eligible for when the selection was last built
+	TBitArray<> EligibleMask;
+
+	// Catalogue indices of the eligible dimensions, and the alias table over their weights
+	TArray<int32> EligibleIndices;
+	FWeightedAliasTable EligibleTable;
+	bool bEligibleDirty = true;
+
+	// Player the eligible selection was built for
+	TWeakObjectPtr<APawn> EligiblePawn;
+
+	// Used while there is no running save to keep the stream in
+	FRandomStream UnsavedStream;
+
+	// Rebuild the eligible selection if the catalogue or the player has changed
+	void RefreshEligibleDimensions(APawn* PlayerPawn);
+
+	APawn* GetLocalPlayerPawn() const;
+
+	// Compile every entry's RequiredTags into RequirementMasks
+	void CompileRequirements();
+
+	UFUNCTION()
+	void HandlePlayerTagsChanged();
 
 	// Perform weighted random selection from eligible dimensions
-	UDimensionDefinition* SelectDimensionByWeight(const TArray<UDimensionDefinition*>& EligibleDimensions) const;
+	const FDimensionCatalogueEntry* SelectDimensionByWeight();
 };
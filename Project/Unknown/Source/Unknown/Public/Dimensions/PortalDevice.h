@@ -4,6 +4,7 @@
 #include "GameFramework/Actor.h"
 #include "Components/PhysicsObjectSocketComponent.h"
 #include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
 #include "Dimensions/DimensionSpawnMarker.h"
 #include "Dimensions/DimensionCartridgeData.h"
 #include "Dimensions/ReturnPortal.h"
@@ -34,6 +35,15 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Portal")
 	TObjectPtr<UBoxComponent> PortalTriggerBox;
 
+	// Player pawns entering this sphere start a prefetch of the cartridge's dimension (see PrefetchRadius)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Portal")
+	TObjectPtr<USphereComponent> PrefetchSphere;
+
+	// Radius around the portal trigger in which an approaching player prefetches the dimension of the socketed
+	// (or carried) cartridge; 0 disables proximity prefetch
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Portal", meta=(ClampMin="0"))
+	float PrefetchRadius = 1500.0f;
+
 	// Editor-assigned spawn marker (or null to use default location)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Portal")
 	TObjectPtr<ADimensionSpawnMarker> SpawnMarker;
@@ -87,6 +97,13 @@ protected:
 	UFUNCTION()
 	void OnPortalBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	// Handle a pawn approaching the portal
+	UFUNCTION()
+	void OnPrefetchBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	// Start loading a cartridge's dimension level and saved state before the portal opens
+	void PrefetchCartridge(AItemPickup* Cartridge);
+
 	// Handle dimension loaded delegate
 	UFUNCTION()
 	void OnDimensionLoaded(FGuid InstanceId);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRandomStream;
+
+/**
+ * Walker/Vose alias table for weighted random picks.
+ * Building is O(n); each pick is one slot draw plus one coin flip, however many entries there are.
+ */
+class UNKNOWN_API FWeightedAliasTable
+{
+public:
+	// Rebuild over Weights (negative weights count as zero). Leaves the table empty if no weight is positive.
+	void Build(TConstArrayView<float> Weights);
+
+	void Reset();
+
+	// Pick an index with probability proportional to its weight. Returns INDEX_NONE if the table is empty.
+	int32 Sample(FRandomStream& Stream) const;
+
+	bool IsEmpty() const { return Probability.Num() == 0; }
+	int32 Num() const { return Probability.Num(); }
+
+private:
+	// Chance of keeping a slot's own index instead of its alias
+	TArray<float> Probability;
+	TArray<int32> Alias;
+};
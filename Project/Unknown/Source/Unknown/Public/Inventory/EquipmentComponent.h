@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Inventory/ItemTypes.h"
 #include "Inventory/EquipmentTypes.h"
+#include "Save/ComponentSaveState.h"
 #include "EquipmentComponent.generated.h"
 
 class UInventoryComponent;
@@ -16,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemUnequipped, EEquipmentSlot,
 
 /** Manages equipping/unequipping items and applying pluggable equip effects. */
 UCLASS(ClassGroup=(Inventory), meta=(BlueprintSpawnableComponent))
-class UNKNOWN_API UEquipmentComponent : public UActorComponent
+class UNKNOWN_API UEquipmentComponent : public UActorComponent, public ISaveableComponentState
 {
     GENERATED_BODY()
 public:
@@ -49,11 +50,17 @@ public:
     UPROPERTY(BlueprintAssignable, Category="Equipment|Events")
     FOnItemUnequipped OnItemUnequipped;
 
-    /** Persistence hooks (no-op for now) */
+    /** Persistence hooks: equipped items as a versioned blob (see ComponentSaveState). Reading re-applies equip effects. */
     UFUNCTION(BlueprintCallable, Category="Equipment|Save")
-    void WriteToSave(/*out*/ TArray<uint8>& OutData) const {}
+    void WriteToSave(/*out*/ TArray<uint8>& OutData) const;
     UFUNCTION(BlueprintCallable, Category="Equipment|Save")
-    void ReadFromSave(const TArray<uint8>& InData) {}
+    void ReadFromSave(const TArray<uint8>& InData);
+
+    /** ISaveableComponentState: Equipped isn't reflected, so it is written as custom state */
+    virtual int32 GetSaveStateVersion() const override { return 1; }
+    virtual void PreRestoreSaveState() override;
+    virtual void SerializeSaveState(FArchive& Ar, int32 Version) override;
+    virtual void PostRestoreSaveState(int32 SavedVersion) override;
 
 private:
     // Internal storage; not exposed to reflection to avoid UENUM requirements on EEquipmentSlot
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Inventory/ItemTypes.h"
+#include "Save/ComponentSaveState.h"
 #include "HotbarComponent.generated.h"
 
 class UInventoryComponent;
@@ -14,11 +15,11 @@ struct FHotbarSlot
 	GENERATED_BODY()
 
 	// Assigned item type for this slot (may be null if unassigned)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Hotbar")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Hotbar")
 	TObjectPtr<UItemDefinition> AssignedType = nullptr;
 
 	// Currently held unit id for this slot (valid only when selected and available)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Hotbar")
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Hotbar")
 	FGuid ActiveItemId;
 
 	bool HasActive() const { return ActiveItemId.IsValid(); }
@@ -28,7 +29,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHotbarSlotAssigned, int32, Index
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHotbarActiveChanged, int32, NewIndex, FGuid, ItemId);
 
 UCLASS(ClassGroup=(Inventory), meta=(BlueprintSpawnableComponent))
-class UNKNOWN_API UHotbarComponent : public UActorComponent
+class UNKNOWN_API UHotbarComponent : public UActorComponent, public ISaveableComponentState
 {
 	GENERATED_BODY()
 public:
@@ -67,17 +68,22 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Hotbar|Events")
 	FOnHotbarActiveChanged OnActiveChanged;
 
+	// ISaveableComponentState: slot events are re-broadcast and the active slot re-selected against the owner's inventory
+	virtual int32 GetSaveStateVersion() const override { return 1; }
+	virtual void PreRestoreSaveState() override;
+	virtual void PostRestoreSaveState(int32 SavedVersion) override;
+
 protected:
 	// 9 slots by default
-	UPROPERTY(EditAnywhere, Category="Hotbar")
+	UPROPERTY(SaveGame, EditAnywhere, Category="Hotbar")
 	TArray<FHotbarSlot> Slots;
 
 	// Currently active slot index or INDEX_NONE
-	UPROPERTY(VisibleAnywhere, Category="Hotbar")
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="Hotbar")
 	int32 ActiveIndex = INDEX_NONE;
 
 	// Cached currently held item id (redundant to Slots[ActiveIndex].ActiveItemId but useful for quick queries)
-	UPROPERTY(VisibleAnywhere, Category="Hotbar")
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="Hotbar")
 	FGuid ActiveItemId;
 
 	// Helper to pick deterministic unit id from inventory for a given type
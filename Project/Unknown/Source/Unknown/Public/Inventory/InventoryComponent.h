@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Inventory/ItemTypes.h"
+#include "Save/ComponentSaveState.h"
 #include "InventoryComponent.generated.h"
 
 class UItemDefinition;
@@ -11,7 +12,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventoryItemAdded, const FItemEn
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventoryItemRemoved, const FGuid&, ItemId);
 
 UCLASS(ClassGroup=(Inventory), meta=(BlueprintSpawnableComponent))
-class UNKNOWN_API UInventoryComponent : public UActorComponent
+class UNKNOWN_API UInventoryComponent : public UActorComponent, public ISaveableComponentState
 {
 	GENERATED_BODY()
 public:
@@ -22,7 +23,7 @@ public:
 	float MaxVolume = 30.f;
 
 	// Current entries (no stacks)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Inventory")
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Inventory")
 	TArray<FItemEntry> Entries;
 
 	UFUNCTION(BlueprintCallable, Category="Inventory")
@@ -49,4 +50,9 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category="Inventory|Events")
 	FOnInventoryItemRemoved OnItemRemoved;
+
+	// ISaveableComponentState: entries are swapped through RemoveById/OnItemAdded so listeners stay in sync
+	virtual int32 GetSaveStateVersion() const override { return 1; }
+	virtual void PreRestoreSaveState() override;
+	virtual void PostRestoreSaveState(int32 SavedVersion) override;
 };
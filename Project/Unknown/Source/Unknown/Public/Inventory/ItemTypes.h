@@ -13,15 +13,15 @@ struct FItemEntry
 	GENERATED_BODY()
 
 	// Shared definition (immutable metadata)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Item")
 	TObjectPtr<UItemDefinition> Def = nullptr;
 
 	// Unique runtime id for this unit (assigned on add if invalid)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Item")
 	FGuid ItemId;
 
 	// Optional custom data (lightweight key/value strings for now)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Item")
 	TMap<FName, FString> CustomData;
 
 	// Blueprint-friendly helper functions for CustomData
@@ -3,30 +3,32 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Inventory/ItemTypes.h"
+#include "Save/ComponentSaveState.h"
 #include "StorageComponent.generated.h"
 
 class UItemDefinition;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStorageItemAdded, const FItemEntry&, Item);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStorageItemRemoved, const FGuid&, ItemId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnStorageItemChanged, const FItemEntry&, Item);
 
 /**
  * Simple volume-based storage component for world containers (chests, lockers, etc.).
  * Mirrors UInventoryComponent API to enable shared helper logic and UI reuse.
  */
 UCLASS(ClassGroup=(Inventory), meta=(BlueprintSpawnableComponent))
-class UNKNOWN_API UStorageComponent : public UActorComponent
+class UNKNOWN_API UStorageComponent : public UActorComponent, public ISaveableComponentState
 {
 	GENERATED_BODY()
 public:
 	UStorageComponent();
 
 	// Maximum volume capacity for this storage container
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Storage")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Storage")
 	float MaxVolume = 60.f;
 
 	// Current entries (no stacks)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Storage")
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Storage")
 	TArray<FItemEntry> Entries;
 
 	UFUNCTION(BlueprintCallable, Category="Storage")
@@ -41,6 +43,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Storage")
 	bool RemoveById(const FGuid& ItemId);
 
+	// Replace the stored entry with the same ItemId (e.g. after editing its CustomData). Returns false if absent.
+	UFUNCTION(BlueprintCallable, Category="Storage")
+	bool UpdateItem(const FItemEntry& Entry);
+
 	UFUNCTION(BlueprintCallable, Category="Storage")
 	int32 CountByDef(const UItemDefinition* Def) const;
 
@@ -53,4 +59,13 @@ public:
 
 	UPROPERTY(BlueprintAssignable, Category="Storage|Events")
 	FOnStorageItemRemoved OnItemRemoved;
+
+	// An entry was modified in place (UpdateItem, or contents restored from a carried container)
+	UPROPERTY(BlueprintAssignable, Category="Storage|Events")
+	FOnStorageItemChanged OnItemChanged;
+
+	// ISaveableComponentState: entries are swapped through RemoveById/OnItemAdded so listeners stay in sync
+	virtual int32 GetSaveStateVersion() const override { return 1; }
+	virtual void PreRestoreSaveState() override;
+	virtual void PostRestoreSaveState(int32 SavedVersion) override;
 };
@@ -8,15 +8,15 @@ class UItemDefinition;
 
 /**
  * Helper functions for serializing storage component data to/from ItemEntry CustomData
- * POSSIBLY NOT CURRENTLY WORKING
  */
 namespace StorageSerialization
 {
-	// Serialize storage component entries to a string format stored in CustomData
-	// Format: "EntryCount|Def1Path|ItemId1|Def2Path|ItemId2|..."
+	// Serialize storage component entries to a string stored in CustomData / save data
+	// Format: ItemEntryArchive string (prefixed Base64 of the binary item archive)
 	UNKNOWN_API FString SerializeStorageEntries(const TArray<FItemEntry>& Entries);
 	
 	// Deserialize storage entries from CustomData string
+	// Accepts both the archive format and the legacy "EntryCount|DefPath|ItemId|CDCount|K=V..." strings
 	// Returns empty array if serialization fails
 	UNKNOWN_API TArray<FItemEntry> DeserializeStorageEntries(const FString& SerializedData);
 	
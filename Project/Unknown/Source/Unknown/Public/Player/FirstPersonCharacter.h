@@ -3,7 +3,10 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "GameplayTagContainer.h"
+#include "Engine/TimerHandle.h"
 #include "Inventory/ItemTypes.h"
+#include "Inventory/EquipmentTypes.h"
 
 class UCameraComponent;
 class UPhysicsInteractionComponent;
@@ -17,6 +20,9 @@ class UHungerComponent;
 
 #include "FirstPersonCharacter.generated.h"
 
+// Broadcast when the player's tags (GetPlayerTags) change
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPlayerTagsChanged);
+
 UCLASS()
 class UNKNOWN_API AFirstPersonCharacter : public ACharacter
 {
@@ -142,6 +148,13 @@ public:
 	// Get the held item actor (for use actions that need to update it)
 	AItemPickup* GetHeldItemActor() const { return HeldItemActor; }
 
+	// Tags the player currently has: BaseTags plus the tags of every carried and equipped item
+	UFUNCTION(BlueprintPure, Category="Tags")
+	const FGameplayTagContainer& GetPlayerTags() const { return PlayerTags; }
+
+	UPROPERTY(BlueprintAssignable, Category="Tags")
+	FOnPlayerTagsChanged OnPlayerTagsChanged;
+
 protected:
  // Currently held item actor (spawned and attached to socket)
  UPROPERTY(Transient)
@@ -170,8 +183,25 @@ protected:
     // Hunger component (tracks hunger level and decay)
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Stats", meta=(AllowPrivateAccess="true"))
     TObjectPtr<UHungerComponent> Hunger;
+
+	// Tags the player always has, regardless of items
+	UPROPERTY(EditDefaultsOnly, Category="Tags")
+	FGameplayTagContainer BaseTags;
+
+	// Current player tags (see GetPlayerTags)
+	UPROPERTY(Transient)
+	FGameplayTagContainer PlayerTags;
+
+	// Equipment handler to keep the player's tags in sync
+	UFUNCTION()
+	void OnEquipmentChanged(EEquipmentSlot Slot, const FItemEntry& Item);
     
 private:
     // Helper to refresh UI if inventory screen is open
     void RefreshUIIfInventoryOpen();
+
+	// Recompute PlayerTags on the next tick; a restore adds and removes many items in one frame
+	void SchedulePlayerTagsRefresh();
+	void RefreshPlayerTags();
+	FTimerHandle PlayerTagsRefreshHandle;
 };
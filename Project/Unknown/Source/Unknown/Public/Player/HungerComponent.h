@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Save/ComponentSaveState.h"
 #include "HungerComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHungerChanged, float, CurrentHunger, float, MaxHunger);
@@ -11,7 +12,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHungerChanged, float, CurrentHun
  * Hunger can exceed MaxHunger temporarily after eating, but decays normally.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class UNKNOWN_API UHungerComponent : public UActorComponent
+class UNKNOWN_API UHungerComponent : public UActorComponent, public ISaveableComponentState
 {
 	GENERATED_BODY()
 
@@ -41,9 +42,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Hunger")
 	FOnHungerChanged OnHungerChanged;
 
+	// ISaveableComponentState: the restored value is broadcast to the HUD
+	virtual int32 GetSaveStateVersion() const override { return 1; }
+	virtual void PostRestoreSaveState(int32 SavedVersion) override;
+
 protected:
 	// Current hunger value (can exceed MaxHunger)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Hunger")
+	UPROPERTY(SaveGame, VisibleAnywhere, BlueprintReadOnly, Category="Hunger")
 	float CurrentHunger = 100.0f;
 
 	// Maximum hunger value (used for UI display)
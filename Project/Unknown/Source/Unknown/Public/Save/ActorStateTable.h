@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Save/GameSaveData.h"
+
+/**
+ * Compact on-disk encoding of actor state records.
+ * Names, class paths, item definition paths and component asset references are stored once per table and
+ * referenced by index, and each record is prefixed with flags saying which optional sections follow, so a
+ * static crate costs an ID, two indices and a transform instead of a dozen mostly-default fields.
+ * Transforms are stored relative to the original spawn transform (omitted when unchanged), rotations as
+ * smallest-three quaternions and velocities quantized, each within the tolerances below.
+ */
+namespace ActorStateTable
+{
+	// Location offsets are quantized to this step (cm); a location this close to the original is not written
+	constexpr double LocationTolerance = 0.01;
+
+	// Rotations within this angle of the original are not written; smallest-three error is well below it
+	constexpr double RotationToleranceDegrees = 0.01;
+
+	// Per-component scale error treated as equal to unit/original scale
+	constexpr double ScaleTolerance = 1.e-4;
+
+	// Velocity quantization steps (cm/s and rad/s); velocities that round to zero are not written
+	constexpr double LinearVelocityStep = 0.01;
+	constexpr double AngularVelocityStep = 1.e-4;
+
+	// Encode States into Out (replacing its contents)
+	UNKNOWN_API void Pack(const TArray<FActorStateSaveData>& States, FPackedActorStateSaveData& Out);
+
+	// Decode a table written by Pack. Returns false and leaves OutStates empty if the table is corrupt or newer.
+	UNKNOWN_API bool Unpack(const FPackedActorStateSaveData& Packed, TArray<FActorStateSaveData>& OutStates);
+}
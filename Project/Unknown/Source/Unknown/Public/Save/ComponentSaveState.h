@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "UObject/SoftObjectPath.h"
+#include "ComponentSaveState.generated.h"
+
+class AActor;
+class UActorComponent;
+
+// Captured SaveGame state of one component on an actor
+USTRUCT()
+struct FComponentSaveRecord
+{
+	GENERATED_BODY()
+
+	// Component name on its actor (records are matched back by name)
+	UPROPERTY(SaveGame)
+	FName ComponentName;
+
+	// Component save version followed by its tagged SaveGame properties and any custom state
+	UPROPERTY(SaveGame)
+	TArray<uint8> Data;
+
+	// Assets the captured state references, so a load can stream them in before restoring
+	UPROPERTY(SaveGame)
+	TArray<FSoftObjectPath> AssetReferences;
+};
+
+UINTERFACE(MinimalAPI)
+class USaveableComponentState : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Optional hooks for components captured by ComponentSaveState.
+ * Components without it still have their UPROPERTY(SaveGame) fields captured (at version 0); implement it to
+ * version the saved layout, save state that isn't a reflected property, or re-run side effects after a restore.
+ */
+class UNKNOWN_API ISaveableComponentState
+{
+	GENERATED_BODY()
+
+public:
+	// Bump when the saved layout changes; the version a record was written with is handed back on restore
+	virtual int32 GetSaveStateVersion() const { return 0; }
+
+	// Called before saved properties are written over the component (e.g. to tear down current state)
+	virtual void PreRestoreSaveState() {}
+
+	// State that isn't a SaveGame property; runs in the same archive right after the properties
+	virtual void SerializeSaveState(FArchive& Ar, int32 Version) {}
+
+	// Called once every captured component of the actor has been restored
+	virtual void PostRestoreSaveState(int32 SavedVersion) {}
+};
+
+/**
+ * One capture/restore pass for component state: every component of an actor with UPROPERTY(SaveGame) fields
+ * (or ISaveableComponentState) is written through a single SaveGame archive, so adding saveable state to a
+ * component needs no save system changes. USaveableActorComponent is skipped; its IDs are the record keys.
+ */
+namespace ComponentSaveState
+{
+	// Whether a component has state to capture
+	UNKNOWN_API bool IsCaptured(const UActorComponent* Component);
+
+	// Write one component's state (version + properties + custom state). Saving does not modify the component.
+	UNKNOWN_API void WriteComponent(const UActorComponent* Component, TArray<uint8>& OutData, TArray<FSoftObjectPath>* OutAssetReferences = nullptr);
+
+	// Read state written by WriteComponent, including the Pre/PostRestore hooks. Returns false on corrupt data.
+	UNKNOWN_API bool ReadComponent(UActorComponent* Component, const TArray<uint8>& Data);
+
+	// Capture every captured component of an actor (replacing OutRecords)
+	UNKNOWN_API void CaptureActor(const AActor* Actor, TArray<FComponentSaveRecord>& OutRecords);
+
+	// Restore records onto an actor's components; PostRestore hooks run after all records are read.
+	// Returns the number of components restored.
+	UNKNOWN_API int32 RestoreActor(AActor* Actor, const TArray<FComponentSaveRecord>& Records);
+}
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/SaveGame.h"
+#include "Save/ComponentSaveState.h"
 #include "GameSaveData.generated.h"
 
 // Player data section
@@ -26,6 +27,11 @@ struct FPlayerSaveData
 	// Dimension instance ID the player is currently in (empty if in main world)
 	UPROPERTY(SaveGame)
 	FGuid PlayerDimensionInstanceId;
+
+	// SaveGame state of the player's components (hunger, inventory, hotbar, equipment).
+	// Supersedes CurrentHunger and the Hotbar/Inventory/Equipment sections, which are only read from older saves.
+	UPROPERTY(SaveGame)
+	TArray<FComponentSaveRecord> ComponentStates;
 };
 
 // Hotbar save data
@@ -132,6 +138,24 @@ struct FActorStateSaveData
 	
 	UPROPERTY(SaveGame)
 	float StorageMaxVolume = 60.0f;
+
+	// SaveGame state of the actor's components (e.g. storage); supersedes the storage fields above
+	UPROPERTY(SaveGame)
+	TArray<FComponentSaveRecord> ComponentStates;
+};
+
+// On-disk form of an array of actor states: strings and asset paths are interned into one table and each record
+// only carries the optional sections (spawn class, item, physics, storage) it uses. See ActorStateTable.
+USTRUCT()
+struct FPackedActorStateSaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(SaveGame)
+	TArray<FString> Strings;
+
+	UPROPERTY(SaveGame)
+	TArray<uint8> Records;
 };
 
 // Dimension instance save data
@@ -160,6 +184,18 @@ struct FDimensionInstanceSaveData
 
 	UPROPERTY(SaveGame)
 	TArray<FGuid> BaselineActorIds;
+
+	// ActorStates as written to disk (empty in memory)
+	UPROPERTY(SaveGame)
+	FPackedActorStateSaveData PackedActorStates;
+
+	// ActorStates/BaselineActorIds live in a sidecar file next to the slot instead of the main save
+	UPROPERTY(SaveGame)
+	bool bStoredInSidecar = false;
+
+	// False until the sidecar has been read (see SaveGameFile::EnsureDimensionResident)
+	UPROPERTY(Transient)
+	bool bActorStatesResident = true;
 };
 
 UCLASS()
@@ -190,6 +226,10 @@ public:
 	UPROPERTY(VisibleAnywhere, Category="SaveData")
 	FString LevelPackagePath;
 
+	// Total time played on this save, accumulated each time it is written
+	UPROPERTY(VisibleAnywhere, Category="SaveData")
+	float PlaytimeSeconds = 0.f;
+
 	// Extended save data
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData")
 	FPlayerSaveData PlayerData;
@@ -207,11 +247,20 @@ public:
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData")
 	TArray<FActorStateSaveData> ActorStates;
 
+	// ActorStates as written to disk (empty in memory; SaveGameFile packs and unpacks it)
+	UPROPERTY(SaveGame)
+	FPackedActorStateSaveData PackedActorStates;
+
 	// Baseline of actor GUIDs that existed in the level when this save was first created
 	// Used to detect which actors have been removed/destroyed
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData")
 	TArray<FGuid> BaselineActorIds;
 
+	// Level actors of this save carry IDs derived from where they were placed (USaveableActorComponent::MakeLevelActorId),
+	// so restores match them by ID alone. False for saves started before that; they keep the metadata fallback.
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData")
+	bool bDeterministicActorIds = false;
+
 	// Saved dimension instances
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData|Dimensions")
 	TArray<FDimensionInstanceSaveData> DimensionInstances;
@@ -220,6 +269,19 @@ public:
 	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData|Dimensions")
 	FGuid LoadedDimensionInstanceId;
 
+	// Current state of the dimension scan random stream, so a save and its scan sequence always yield the same
+	// dimensions
+	UPROPERTY(SaveGame, VisibleAnywhere, Category="SaveData|Dimensions")
+	int32 DimensionScanSeed = 0;
+
+	// Slot whose dimension sidecars back the non-resident entries of DimensionInstances (empty if none)
+	UPROPERTY(Transient)
+	FString SidecarSlotName;
+
+	// Identifies the snapshot a slot's save journal applies to; a journal with another ID is stale and ignored
+	UPROPERTY(SaveGame)
+	FGuid JournalBaseId;
+
 	// Get formatted timestamp string
 	UFUNCTION(BlueprintPure, Category="SaveData")
 	FString GetFormattedTimestamp() const { return Timestamp; }
@@ -227,5 +289,9 @@ public:
 	// Get save name
 	UFUNCTION(BlueprintPure, Category="SaveData")
 	FString GetSaveName() const { return SaveName; }
+
+	// Create a detached copy of every reflected field. The copy is never touched by gameplay code,
+	// so it can be serialized on a worker thread while the live save data keeps changing.
+	UGameSaveData* CreateSnapshot(UObject* Outer) const;
 };
 
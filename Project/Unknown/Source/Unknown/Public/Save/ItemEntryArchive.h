@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Inventory/ItemTypes.h"
+
+/**
+ * Versioned binary format for FItemEntry containers (inventory, storage, equipment, pickups, nested backpacks).
+ * Definition paths and CustomData keys are interned once per archive, ItemIds are written as raw 16-byte guids
+ * and CustomData values are stored typed (int/float/bool/string/nested archive).
+ */
+namespace ItemEntryArchive
+{
+	// Bump when the binary layout changes; readers reject archives newer than this
+	constexpr uint8 CurrentVersion = 1;
+
+	// Prefix marking an FString payload as a Base64 archive (anything else is a legacy pipe-delimited string)
+	UNKNOWN_API extern const TCHAR* const StringPrefix;
+
+	// Write entries to a raw binary archive
+	UNKNOWN_API void WriteEntries(const TArray<FItemEntry>& Entries, TArray<uint8>& OutBytes);
+
+	// Read entries from a raw binary archive. Entries whose definition cannot be resolved are skipped.
+	// Returns false if the archive is malformed or from a newer version.
+	UNKNOWN_API bool ReadEntries(const TArray<uint8>& Bytes, TArray<FItemEntry>& OutEntries);
+
+	// Encode entries as "StringPrefix + Base64(archive)" so they fit the existing FString save fields
+	UNKNOWN_API FString EncodeEntries(const TArray<FItemEntry>& Entries);
+
+	// Decode a string produced by EncodeEntries. Returns false if Data is not an archive string or is malformed.
+	UNKNOWN_API bool DecodeEntries(const FString& Data, TArray<FItemEntry>& OutEntries);
+
+	// True if Data carries the archive prefix (i.e. it is not a legacy pipe-delimited string)
+	UNKNOWN_API bool IsArchiveString(const FString& Data);
+
+	// Append (without duplicates) every definition path referenced by Data, including those inside nested
+	// archives, without loading anything. Accepts archive strings and legacy pipe-delimited strings.
+	UNKNOWN_API void CollectDefinitionPaths(const FString& Data, TArray<FString>& OutPaths);
+}
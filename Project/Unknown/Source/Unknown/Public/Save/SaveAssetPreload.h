@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+
+class UGameSaveData;
+struct FActorStateSaveData;
+
+/**
+ * Gathers every asset a save references so restore can request them in one async batch up front,
+ * instead of hitting LoadObject/LoadClass cold inside the restore loops.
+ */
+namespace SaveAssetPreload
+{
+	// Append (without duplicates) the item definitions and actor classes referenced by SaveData:
+	// inventory, hotbar, equipment, and every actor record in the world and in saved dimensions,
+	// including item definitions nested inside stored containers
+	UNKNOWN_API void CollectAssetPaths(const UGameSaveData* SaveData, TArray<FSoftObjectPath>& OutPaths);
+
+	// Same, for a single actor record
+	UNKNOWN_API void CollectActorStateAssetPaths(const FActorStateSaveData& ActorState, TArray<FSoftObjectPath>& OutPaths);
+
+	// Request every asset referenced by SaveData in a single async batch. OnLoaded runs on the game thread once
+	// they are in memory (immediately if nothing needs loading). Keep the returned handle alive until restore
+	// has finished so the assets can't be collected in between; it is null when nothing was requested.
+	UNKNOWN_API TSharedPtr<FStreamableHandle> RequestAsyncLoad(const UGameSaveData* SaveData, FStreamableDelegate OnLoaded);
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class UGameSaveData;
+struct FDimensionInstanceSaveData;
+
+/** Small summary stored uncompressed at the front of every save container, readable without loading the save */
+struct FSaveFileHeader
+{
+	FString SaveName;
+	FString Timestamp;
+	FString LevelPackagePath;
+	float PlaytimeSeconds = 0.f;
+	int32 ActorStateCount = 0;
+	int32 DimensionInstanceCount = 0;
+
+	// Payload sizes in bytes (filled in by SerializeSaveData)
+	int64 UncompressedSize = 0;
+	int64 CompressedSize = 0;
+
+	// Snapshot the slot's journal must match to be replayed (absent from older headers)
+	FGuid JournalBaseId;
+
+	friend UNKNOWN_API FArchive& operator<<(FArchive& Ar, FSaveFileHeader& Header);
+};
+
+// Parts of a save ReadSections can be limited to (one bit per section type). The core - names, level, playtime,
+// baseline and the other small fields - is always read.
+enum class ESaveSectionFlags : uint32
+{
+	None = 0,
+	Player = 1 << 1,
+	Inventory = 1 << 2,
+	WorldActors = 1 << 3,
+	Dimensions = 1 << 4,
+	All = Player | Inventory | WorldActors | Dimensions
+};
+ENUM_CLASS_FLAGS(ESaveSectionFlags)
+
+/**
+ * What a journaled slot currently holds on disk (its snapshot plus appended entries), so the next save can append
+ * only the records that changed. Owned by the saving side; Lock serializes every file operation on the slot.
+ * A slot rewritten or deleted elsewhere abandons its state: writes still running then drop their result instead
+ * of landing on the slot, and the owner never has to wait for them.
+ */
+struct FSaveJournalState
+{
+	FCriticalSection Lock;
+
+	// Slot the state describes and the snapshot its journal applies to (invalid = nothing known, write a snapshot)
+	FString SlotName;
+	FGuid BaseId;
+
+	// Checksum of every main-world actor record as last written, by ActorId
+	TMap<FGuid, uint32> RecordChecksums;
+	uint32 BaselineChecksum = 0;
+
+	// Checksum of the player, inventory and dimension index blocks as last written, by section type
+	TMap<uint8, uint32> BlockChecksums;
+
+	// Checksum of each dimension sidecar's contents as last written for the slot, by InstanceId
+	TMap<FGuid, uint32> SidecarChecksums;
+
+	// Bytes on disk and entries appended since the snapshot
+	int64 SnapshotBytes = 0;
+	int64 JournalBytes = 0;
+	int32 EntryCount = 0;
+
+	// Set once by Abandon; CommitLock is held only while finished files are moved into place, so it is never long
+	std::atomic<bool> bAbandoned = false;
+	FCriticalSection CommitLock;
+
+	bool IsValidFor(const FString& InSlotName) const { return BaseId.IsValid() && SlotName == InSlotName && !bAbandoned; }
+
+	// Make every write still in flight for this state drop its result (safe from any thread)
+	void Abandon()
+	{
+		FScopeLock CommitScope(&CommitLock);
+		bAbandoned = true;
+	}
+};
+
+/**
+ * On-disk save file handling: a container of independently compressed sections (core, player, inventory,
+ * world actors and one per dimension), each with its own CRC so corruption is pinned to the section it hit and
+ * sections are checked and decompressed in parallel; atomic writes; and loading of older single-payload
+ * containers and legacy (raw SaveGameToSlot) files.
+ * Dimension actor states are kept in per-instance sidecar files next to the slot; the main save only
+ * carries each dimension's index fields, and a sidecar is read the first time its dimension is streamed in.
+ * Slots can also be journaled: a save appends only the actor records that changed (plus the small core block and
+ * whichever player/inventory/dimension index blocks changed) to {SlotName}.journal, and loading replays the journal
+ * over the snapshot. Once the journal outgrows the snapshot it is compacted into a fresh one.
+ */
+namespace SaveGameFile
+{
+	// Absolute path of a slot file: Saved/SaveGames/{SlotName}.sav
+	UNKNOWN_API FString GetSlotFilePath(const FString& SlotName);
+
+	// Serialize and compress save data into a file image, one section per part. Actor records are written as
+	// packed tables (split-out fields are swapped out for the duration of the call and put back before it returns).
+	// Safe to call off the game thread as long as nothing else touches SaveData meanwhile (e.g. a snapshot).
+	UNKNOWN_API bool SerializeSaveData(UGameSaveData* SaveData, TArray<uint8>& OutBytes);
+
+	// Turn a file image back into save data (sectioned or older container, or legacy raw SaveGame bytes).
+	// Fails if any section's checksum does not match.
+	UNKNOWN_API UGameSaveData* DeserializeSaveData(const TArray<uint8>& Bytes);
+
+	// Write a file image to a slot via a temp file + rename, so a crash mid-write never leaves a torn save
+	UNKNOWN_API bool WriteSlotFileAtomic(const FString& SlotName, const TArray<uint8>& Bytes);
+
+	// Synchronous serialize + atomic write (used for transient handoff slots); drops any journal of the slot
+	UNKNOWN_API bool SaveToSlot(UGameSaveData* SaveData, const FString& SlotName);
+
+	// Load a slot written by SaveToSlot / the async save, or by UGameplayStatics::SaveGameToSlot.
+	// Journal entries written since the slot's snapshot are replayed on top (a torn last entry is dropped).
+	UNKNOWN_API UGameSaveData* LoadFromSlot(const FString& SlotName);
+
+	// Like LoadFromSlot, but only the sections selected by Sections (and the core) are read from disk, checked and
+	// applied; the payloads of the rest are seeked past, so e.g. a player-only read never touches the world actors.
+	// Older containers and legacy files have no sections and are read whole.
+	UNKNOWN_API UGameSaveData* ReadSections(const FString& SlotName, ESaveSectionFlags Sections);
+
+	// Read only the header of a slot file (a few hundred bytes), or of its latest journal entry.
+	// Returns false for legacy files that have no header or if the file is missing/corrupt.
+	UNKNOWN_API bool ReadSlotHeader(const FString& SlotName, FSaveFileHeader& OutHeader);
+
+	// Build the header describing SaveData (sizes are left at zero)
+	UNKNOWN_API FSaveFileHeader MakeHeader(const UGameSaveData* SaveData);
+
+	// Directory holding a slot's dimension sidecars: Saved/SaveGames/{SlotName}_Dimensions/
+	UNKNOWN_API FString GetDimensionSidecarDir(const FString& SlotName);
+
+	// Absolute path of one dimension's sidecar: {SidecarDir}/{InstanceId}.dim
+	UNKNOWN_API FString GetDimensionSidecarPath(const FString& SlotName, const FGuid& InstanceId);
+
+	// Move the actor states of every resident dimension into sidecars for SlotName and strip them from SaveData,
+	// copy the sidecars of non-resident dimensions over from the slot they were loaded from, and delete sidecars
+	// no dimension refers to anymore. SaveData must be a snapshot; safe off the game thread like SerializeSaveData.
+	// Given the slot's journal state (held locked by the caller), sidecars whose contents match what was last
+	// written for the slot are left as they are.
+	UNKNOWN_API bool WriteDimensionSidecars(UGameSaveData* SaveData, const FString& SlotName, FSaveJournalState* State = nullptr);
+
+	// Read a dimension's actor states from its sidecar if they haven't been yet. On a missing or corrupt sidecar
+	// the dimension is left resident with no saved states (it falls back to its level) and false is returned.
+	UNKNOWN_API bool EnsureDimensionResident(const UGameSaveData* SaveData, FDimensionInstanceSaveData& Dimension);
+
+	// Read one dimension's sidecar without touching any save data, so it can be prefetched on a worker thread
+	// before the dimension is streamed in. Returns false if the sidecar is missing or corrupt.
+	UNKNOWN_API bool ReadDimensionSidecar(const FString& SlotName, const FGuid& InstanceId, FDimensionInstanceSaveData& OutDimension);
+
+	// Delete every dimension sidecar of a slot
+	UNKNOWN_API void DeleteDimensionSidecars(const FString& SlotName);
+
+	// Journals smaller than this are never compacted, however small the snapshot
+	constexpr int64 JournalCompactionMinBytes = 256 * 1024;
+
+	// Absolute path of a slot's journal: Saved/SaveGames/{SlotName}.journal
+	UNKNOWN_API FString GetSlotJournalPath(const FString& SlotName);
+
+	// Write SaveData as a fresh snapshot with an empty journal and describe the result in OutState.
+	// Main-world records must be in SaveData (dimension sidecars are written separately). Safe off the game thread
+	// like SerializeSaveData; the caller holds OutState.Lock. Fails without touching SaveData or the slot once
+	// OutState is abandoned.
+	UNKNOWN_API bool WriteJournalSnapshot(UGameSaveData* SaveData, const FString& SlotName, FSaveJournalState& OutState);
+
+	// Append the records of SaveData that differ from State, the removed record IDs, the core block and the
+	// player/inventory/dimension blocks that changed. Only the records in RecapturedActorIds are compared (the
+	// others were reused from an earlier capture, so they are as last written). State must be valid for the slot;
+	// on failure it is invalidated so the next save writes a snapshot.
+	UNKNOWN_API bool AppendJournalEntry(UGameSaveData* SaveData, const TSet<FGuid>& RecapturedActorIds, FSaveJournalState& State);
+
+	// Whether replaying the journal would cost more than reading the snapshot again
+	UNKNOWN_API bool ShouldCompactJournal(const FSaveJournalState& State);
+
+	// Delete a slot's journal (the snapshot alone is then the whole save)
+	UNKNOWN_API void DeleteSlotJournal(const FString& SlotName);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Spreads the application of save records over several frames.
+ * Work is queued as ordered phases of indexed items; each Tick runs items until the frame budget is spent,
+ * so a large save costs a few short frames behind the loading fade instead of one long hitch.
+ */
+class UNKNOWN_API FSaveRestoreScheduler
+{
+public:
+	// Queue Count items; Work(Index) runs once per item, in index order, after every earlier phase has finished
+	void AddPhase(int32 Count, TFunction<void(int32)> Work);
+
+	// Queue a single item
+	void AddStep(TFunction<void()> Work);
+
+	// Run queued items until BudgetSeconds have elapsed (at least one item always runs).
+	// Returns true once every item has run.
+	bool Tick(double BudgetSeconds);
+
+	bool IsComplete() const { return NumProcessed >= NumItems; }
+
+	// Fraction of queued items that have run (1 when nothing is queued)
+	float GetProgress() const { return NumItems > 0 ? static_cast<float>(NumProcessed) / NumItems : 1.0f; }
+
+	int32 GetNumItems() const { return NumItems; }
+	int32 GetNumProcessed() const { return NumProcessed; }
+
+private:
+	struct FPhase
+	{
+		int32 Count;
+		TFunction<void(int32)> Work;
+	};
+
+	TArray<FPhase> Phases;
+	int32 PhaseIndex = 0;
+	int32 ItemIndex = 0;
+	int32 NumItems = 0;
+	int32 NumProcessed = 0;
+};
@@ -6,19 +6,22 @@
 
 class UItemDefinition;
 class AActor;
+class UGameSaveData;
+struct FActorStateSaveData;
 
 /**
  * Helper functions for serializing game data to/from strings for save system
  */
 namespace SaveSystemHelpers
 {
-	// Serialize a single ItemEntry to string format: "ItemDefPath|ItemId|CustomDataKey1=Value1|CustomDataKey2=Value2|..."
+	// Serialize a single ItemEntry to an ItemEntryArchive string
+	// (legacy "ItemDefPath|ItemId|CustomDataKey1=Value1|..." strings are still accepted by DeserializeItemEntry)
 	UNKNOWN_API FString SerializeItemEntry(const FItemEntry& Entry);
 	
 	// Deserialize a single ItemEntry from string format
 	UNKNOWN_API bool DeserializeItemEntry(const FString& SerializedData, FItemEntry& OutEntry);
 	
-	// Serialize equipment slot data: "SlotIndex|ItemDefPath|ItemId|CustomData..."
+	// Serialize equipment slot data: "SlotIndex|<serialized item entry>"
 	UNKNOWN_API FString SerializeEquipmentSlot(EEquipmentSlot Slot, const FItemEntry& Entry);
 	
 	// Deserialize equipment slot data, returns false if invalid
@@ -26,5 +29,21 @@ namespace SaveSystemHelpers
 	
 	// Check if a physics object should be saved (has moved significantly from original)
 	UNKNOWN_API bool ShouldSavePhysicsObject(AActor* Actor, const FTransform& OriginalTransform, float PositionThreshold = 1.0f, float RotationThreshold = 1.0f);
+
+	// Whether a save carries player component state (ComponentStates, or the hotbar/inventory/equipment sections of older saves)
+	UNKNOWN_API bool HasPlayerComponentState(const UGameSaveData* SaveData);
+
+	// Restore the player's components from ComponentStates, falling back to the per-component sections of older saves
+	UNKNOWN_API void RestorePlayerComponents(AActor* Player, const UGameSaveData* SaveData);
+
+	// Capture an actor's component state (e.g. storage) into its state record
+	UNKNOWN_API void CaptureActorComponents(const AActor* Actor, FActorStateSaveData& OutState);
+
+	// Re-read an actor's component state into a record reused from an earlier capture. Only some changes mark an
+	// actor dirty, so any other SaveGame property would otherwise be lost. Returns true if the state differed.
+	UNKNOWN_API bool RecaptureActorComponents(const AActor* Actor, FActorStateSaveData& InOutState);
+
+	// Restore a record's component state, falling back to the storage fields of older saves. Returns true if anything was restored.
+	UNKNOWN_API bool RestoreActorComponents(AActor* Actor, const FActorStateSaveData& State);
 }
 
@@ -3,8 +3,22 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/Future.h"
+#include "Engine/TimerHandle.h"
 #include "SaveSystemSubsystem.generated.h"
 
+class FSaveRestoreScheduler;
+struct FSaveJournalState;
+
+// Broadcast on the game thread once a save has been written to disk (or failed to)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSaveGameCompleted, const FString&, SlotId, bool, bSuccess);
+
+// Broadcast each frame of a time-sliced world restore with the fraction of records applied (0..1)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWorldRestoreProgress, float, Progress);
+
+// Broadcast once when a time-sliced world restore has applied every record
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnWorldRestoreCompleted);
+
 // Structure containing save slot information
 USTRUCT(BlueprintType)
 struct FSaveSlotInfo
@@ -23,11 +37,31 @@ struct FSaveSlotInfo
 	UPROPERTY(BlueprintReadOnly)
 	bool bExists;
 
+	UPROPERTY(BlueprintReadOnly)
+	FString LevelPackagePath;
+
+	UPROPERTY(BlueprintReadOnly)
+	float PlaytimeSeconds;
+
+	// Size of the save file on disk, and of the save data once decompressed
+	UPROPERTY(BlueprintReadOnly)
+	int64 FileSizeBytes;
+
+	UPROPERTY(BlueprintReadOnly)
+	int64 UncompressedSizeBytes;
+
+	// Slot file name on disk (SaveSlot_{SlotId}_{SanitizedSaveName}), without extension
+	FString SlotName;
+
 	FSaveSlotInfo()
 		: SlotId(TEXT(""))
 		, SaveName(TEXT(""))
 		, Timestamp(TEXT(""))
 		, bExists(false)
+		, LevelPackagePath(TEXT(""))
+		, PlaytimeSeconds(0.f)
+		, FileSizeBytes(0)
+		, UncompressedSizeBytes(0)
 	{
 	}
 };
@@ -40,15 +74,57 @@ class UNKNOWN_API USaveSystemSubsystem : public UGameInstanceSubsystem
 public:
 	// USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 
-	// Save the game to a slot
+	// Save the game to a slot. The world state is captured immediately on the game thread;
+	// serialization, compression and the file write run on a background task (see OnSaveGameCompleted).
+	// Returns false if the save could not be started, e.g. because another save is still being written.
 	UFUNCTION(BlueprintCallable, Category="SaveSystem")
 	bool SaveGame(const FString& SlotId, const FString& SaveName);
 
+	// True while a background save write is in progress
+	UFUNCTION(BlueprintPure, Category="SaveSystem")
+	bool IsSaveInProgress() const { return bSaveInFlight; }
+
+	// Saves to the slot already being played append only the changed records to a journal next to it;
+	// the journal is folded back into a full snapshot in the background once it outgrows the snapshot
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="SaveSystem|Save")
+	bool bJournaledSaves = true;
+
+	// Fired when a SaveGame() write finishes
+	UPROPERTY(BlueprintAssignable, Category="SaveSystem|Events")
+	FOnSaveGameCompleted OnSaveGameCompleted;
+
 	// Load the game from a slot
 	UFUNCTION(BlueprintCallable, Category="SaveSystem")
 	bool LoadGame(const FString& SlotId);
 
+	// Time spent applying save records per frame while restoring a world (milliseconds)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="SaveSystem|Restore", meta=(ClampMin="0.5"))
+	float RestoreFrameBudgetMs = 4.0f;
+
+	// Run Scheduler one budgeted slice per frame until it completes, then call OnComplete
+	// and broadcast OnWorldRestoreCompleted. A restore already in progress is finished synchronously first.
+	void StartTimeSlicedRestore(UWorld* World, TSharedRef<FSaveRestoreScheduler> Scheduler, TFunction<void()> OnComplete = nullptr);
+
+	// Request every asset SaveData references in one async batch; OnLoaded runs once they are in memory.
+	// Called before any restore so LoadObject/LoadClass inside the restore loops only find loaded assets.
+	void PreloadSaveAssets(class UGameSaveData* SaveData, TFunction<void()> OnLoaded);
+
+	// True while a time-sliced world restore is still applying records
+	UFUNCTION(BlueprintPure, Category="SaveSystem|Restore")
+	bool IsRestoreInProgress() const { return ActiveRestore.IsValid(); }
+
+	// Fraction of the current restore that has been applied (1 when idle)
+	UFUNCTION(BlueprintPure, Category="SaveSystem|Restore")
+	float GetRestoreProgress() const;
+
+	UPROPERTY(BlueprintAssignable, Category="SaveSystem|Events")
+	FOnWorldRestoreProgress OnWorldRestoreProgress;
+
+	UPROPERTY(BlueprintAssignable, Category="SaveSystem|Events")
+	FOnWorldRestoreCompleted OnWorldRestoreCompleted;
+
 	// Delete a save slot
 	UFUNCTION(BlueprintCallable, Category="SaveSystem")
 	bool DeleteSave(const FString& SlotId);
@@ -76,6 +152,17 @@ public:
 	// Check for and create pending new game save (called after level loads)
 	void CheckAndCreatePendingNewGameSave();
 
+	// Remember a new game requested from the main menu; the real save is created once MainMap has loaded
+	void SetPendingNewGame(const FString& SlotId, const FString& SaveName);
+	bool HasPendingNewGame() const { return !PendingNewGameSlotId.IsEmpty(); }
+
+	// Level-transition handoff: save data to restore once the next map's player controller begins play.
+	// Held in memory (game instance subsystems survive OpenLevel) instead of a temp slot on disk.
+	void SetPendingRestore(class UGameSaveData* SaveData);
+	class UGameSaveData* GetPendingRestore() const;
+	bool HasPendingRestore() const;
+	void ClearPendingRestore();
+
 	// Save dimension instance actor states
 	UFUNCTION(BlueprintCallable, Category="SaveSystem|Dimensions")
 	bool SaveDimensionInstance(FGuid InstanceId);
@@ -84,6 +171,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="SaveSystem|Dimensions")
 	bool LoadDimensionInstance(FGuid InstanceId);
 
+	// Read a dimension's saved actor states from its sidecar on a worker thread, so LoadDimensionInstance finds
+	// them resident instead of reading the file when the dimension streams in. No-op if they already are.
+	void PrefetchDimensionState(FGuid InstanceId);
+
 	// Get all actors belonging to a dimension
 	TArray<AActor*> GetActorsForDimension(UWorld* World, FGuid InstanceId) const;
 
@@ -96,11 +187,93 @@ public:
 
 private:
 	// Internal function to perform the actual loading after fade completes
-	bool LoadGameAfterFade(const FString& SlotId);
+	bool LoadGameAfterFade(const FString& SlotId, class UGameSaveData* SaveGameInstance);
 
-	// Internal function to fade in after loading completes (for same-level loads)
+	// Internal function to fade in after loading completes (for same-level loads).
+	// Waits for OnWorldRestoreCompleted if a time-sliced restore is still running.
+	UFUNCTION()
 	void FadeInAfterLoad();
 
+	// Run one budgeted slice of the active restore and reschedule for the next frame
+	void TickTimeSlicedRestore();
+
+	// Finish the active restore: report full progress, run its completion and broadcast OnWorldRestoreCompleted
+	void FinishTimeSlicedRestore();
+
+	// Assets requested by the last PreloadSaveAssets, kept resident until the next load replaces them
+	// (dimension restores can run well after the world restore has finished)
+	TSharedPtr<struct FStreamableHandle> SaveAssetPreloadHandle;
+
+	// Restore currently being applied (null when idle)
+	TSharedPtr<FSaveRestoreScheduler> ActiveRestore;
+	TWeakObjectPtr<UWorld> ActiveRestoreWorld;
+	TFunction<void()> ActiveRestoreOnComplete;
+	FTimerHandle RestoreTickHandle;
+
+	// Snapshot the save data and hand serialization + the atomic file write to a background task.
+	// RecapturedActorIds are the records this save built rather than reused (what a journal entry has to compare).
+	void WriteSaveAsync(class UGameSaveData* SaveData, const FString& SlotId, const FString& SlotName, TSet<FGuid> RecapturedActorIds);
+
+	// Game-thread completion of WriteSaveAsync; bCompact starts a background compaction of the slot's journal
+	void OnSaveWriteFinished(const FString& SlotId, const FString& SlotName, bool bSuccess, bool bCompact, int32 JournalEntryCount);
+
+	// Fold the slot journal into a fresh snapshot of SaveData, unless another save has been journaled since
+	void StartJournalCompaction(class UGameSaveData* SaveData, const FString& SlotId, const FString& SlotName, int32 JournalEntryCount);
+
+	// Forget the journal state of a slot rewritten or deleted outside the journal; a save or compaction still
+	// writing it drops its result
+	void ResetSlotJournal(const FString& SlotName);
+
+	// Journal state of the slot last saved with WriteSaveAsync (shared with the background tasks)
+	TSharedPtr<FSaveJournalState> SlotJournal;
+
+	// Snapshot being compacted into the slot file (referenced here so GC can't collect it mid-write)
+	UPROPERTY()
+	TObjectPtr<class UGameSaveData> CompactionSnapshot;
+
+	// Journal state the in-flight compaction works on (abandoned on shutdown or when its slot is reset)
+	TSharedPtr<FSaveJournalState> CompactionJournal;
+
+	// Snapshot currently being written (referenced here so GC can't collect it mid-write)
+	UPROPERTY()
+	TObjectPtr<class UGameSaveData> InFlightSaveSnapshot;
+
+	// Scan the save directory once and read every slot header into SlotInfoCache
+	void EnsureSlotInfoCache() const;
+
+	// Re-read the header of one slot file into the cache (after it was written)
+	void RefreshSlotInfo(const FString& SlotId, const FString& SlotName) const;
+
+	// Build slot info from a slot file, reading only its header when it has one
+	FSaveSlotInfo ReadSlotInfo(const FString& SlotId, const FString& SlotName) const;
+
+	// Slot info keyed by SlotId. Filled lazily by the const slot queries, kept in sync by save/delete.
+	mutable TMap<FString, FSaveSlotInfo> SlotInfoCache;
+	mutable bool bSlotInfoCacheValid = false;
+
+	// Adds the time since the last save/load to SaveData->PlaytimeSeconds
+	void AccumulatePlaytime(class UGameSaveData* SaveData);
+
+	// FPlatformTime::Seconds() when playtime was last accumulated (0 = not tracking yet)
+	double PlaytimeAnchorSeconds = 0.0;
+
+	// Guard against starting a second save while one is still being written
+	bool bSaveInFlight = false;
+
+	// Result of the in-flight background write (waited on during shutdown)
+	TFuture<bool> InFlightSaveResult;
+
+	// Dimensions whose sidecar is being read by PrefetchDimensionState
+	TSet<FGuid> DimensionStatePrefetches;
+
+	// Save data waiting to be restored after a level transition (see SetPendingRestore)
+	UPROPERTY()
+	TObjectPtr<class UGameSaveData> PendingRestoreData;
+
+	// New game waiting for MainMap to load (see SetPendingNewGame)
+	FString PendingNewGameSlotId;
+	FString PendingNewGameSaveName;
+
 public:
 	// Get the save slot name from slot ID and save name (for use with UGameplayStatics)
 	// Format: SaveSlot_{SlotId}_{SanitizedSaveName}
@@ -112,9 +285,6 @@ public:
 	// Sanitize a save name for use in filename (removes invalid characters)
 	FString SanitizeSaveNameForFilename(const FString& SaveName) const;
 	
-	// Pending new game save info (stored in temp save slot)
-	static constexpr const TCHAR* PendingNewGameSlotPrefix = TEXT("_NEWGAME_");
-	
 	// Pending level to load (set when level transition is needed)
 	FString PendingLevelLoad;
 	
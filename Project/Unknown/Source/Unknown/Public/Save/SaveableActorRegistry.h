@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Save/GameSaveData.h"
+#include "SaveableActorRegistry.generated.h"
+
+class USaveableActorComponent;
+class AActor;
+
+/**
+ * Per-world index of live USaveableActorComponents keyed by persistent GUID and by dimension instance.
+ * Components register themselves in OnRegister and unregister in OnUnregister, and notify the registry when
+ * their persistent ID or dimension instance changes, so save/load lookups never have to walk the world.
+ */
+UCLASS()
+class UNKNOWN_API USaveableActorRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Convenience accessor (null if World is null)
+	static USaveableActorRegistry* Get(const UWorld* World);
+
+	// Add a component under its current persistent ID and dimension instance
+	void Register(USaveableActorComponent* Component);
+
+	// Remove a component from all indices
+	void Unregister(USaveableActorComponent* Component);
+
+	// Re-key a registered component after SetPersistentId
+	void UpdatePersistentId(USaveableActorComponent* Component, const FGuid& OldId);
+
+	// Move a registered component to another dimension bucket after SetDimensionInstanceId
+	void UpdateDimensionInstanceId(USaveableActorComponent* Component, const FGuid& OldInstanceId);
+
+	// O(1) lookup by persistent ID
+	USaveableActorComponent* FindComponent(const FGuid& PersistentId) const;
+	AActor* FindActor(const FGuid& PersistentId) const;
+
+	// O(k) lookup of every actor tagged with a dimension instance
+	TArray<AActor*> GetActorsForDimension(const FGuid& InstanceId) const;
+
+	// Every live registered component with a persistent ID (world and dimension actors alike)
+	TArray<USaveableActorComponent*> GetComponents() const;
+
+	// Record captured for a component by an earlier save, or null if the component is dirty / never captured
+	const FActorStateSaveData* FindCapturedState(const USaveableActorComponent* Component) const;
+
+	// Remember a freshly captured record and mark the component clean
+	void StoreCapturedState(USaveableActorComponent* Component, const FActorStateSaveData& State);
+
+	// Forget every captured record (another save is now running, so none of them may be reused)
+	void ResetCapturedStates() { CapturedStates.Empty(); }
+
+	// Number of registered components (for diagnostics/tests)
+	int32 Num() const { return ComponentsById.Num(); }
+
+	virtual void Deinitialize() override;
+
+private:
+	TMap<FGuid, TWeakObjectPtr<USaveableActorComponent>> ComponentsById;
+	TMap<FGuid, TSet<TWeakObjectPtr<USaveableActorComponent>>> ComponentsByDimension;
+
+	// Last captured save record per persistent ID (incremental saves)
+	TMap<FGuid, FActorStateSaveData> CapturedStates;
+
+	void AddToDimension(USaveableActorComponent* Component, const FGuid& InstanceId);
+	void RemoveFromDimension(USaveableActorComponent* Component, const FGuid& InstanceId);
+};
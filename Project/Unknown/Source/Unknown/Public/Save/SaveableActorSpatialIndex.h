@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+class ULevel;
+
+/**
+ * Uniform-grid spatial hash of saveable actors, bucketed by interned class path and grid cell.
+ * Built once at the start of a restore so metadata fallback matching (class path + original transform)
+ * becomes a neighbourhood lookup instead of a scan of every actor per unmatched record.
+ */
+class UNKNOWN_API FSaveableActorSpatialIndex
+{
+public:
+	explicit FSaveableActorSpatialIndex(float InCellSize = 100.0f);
+
+	// Index an actor under its OriginalTransform location and its current location (no-op without a SaveableActorComponent)
+	void Add(AActor* Actor);
+
+	// Index every saveable actor in a world / level
+	void AddWorldActors(UWorld* World);
+	void AddLevelActors(ULevel* Level);
+
+	// Append (without duplicates) live candidates of ClassPath indexed within Radius of Center.
+	// Candidates keep the order they were added in, so the first match is the same one a linear scan would find.
+	void Query(FName ClassPath, const FVector& Center, float Radius, TArray<AActor*>& OutCandidates) const;
+
+	// Saved class paths are interned once per record; FName compares case-insensitively like FString did
+	static FName InternClassPath(const FString& ClassPath) { return FName(*ClassPath); }
+
+	int32 Num() const { return NumActors; }
+
+private:
+	struct FCellKey
+	{
+		FName ClassPath;
+		FIntVector Cell;
+
+		bool operator==(const FCellKey& Other) const { return ClassPath == Other.ClassPath && Cell == Other.Cell; }
+		friend uint32 GetTypeHash(const FCellKey& Key) { return HashCombine(GetTypeHash(Key.ClassPath), GetTypeHash(Key.Cell)); }
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location;
+		int32 Order;
+	};
+
+	float CellSize;
+	int32 NumActors = 0;
+	TMap<FCellKey, TArray<FEntry>> Buckets;
+
+	// GetPathName allocates, so each class is resolved once
+	TMap<const UClass*, FName> ClassPathNames;
+
+	FIntVector ToCell(const FVector& Location) const;
+	FName GetClassPathName(const UClass* Class);
+	void AddEntry(FName ClassPath, AActor* Actor, const FVector& Location);
+};
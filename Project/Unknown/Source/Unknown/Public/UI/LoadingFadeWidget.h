@@ -5,6 +5,7 @@
 #include "LoadingFadeWidget.generated.h"
 
 class SBorder;
+class SProgressBar;
 
 /**
  * Fullscreen fade widget for loading transitions.
@@ -40,6 +41,13 @@ public:
 	UFUNCTION(BlueprintPure, Category="Fade")
 	float GetOpacity() const { return CurrentOpacity; }
 
+	// Show restore progress (0..1) along the bottom of the overlay; hidden again once it reaches 1
+	UFUNCTION(BlueprintCallable, Category="Fade")
+	void SetLoadProgress(float Progress);
+
+	UFUNCTION(BlueprintPure, Category="Fade")
+	float GetLoadProgress() const { return LoadProgress; }
+
 protected:
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual void NativeConstruct() override;
@@ -48,6 +56,12 @@ private:
 	// Fullscreen black overlay (Slate widget)
 	TSharedPtr<SBorder> FadeOverlay;
 
+	// Restore progress bar inside the overlay (collapsed when not loading)
+	TSharedPtr<SProgressBar> LoadProgressBar;
+
+	UPROPERTY()
+	float LoadProgress = 1.0f;
+
 	// Current opacity (0 = transparent, 1 = fully opaque)
 	UPROPERTY()
 	float CurrentOpacity = 0.0f;
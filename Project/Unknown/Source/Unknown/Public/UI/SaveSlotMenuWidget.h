@@ -75,6 +75,7 @@ public:
 protected:
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	// Widget tree references
 	UPROPERTY(Transient)
@@ -108,6 +109,10 @@ private:
 	// Selected slot ID
 	FString SelectedSlotId;
 
+	// Refresh the list when a background save finishes writing
+	UFUNCTION()
+	void OnSaveGameCompleted(const FString& SlotId, bool bSuccess);
+
 	// Button click handlers
 	UFUNCTION()
 	void OnBackButtonClicked();
@@ -10,7 +10,7 @@ public class Unknown : ModuleRules
 	
   PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayTags", "DeveloperSettings", "UMG", "Slate", "SlateCore", "Niagara" });
 
-  PrivateDependencyModuleNames.AddRange(new string[] { "PhysicsCore", "ImageWrapper", "ImageCore", "RenderCore" });
+  PrivateDependencyModuleNames.AddRange(new string[] { "PhysicsCore", "ImageWrapper", "ImageCore", "RenderCore", "Json" });
 
   // UI dependencies for runtime drawing of selection box via UMG/Slate
   PrivateDependencyModuleNames.AddRange(new string[] { });